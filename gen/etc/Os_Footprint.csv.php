@@ -0,0 +1,157 @@
+<?php
+/* Copyright 2008, 2009 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Generated Footprint Map
+ **
+ ** The map assigns the symbols of the generated configuration to the kernel
+ ** objects, it is evaluated after the link by
+ ** modules/rtos/tst/footprint/bin/footprint.pl with the sizes of the symbols
+ ** in the image.
+ **
+ ** \file Os_Footprint.csv
+ **/
+?>
+# DO NOT CHANGE THIS FILE, IT IS GENERATED AUTOMATICALY
+#
+# FreeOSEK Os footprint map
+#
+# <type>,<object>,<symbol>,<share>
+#    the symbol is assigned to the object, a symbol assigned to more than
+#    one object is split in proportion to the share of each one. A symbol
+#    ending with * stands for all the symbols starting with it, with the
+#    object * each of them is an object on its own.
+# BUDGET,<RAM|ROM|CODE>,<bytes>
+#    the build fails if the total of the memory exceeds the budget.
+#
+<?php
+
+$this->loadHelper("modules/rtos/gen/ginc/Multicore.php");
+
+$os = $this->config->getList("/OSEK","OS");
+$tasks = $this->helper->multicore->getLocalList("/OSEK", "TASK");
+$scheduling = $this->config->getValue("/OSEK/" . $os[0],"SCHEDULING");
+
+foreach ($tasks as $task)
+{
+   print "TASK,$task,StackTask$task,1\n";
+   print "TASK,$task,ContextTask$task,1\n";
+   print "TASK,$task,TasksConst,1\n";
+   print "TASK,$task,TasksVar,1\n";
+   if ($this->config->getValue("/OSEK/" . $task, "ACTIVATIONARG") == "TRUE")
+   {
+      print "TASK,$task,ArgQueue$task,1\n";
+   }
+   if ( ($scheduling == "EDF") &&
+        ($this->config->getValue("/OSEK/" . $task, "ACTIVATION") > 1) )
+   {
+      print "TASK,$task,DeadlineQueue$task,1\n";
+   }
+}
+
+/* the ready lists depend on the priorities, the partitions and the image
+ * of the configuration, all of them are taken from the symbols */
+print "READYLIST,*,ReadyList*,1\n";
+print "READYLIST,ReadyConst,ReadyConst,1\n";
+print "READYLIST,ReadyVar,ReadyVar,1\n";
+
+$alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
+foreach ($alarms as $alarm)
+{
+   print "ALARM,$alarm,AlarmsConst,1\n";
+   print "ALARM,$alarm,AlarmsVar,1\n";
+}
+
+$counters = $this->helper->multicore->getLocalList("/OSEK", "COUNTER");
+foreach ($counters as $counter)
+{
+   print "COUNTER,$counter,CountersConst,1\n";
+   print "COUNTER,$counter,CountersVar,1\n";
+   print "COUNTER,$counter,OSEK_ALARMLIST_$counter,1\n";
+}
+
+$resources = $this->config->getList("/OSEK","RESOURCE");
+foreach ($resources as $resource)
+{
+   print "RESOURCE,$resource,ResourcesPriority,1\n";
+   print "RESOURCE,$resource,ResourcesInterruptMask,1\n";
+}
+
+$semaphores = $this->config->getList("/OSEK","SEMAPHORE");
+foreach ($semaphores as $semaphore)
+{
+   print "SEMAPHORE,$semaphore,SemaphoresConst,1\n";
+   print "SEMAPHORE,$semaphore,SemaphoresVar,1\n";
+}
+
+$datas = $this->config->getList("/OSEK","DATA");
+foreach ($datas as $data)
+{
+   print "DATA,$data,DataBuffer$data,1\n";
+   print "DATA,$data,DataConst,1\n";
+   print "DATA,$data,DataVar,1\n";
+}
+
+$pipelines = $this->config->getList("/OSEK","PIPELINE");
+foreach ($pipelines as $pipeline)
+{
+   $stages = $this->config->getList("/OSEK/" . $pipeline, "STAGE");
+   for ($stage = 0; $stage < count($stages) - 1; $stage++)
+   {
+      print "PIPELINE,$pipeline,PipelineBuffer" . $pipeline . $stages[$stage] . ",1\n";
+   }
+   print "PIPELINE,$pipeline,PipelinesConst,1\n";
+   print "PIPELINE,$pipeline,PipelineStagesConst," . count($stages) . "\n";
+   print "PIPELINE,$pipeline,PipelineStagesVar," . count($stages) . "\n";
+}
+
+/* budgets of the whole kernel */
+foreach (array("RAM", "ROM", "CODE") as $memory)
+{
+   $budget = $this->config->getValue("/OSEK/" . $os[0], "FOOTPRINT" . $memory);
+   if ($budget != "")
+   {
+      if ( (!is_numeric($budget)) || ($budget < 0) )
+      {
+         $this->log->error("FOOTPRINT$memory shall be a size in bytes");
+      }
+      else
+      {
+         print "BUDGET,$memory,$budget\n";
+      }
+   }
+}
+
+?>
@@ -0,0 +1,97 @@
+<?php
+/* Copyright 2008, 2009 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Generated Linker Script Fragment of the Hot Sections
+ **
+ ** \file Os_Hot.ld
+ **/
+?>
+/********************************************************
+ * DO NOT CHANGE THIS FILE, IT IS GENERATED AUTOMATICALY*
+ ********************************************************/
+
+/* FreeOSEK Os hot sections
+ *
+ * With HOTSECTIONS the scheduler, the ready lists, the counters and the
+ * context switch are executed from RAM, their code is copied from flash and
+ * their data is cleared by StartOs_Arch. This fragment shall be included in
+ * the SECTIONS of the linker script of the project before the output
+ * sections collecting .text* and .bss*, the first matching input section
+ * description takes the hot sections. The linker script selects the memory
+ * for them, for example the tightly coupled or local RAM. The code is
+ * loaded before the output sections which follow in the same memory,
+ * therefore a memory other than the one of the vector table is used to
+ * load it, see modules/rtos/tst/bench/hot/etc/hot.ld:
+ *
+ *    REGION_ALIAS("OSEK_HOT_RAM", RamLoc40);
+ *    REGION_ALIAS("OSEK_HOT_ROM", MFlashB512);
+ *    SECTIONS
+ *    {
+ *       INCLUDE Os_Hot.ld
+ *       ...
+ *
+ * The calls between flash and RAM which are out of the range of a bl are
+ * done over veneers inserted by the linker.
+ */
+<?php
+$os = $this->config->getList("/OSEK","OS");
+if ($this->config->getValue("/OSEK/" . $os[0],"HOTSECTIONS") == "TRUE")
+{
+?>
+.osek_hot_text : ALIGN(4)
+{
+   __osek_hot_text_start = .;
+   *(.text.osek_hot .text.osek_hot.*)
+   . = ALIGN(4);
+   __osek_hot_text_end = .;
+} > OSEK_HOT_RAM AT > OSEK_HOT_ROM
+
+__osek_hot_text_load = LOADADDR(.osek_hot_text);
+
+.osek_hot_bss (NOLOAD) : ALIGN(4)
+{
+   __osek_hot_bss_start = .;
+   *(.bss.osek_hot .bss.osek_hot.*)
+   . = ALIGN(4);
+   __osek_hot_bss_end = .;
+} > OSEK_HOT_RAM
+<?php
+}
+else
+{
+   print "/* HOTSECTIONS is disabled, the kernel is linked with the rest of the code */\n";
+}
+?>
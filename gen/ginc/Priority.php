@@ -0,0 +1,108 @@
+<?php
+/* Copyright 2008, 2009 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Generator priority functions
+ **
+ ** This file implements auxiliary functions to map the OIL priorities to
+ ** the priorities of the ready lists
+ **
+ ** \file Priority.php
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup Generator
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+require_once('Helper.php');
+/*=================[user functions]==========================================*/
+
+class Priority extends Helper
+{
+
+   public function __construct($config, $definitions, $log)
+   {
+      parent::__construct($config, $definitions, $log);
+   }
+
+   /**   \brief Get the priorities of the ready lists
+   *
+   *    The OIL priorities are mapped to consecutive priorities. With
+   *    DYNAMICPRIORITY the tasks can get any priority at runtime, the OIL
+   *    priorities are used without mapping and a ready list is generated for
+   *    each priority up to the highest one. The same is done with POSTBUILD
+   *    since the priorities are taken from the post build image.
+   *
+   *    \param tasks list of the tasks
+   *    \return array indexed by the OIL priority with the priority of the
+   *            ready list, sorted from the highest priority
+   */
+   function getReadyPriorities($tasks)
+   {
+      $os = $this->config->getList("/OSEK","OS");
+      $dynamicpriority = ( $this->config->getValue("/OSEK/" . $os[0],"DYNAMICPRIORITY") == "TRUE" );
+      $postbuild = ( $this->config->getValue("/OSEK/" . $os[0],"POSTBUILD") == "TRUE" );
+
+      if ($dynamicpriority || $postbuild)
+      {
+         $maxpriority = 0;
+         foreach ($tasks as $task)
+         {
+            if ($this->config->getValue("/OSEK/" . $task, "PRIORITY") > $maxpriority)
+            {
+               $maxpriority = $this->config->getValue("/OSEK/" . $task, "PRIORITY");
+            }
+         }
+         $ret = array();
+         for ($prio = $maxpriority; $prio >= 0; $prio--)
+         {
+            $ret[$prio] = $prio;
+         }
+      }
+      else
+      {
+         $ret = $this->config->priority2osekPriority($tasks);
+      }
+
+      return $ret;
+   }
+}
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+?>
@@ -129,6 +129,46 @@ foreach ($resources as $count=>$resource)
 }
 print "\n";
 
+/* Define the Semaphores */
+$semaphores = $this->config->getList("/OSEK","SEMAPHORE");
+
+foreach ($semaphores as $count=>$semaphore)
+{
+   print "/** \brief Definition of the semaphore $semaphore */\n";
+   print "#define " . $semaphore . " ((SemaphoreType)" . $count . ")\n";
+}
+print "\n";
+
+/* Define the Data */
+$datas = $this->config->getList("/OSEK","DATA");
+
+foreach ($datas as $count=>$data)
+{
+   print "/** \brief Definition of the data $data */\n";
+   print "#define " . $data . " ((DataType)" . $count . ")\n";
+}
+print "\n";
+
+/* Define the Pipelines */
+$pipelines = $this->config->getList("/OSEK","PIPELINE");
+
+foreach ($pipelines as $count=>$pipeline)
+{
+   print "/** \brief Definition of the pipeline $pipeline */\n";
+   print "#define " . $pipeline . " ((PipelineType)" . $count . ")\n";
+}
+print "\n";
+
+/* Define the log formats */
+$logformats = $this->config->getList("/OSEK","LOGFORMAT");
+
+foreach ($logformats as $count=>$logformat)
+{
+   print "/** \brief Definition of the log format $logformat */\n";
+   print "#define " . $logformat . " ((LogFormatType)" . $count . ")\n";
+}
+print "\n";
+
 /* Define the Alarms */
 $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
 
@@ -188,6 +228,49 @@ else
    print "#define OSEK_MEMMAP OSEK_DISABLE\n";
 }
 
+$isr1pending = $this->config->getValue("/OSEK/" . $os[0],"ISR1PENDING");
+print "/** \brief OSEK_ISR1_PENDING macro (OSEK_ENABLE ISR1 may post activations and\n ** events to the kernel over ActivateTaskFromISR1 and SetEventFromISR1) */\n";
+if ($isr1pending == "TRUE")
+{
+   print "#define OSEK_ISR1_PENDING OSEK_ENABLE\n";
+}
+elseif ( ($isr1pending == "FALSE") || ($isr1pending == "") )
+{
+   print "#define OSEK_ISR1_PENDING OSEK_DISABLE\n";
+}
+else
+{
+   $this->log->error("ISR1PENDING set to an invalid value \"$isr1pending\"");
+}
+
+$isrmonitor = $this->config->getValue("/OSEK/" . $os[0],"ISRMONITOR");
+print "/** \brief OSEK_ISR_MONITOR macro (OSEK_ENABLE the arrivals and the execution\n ** time of the ISR category 2 are measured, see GetIsrMonitor) */\n";
+if ($isrmonitor == "TRUE")
+{
+   print "#define OSEK_ISR_MONITOR OSEK_ENABLE\n\n";
+
+   /* the isrs category 2 are identified by their position in the
+    * configuration */
+   $count = 0;
+   foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+      {
+         print "/** \brief Definition of the ISR $int */\n";
+         print "#define ISRID_" . $int . " ((ISRType)" . $count . ")\n";
+         $count++;
+      }
+   }
+}
+elseif ( ($isrmonitor == "FALSE") || ($isrmonitor == "") )
+{
+   print "#define OSEK_ISR_MONITOR OSEK_DISABLE\n";
+}
+else
+{
+   $this->log->error("ISRMONITOR set to an invalid value \"$isrmonitor\"");
+}
+
 $osattr = $this->config->getValue("/OSEK/" . $os[0],"STATUS");
 if ($osattr == "EXTENDED") : ?>
 /** \brief Schedule this Task if higher priority Task are Active
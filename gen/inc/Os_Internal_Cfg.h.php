@@ -98,11 +98,17 @@ function remove_doubles($a)
 */
 
 $this->loadHelper("modules/rtos/gen/ginc/Multicore.php");
+$this->loadHelper("modules/rtos/gen/ginc/Priority.php");
 
 /* get tasks */
 $tasks = $this->helper->multicore->getLocalList("/OSEK", "TASK");
 
-$priority = $this->config->priority2osekPriority($tasks);
+/* priorities of the ready lists, see Priority.php */
+$priority = $this->helper->priority->getReadyPriorities($tasks);
+
+$os = $this->config->getList("/OSEK","OS");
+$dynamicpriority = ( $this->config->getValue("/OSEK/" . $os[0],"DYNAMICPRIORITY") == "TRUE" );
+$postbuild = ( $this->config->getValue("/OSEK/" . $os[0],"POSTBUILD") == "TRUE" );
 
 ?>
 /*==================[inclusions]=============================================*/
@@ -127,6 +133,18 @@ $priority = $this->config->priority2osekPriority($tasks);
 /** \brief ERROR_CHECKING_EXTENDED */
 #define ERROR_CHECKING_EXTENDED   2
 
+/** \brief Fixed priority scheduling (standard OSEK-OS behaviour) */
+#define OSEK_SCHEDULING_FIXED     1
+
+/** \brief Earliest deadline first scheduling */
+#define OSEK_SCHEDULING_EDF       2
+
+/** \brief Trace stops when the buffer is full */
+#define OSEK_TRACE_SNAPSHOT       1
+
+/** \brief Trace overwrites the oldest records when the buffer is full */
+#define OSEK_TRACE_RING           2
+
 /** \brief Count of task */
 <?php
 $taskscount = count($this->helper->multicore->getLocalList("/OSEK", "TASK"));
@@ -153,6 +171,136 @@ else
    print "#define RESOURCES_COUNT " . count($resources) . "\n\n";
 }
 
+/* Resources used by isr 2, taking them masks the interrupts up to the
+ * ceiling of the isrs which use them */
+$isrresources = 0;
+foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+{
+   foreach ($this->config->getList("/OSEK/" . $int, "RESOURCE") as $resource)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") != 2)
+      {
+         $this->log->error("ISR $int uses the resource $resource but is not of category 2");
+      }
+      elseif (!in_array($resource, $resources))
+      {
+         $this->log->error("ISR $int uses the not defined resource $resource");
+      }
+      else
+      {
+         $isrresources |= 1 << array_search($resource, $resources);
+      }
+   }
+}
+if ($isrresources != 0)
+{
+   print "/** \brief Resources are used by isr 2 */\n";
+   print "#define OSEK_ISR_RESOURCES OSEK_ENABLE\n\n";
+   print "/** \brief Mask of the resources used by isr 2 */\n";
+   print "#define OSEK_ISR_RESOURCES_MASK ((TaskResourcesType)0x" . sprintf("%08X", $isrresources) . "U)\n\n";
+}
+else
+{
+   print "#define OSEK_ISR_RESOURCES OSEK_DISABLE\n\n";
+}
+
+/* Internal resources, a task occupies them while it is running */
+$internalresources = 0;
+foreach ($resources as $count => $resource)
+{
+   if ($this->config->getValue("/OSEK/" . $resource, "RESOURCEPROPERTY") == "INTERNAL")
+   {
+      $internalresources |= 1 << $count;
+   }
+}
+if ($internalresources != 0)
+{
+   print "/** \brief Internal resources are used */\n";
+   print "#define OSEK_INTERNAL_RESOURCES OSEK_ENABLE\n\n";
+   print "/** \brief Mask of the internal resources */\n";
+   print "#define OSEK_INTERNAL_RESOURCES_MASK ((TaskResourcesType)0x" . sprintf("%08X", $internalresources) . "U)\n\n";
+}
+else
+{
+   print "#define OSEK_INTERNAL_RESOURCES OSEK_DISABLE\n\n";
+}
+
+/* Define the Semaphores */
+$semaphores = $this->config->getList("/OSEK","SEMAPHORE");
+if(count($semaphores)>254)
+{
+   $this->log->error("more than 254 semaphores were defined");
+}
+else
+{
+   print "/** \brief Count of semaphores */\n";
+   print "#define SEMAPHORES_COUNT " . count($semaphores) . "\n\n";
+}
+
+/* Define the Data */
+$datas = $this->config->getList("/OSEK","DATA");
+if(count($datas)>254)
+{
+   $this->log->error("more than 254 data were defined");
+}
+else
+{
+   print "/** \brief Count of data */\n";
+   print "#define DATA_COUNT " . count($datas) . "\n\n";
+}
+
+/* Define the Pipelines */
+$pipelines = $this->config->getList("/OSEK","PIPELINE");
+$stagescount = 0;
+$stagetasks = array();
+foreach ($pipelines as $pipeline)
+{
+   $stages = $this->config->getList("/OSEK/" . $pipeline, "STAGE");
+   if (count($stages) < 2)
+   {
+      $this->log->error("Pipeline $pipeline needs at least two STAGE tasks");
+   }
+   foreach ($stages as $stage)
+   {
+      /* the task of a stage identifies the stage, the double buffers require
+       * that the task is only activated once */
+      if (!in_array($stage, $tasks))
+      {
+         $this->log->error("STAGE $stage of pipeline $pipeline is not a task of this core");
+      }
+      elseif ($this->config->getValue("/OSEK/" . $stage, "ACTIVATION") != 1)
+      {
+         $this->log->error("STAGE $stage of pipeline $pipeline shall have ACTIVATION = 1");
+      }
+      if (in_array($stage, $stagetasks))
+      {
+         $this->log->error("Task $stage is used as STAGE more than once");
+      }
+      $stagetasks[] = $stage;
+   }
+   $stagescount += count($stages);
+}
+if(count($pipelines)>254)
+{
+   $this->log->error("more than 254 pipelines were defined");
+}
+elseif($stagescount>254)
+{
+   $this->log->error("more than 254 pipeline stages were defined");
+}
+else
+{
+   print "/** \brief Count of pipelines */\n";
+   print "#define PIPELINES_COUNT " . count($pipelines) . "\n\n";
+   print "/** \brief Count of stages of all pipelines */\n";
+   print "#define PIPELINE_STAGES_COUNT " . $stagescount . "\n\n";
+}
+
+/* Define the Partitions */
+$partitions = $this->config->getList("/OSEK","PARTITION");
+print "/** \brief Count of partitions */\n";
+print "#define PARTITIONS_COUNT " . count($partitions) . "\n\n";
+
 $os = $this->config->getList("/OSEK","OS");
 if (count($os)>1)
 {
@@ -318,6 +466,187 @@ if ($multicore == "TRUE")
    print "#define OSEK_MULTICORE OSEK_ENABLE\n";
 }
 
+/* TRACE */
+$tracemode = $this->config->getValue("/OSEK/" . $os[0],"TRACE");
+$trace = ( ($tracemode == "SNAPSHOT") || ($tracemode == "RING") );
+print "\n/** \brief OSEK_TRACE macro definition */\n";
+if ($trace)
+{
+   print "#define OSEK_TRACE OSEK_ENABLE\n\n";
+
+   print "/** \brief Trace mode */\n";
+   print "#define OSEK_TRACE_MODE OSEK_TRACE_$tracemode\n\n";
+
+   /* the records have a size up to 16 bytes, the buffer shall at least
+    * store some of them before and after the trigger */
+   $tracesize = $this->config->getValue("/OSEK/" . $os[0],"TRACESIZE");
+   if ($tracesize == "")
+   {
+      $this->log->warning("TRACESIZE isn't defined on the configuration, using 1024 as default");
+      $tracesize = 1024;
+   }
+   elseif ( ($tracesize < 64) || ($tracesize > 65535) )
+   {
+      $this->log->error("TRACESIZE shall be between 64 and 65535 bytes");
+   }
+   $tracepost = $this->config->getValue("/OSEK/" . $os[0],"TRACEPOSTTRIGGER");
+   if ($tracepost == "")
+   {
+      $tracepost = (int)($tracesize / 4);
+   }
+   elseif ( ($tracepost < 0) || ($tracepost > ($tracesize - 32)) )
+   {
+      $this->log->error("TRACEPOSTTRIGGER shall be between 0 and TRACESIZE - 32 bytes, the rest of the buffer keeps the records before the trigger");
+   }
+   print "/** \brief Size of the trace buffer in bytes */\n";
+   print "#define OSEK_TRACE_SIZE $tracesize\n\n";
+   print "/** \brief Bytes recorded after the trigger before the trace stops */\n";
+   print "#define OSEK_TRACE_POST_TRIGGER $tracepost\n\n";
+
+   /* the isr2 are identified in the trace by its position in the
+    * configuration */
+   $count = 0;
+   foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+      {
+         print "/** \brief Trace identifier of the ISR $int */\n";
+         print "#define OSEK_TRACE_ISR_$int $count\n";
+         $count++;
+      }
+   }
+   print "\n";
+}
+elseif ( ($tracemode == "") || ($tracemode == "NONE") )
+{
+   print "#define OSEK_TRACE OSEK_DISABLE\n\n";
+}
+else
+{
+   $this->log->error("TRACE set to an invalid value \"$tracemode\"");
+}
+
+/* LOG */
+$log = ( $this->config->getValue("/OSEK/" . $os[0],"LOG") == "TRUE" );
+$logformats = $this->config->getList("/OSEK","LOGFORMAT");
+print "/** \brief OSEK_LOG macro definition */\n";
+if ($log)
+{
+   print "#define OSEK_LOG OSEK_ENABLE\n\n";
+
+   /* the position of a record is taken with a mask of the free running
+    * head, the size shall be a power of two */
+   $logsize = $this->config->getValue("/OSEK/" . $os[0],"LOGSIZE");
+   if ($logsize == "")
+   {
+      $this->log->warning("LOGSIZE isn't defined on the configuration, using 64 as default");
+      $logsize = 64;
+   }
+   elseif ( ($logsize < 4) || ($logsize > 65536) || (($logsize & ($logsize - 1)) != 0) )
+   {
+      $this->log->error("LOGSIZE shall be a power of two between 4 and 65536 messages");
+   }
+   print "/** \brief Count of messages of the log */\n";
+   print "#define OSEK_LOG_SIZE $logsize\n\n";
+
+   if (count($logformats) == 0)
+   {
+      $this->log->error("LOG needs at least one LOGFORMAT");
+   }
+   elseif (count($logformats) > 65535)
+   {
+      $this->log->error("At most 65535 LOGFORMATs can be defined");
+   }
+   print "/** \brief Count of log formats */\n";
+   print "#define LOG_FORMATS_COUNT " . count($logformats) . "\n\n";
+}
+else
+{
+   print "#define OSEK_LOG OSEK_DISABLE\n\n";
+
+   if (count($logformats) > 0)
+   {
+      $this->log->warning("LOGFORMATs are only used if LOG is enabled");
+   }
+}
+
+/* HOT SECTIONS */
+$hotsections = ( $this->config->getValue("/OSEK/" . $os[0],"HOTSECTIONS") == "TRUE" );
+print "/** \brief OSEK_HOT_SECTIONS macro definition, the hot kernel code and\n ** data are placed in their own sections to be executed from RAM */\n";
+if ($hotsections)
+{
+   if ( ($this->definitions["ARCH"] != "cortexM4") &&
+        ($this->definitions["ARCH"] != "cortexM0") )
+   {
+      $this->log->warning("HOTSECTIONS is only supported on cortexM4 and cortexM0, the kernel is executed in place");
+   }
+   print "#define OSEK_HOT_SECTIONS OSEK_ENABLE\n\n";
+}
+else
+{
+   print "#define OSEK_HOT_SECTIONS OSEK_DISABLE\n\n";
+}
+
+/* ISR MONITOR */
+$isrmonitor = ($this->config->getValue("/OSEK/" . $os[0],"ISRMONITOR") == "TRUE");
+$isrstormhook = $this->config->getValue("/OSEK/" . $os[0],"ISRSTORMHOOK");
+print "/** \brief isr storm hook enable-disable macro */\n";
+if ($isrstormhook == "TRUE")
+{
+   print "#define HOOK_ISRSTORMHOOK OSEK_ENABLE\n\n";
+   if (!$isrmonitor)
+   {
+      $this->log->error("ISRSTORMHOOK needs ISRMONITOR to be enabled");
+   }
+}
+elseif ( ($isrstormhook == "FALSE") || ($isrstormhook == "") )
+{
+   print "#define HOOK_ISRSTORMHOOK OSEK_DISABLE\n\n";
+}
+else
+{
+   $this->log->error("ISRSTORMHOOK set to an invalid value \"$isrstormhook\"");
+}
+$isrmonitorcount = 0;
+foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+{
+   $mininterarrival = $this->config->getValue("/OSEK/" . $int,"MININTERARRIVAL");
+   if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+   {
+      $isrmonitorcount++;
+   }
+   if ( ($mininterarrival != "") && ($mininterarrival > 0) )
+   {
+      if (!$isrmonitor)
+      {
+         $this->log->error("ISR $int has a MININTERARRIVAL time but ISRMONITOR is not enabled");
+      }
+      elseif ($this->config->getValue("/OSEK/" . $int,"CATEGORY") != 2)
+      {
+         $this->log->error("ISR $int has a MININTERARRIVAL time but is not of category 2");
+      }
+      $backoff = $this->config->getValue("/OSEK/" . $int,"BACKOFF");
+      if ( ($backoff == "") || ($backoff <= 0) )
+      {
+         $this->log->error("ISR $int has a MININTERARRIVAL time and needs a BACKOFF time");
+      }
+      /* the times are compared in microseconds modulo 2^32 */
+      if ( ($mininterarrival > 4294967295) || ($backoff > 4294967295) )
+      {
+         $this->log->error("ISR $int has a MININTERARRIVAL or BACKOFF time greater than 4294967295 microseconds");
+      }
+   }
+}
+if ($isrmonitor && ($isrmonitorcount > 0))
+{
+   print "/** \brief Count of monitored isrs, all isrs of category 2 */\n";
+   print "#define ISR_MONITOR_COUNT $isrmonitorcount\n\n";
+}
+elseif ($isrmonitor)
+{
+   $this->log->error("ISRMONITOR is enabled but no ISR of category 2 is defined");
+}
+
 ?>
 
 #define READYLISTS_COUNT <?php echo count($priority); ?>
@@ -332,6 +661,9 @@ if ($multicore == "TRUE")
 #define SetError_ErrorHook()          \
    {                                  \
       ErrorHookRunning = (uint8)1U;   \
+<?php if ($trace) { ?>
+      TraceError();                   \
+<?php } ?>
       ErrorHook();                    \
       ErrorHookRunning = (uint8)0U;   \
    }
@@ -362,6 +694,9 @@ $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
 print "/** \brief ALARMS_COUNT define */\n";
 print "#define ALARMS_COUNT " . count($alarms) . "\n\n";
 
+print "/** \brief COUNTERS_COUNT define */\n";
+print "#define COUNTERS_COUNT " . count($counters) . "\n\n";
+
 $preemptive = false;
 foreach($tasks as $task)
 {
@@ -409,6 +744,355 @@ switch($schedulerpolicy)
       break;
 }
 
+/* SCHEDULING */
+$scheduling = $this->config->getValue("/OSEK/" . $os[0],"SCHEDULING");
+print "/** \brief Scheduling policy */\n";
+if ( ($scheduling == "") || ($scheduling == "FIXED") )
+{
+   print "#define OSEK_SCHEDULING OSEK_SCHEDULING_FIXED\n\n";
+}
+elseif ($scheduling == "EDF")
+{
+   print "#define OSEK_SCHEDULING OSEK_SCHEDULING_EDF\n\n";
+
+   $edfcounter = $this->config->getValue("/OSEK/" . $os[0],"EDFCOUNTER");
+   if (!in_array($edfcounter, $counters))
+   {
+      $this->log->error("EDFCOUNTER shall reference a counter if SCHEDULING is set to EDF");
+   }
+   elseif (count($alarms) == 0)
+   {
+      $this->log->error("SCHEDULING set to EDF needs at least one ALARM, the counter \"$edfcounter\" is only incremented if alarms are configured");
+   }
+   else
+   {
+      print "/** \brief Counter used as time base for the task deadlines */\n";
+      print "#define EDF_COUNTER OSEK_COUNTER_$edfcounter\n\n";
+   }
+
+   /* the priorities are used as preemption levels (SRP), they shall be
+    * ordered inversely to the relative deadlines */
+   foreach ($tasks as $task)
+   {
+      $deadline = $this->config->getValue("/OSEK/" . $task, "DEADLINE");
+      if ( ($deadline == "") || ($deadline <= 0) )
+      {
+         $this->log->error("Task \"$task\" has no valid DEADLINE, it is needed if SCHEDULING is set to EDF");
+      }
+      foreach ($tasks as $other)
+      {
+         $otherdeadline = $this->config->getValue("/OSEK/" . $other, "DEADLINE");
+         if ( ($deadline < $otherdeadline) &&
+              ($this->config->getValue("/OSEK/" . $task, "PRIORITY") <=
+               $this->config->getValue("/OSEK/" . $other, "PRIORITY")) )
+         {
+            $this->log->error("Task \"$task\" shall have a higher PRIORITY than task \"$other\" since its DEADLINE is shorter, the priorities are the preemption levels if SCHEDULING is set to EDF");
+         }
+      }
+   }
+}
+else
+{
+   $this->log->error("SCHEDULING set to an invalid value \"$scheduling\"");
+}
+
+print "/** \brief OSEK_DYNAMIC_PRIORITY macro definition */\n";
+if ($dynamicpriority)
+{
+   print "#define OSEK_DYNAMIC_PRIORITY OSEK_ENABLE\n\n";
+
+   if ($scheduling == "EDF")
+   {
+      $this->log->error("DYNAMICPRIORITY can not be used if SCHEDULING is set to EDF, the priorities are the preemption levels of the deadlines");
+   }
+
+   /* each activation of a task has one node of the ready lists, with a
+    * post build image the activations are only known at runtime. The last
+    * two values of TaskTotalType mark the end of a list and a free node */
+   if ($postbuild)
+   {
+      $readynodes = 254;
+   }
+   else
+   {
+      $readynodes = 0;
+      foreach ($tasks as $task)
+      {
+         $readynodes += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+      }
+      if ($readynodes > 254)
+      {
+         $this->log->error("DYNAMICPRIORITY supports up to 254 activations of all tasks, $readynodes are configured");
+      }
+   }
+   print "/** \brief Count of nodes of the ready lists */\n";
+   print "#define READYNODES_COUNT $readynodes\n\n";
+}
+else
+{
+   print "#define OSEK_DYNAMIC_PRIORITY OSEK_DISABLE\n\n";
+}
+
+/* BOOT IMAGE */
+$bootimage = ( $this->config->getValue("/OSEK/" . $os[0],"BOOTIMAGE") == "TRUE" );
+print "/** \brief OSEK_BOOT_IMAGE macro definition */\n";
+if ($bootimage)
+{
+   print "#define OSEK_BOOT_IMAGE OSEK_ENABLE\n\n";
+
+   if ($scheduling == "EDF")
+   {
+      $this->log->error("BOOTIMAGE can not be used if SCHEDULING is set to EDF");
+   }
+
+   /* all ready lists are placed in one array which is part of the boot
+    * image, each activation of a task needs one entry in the ready list of
+    * its priority */
+   $readylistssize = 0;
+   foreach ($tasks as $task)
+   {
+      $readylistssize += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+   }
+   print "/** \brief Count of entries of all ready lists */\n";
+   print "#define READYLISTS_SIZE $readylistssize\n\n";
+}
+else
+{
+   print "#define OSEK_BOOT_IMAGE OSEK_DISABLE\n\n";
+}
+
+/* POST BUILD */
+print "/** \brief OSEK_POST_BUILD macro definition */\n";
+if ($postbuild)
+{
+   print "#define OSEK_POST_BUILD OSEK_ENABLE\n\n";
+
+   /* the post build image is loaded from the file system of the host */
+   print "#if ( x86 != ARCH )\n";
+   print "#error POSTBUILD is only supported on the x86 architecture\n";
+   print "#endif\n\n";
+
+   if ($scheduling == "EDF")
+   {
+      $this->log->error("POSTBUILD can not be used if SCHEDULING is set to EDF");
+   }
+   if ($bootimage)
+   {
+      $this->log->error("POSTBUILD can not be used together with BOOTIMAGE, the boot image depends on the configuration");
+   }
+   if (count($partitions) > 0)
+   {
+      $this->log->error("POSTBUILD can not be used together with partitions");
+   }
+
+   /* the tables loaded from the post build image are not constant */
+   print "/** \brief Qualifier of the tables loaded from the post build image */\n";
+   print "#define OSEK_POST_BUILD_CONST\n\n";
+
+   /* the ready lists are placed in one array and are arranged at runtime
+    * depending on the priorities and activations of the image, each ready
+    * list may have up to 255 entries */
+   print "/** \brief Count of entries of all ready lists */\n";
+   print "#define READYLISTS_SIZE " . (count($priority) * 255) . "\n\n";
+
+   /* a symbol is generated for each task and alarm callback */
+   $symbols = count($tasks);
+   foreach ($alarms as $alarm)
+   {
+      if ($this->config->getValue("/OSEK/" . $alarm, "ACTION") == "ALARMCALLBACK")
+      {
+         $symbols++;
+      }
+   }
+   print "/** \brief Count of symbols of the post build image */\n";
+   print "#define POST_BUILD_SYMBOLS_COUNT $symbols\n\n";
+}
+else
+{
+   print "#define OSEK_POST_BUILD OSEK_DISABLE\n\n";
+
+   print "/** \brief Qualifier of the tables loaded from the post build image */\n";
+   print "#define OSEK_POST_BUILD_CONST const\n\n";
+}
+
+/* ROUND ROBIN */
+$timeslices = array();
+foreach ($tasks as $task)
+{
+   $timeslice = $this->config->getValue("/OSEK/" . $task, "TIMESLICE");
+   if ( ($timeslice != "") && ($timeslice > 0) )
+   {
+      $prio = $this->config->getValue("/OSEK/" . $task, "PRIORITY");
+      if ( isset($timeslices[$prio]) && ($timeslices[$prio] != $timeslice) )
+      {
+         $this->log->error("Task \"$task\" has a TIMESLICE different from the other tasks with priority $prio, the time slice is defined per priority");
+      }
+      $timeslices[$prio] = $timeslice;
+   }
+}
+print "/** \brief ROUND_ROBIN macro definition */\n";
+if (count($timeslices) > 0)
+{
+   print "#define ROUND_ROBIN OSEK_ENABLE\n\n";
+
+   if ($scheduling == "EDF")
+   {
+      $this->log->error("TIMESLICE can not be used if SCHEDULING is set to EDF");
+   }
+   if ($postbuild)
+   {
+      $this->log->error("TIMESLICE can not be used together with POSTBUILD, the time slices depend on the priorities");
+   }
+
+   $roundrobincounter = $this->config->getValue("/OSEK/" . $os[0],"ROUNDROBINCOUNTER");
+   if (!in_array($roundrobincounter, $counters))
+   {
+      $this->log->error("ROUNDROBINCOUNTER shall reference a counter if a TIMESLICE is configured");
+   }
+   elseif (count($alarms) == 0)
+   {
+      $this->log->error("TIMESLICE needs at least one ALARM, the counter \"$roundrobincounter\" is only incremented if alarms are configured");
+   }
+   else
+   {
+      print "/** \brief Counter used to measure the time slices */\n";
+      print "#define ROUND_ROBIN_COUNTER OSEK_COUNTER_$roundrobincounter\n\n";
+   }
+}
+else
+{
+   print "#define ROUND_ROBIN OSEK_DISABLE\n\n";
+}
+
+/* ACTIVATION ARGUMENTS */
+$activationarg = false;
+foreach ($tasks as $task)
+{
+   if ($this->config->getValue("/OSEK/" . $task, "ACTIVATIONARG") == "TRUE")
+   {
+      $activationarg = true;
+   }
+}
+print "/** \brief OSEK_ACTIVATION_ARG macro definition */\n";
+if ($activationarg)
+{
+   print "#define OSEK_ACTIVATION_ARG OSEK_ENABLE\n\n";
+
+   if ($postbuild)
+   {
+      $this->log->error("ACTIVATIONARG can not be used together with POSTBUILD, the argument queues depend on the activations");
+   }
+}
+else
+{
+   print "#define OSEK_ACTIVATION_ARG OSEK_DISABLE\n\n";
+}
+
+/* PARTITIONS */
+if (count($partitions) > 0)
+{
+   foreach ($partitions as $count => $partition)
+   {
+      print "#define OSEK_PARTITION_" . $partition . " " . $count . "\n";
+   }
+   print "\n";
+
+   if ($scheduling == "EDF")
+   {
+      $this->log->error("PARTITION objects can not be used if SCHEDULING is set to EDF");
+   }
+   if ( (count($priority) * (count($partitions) + 1)) > 255 )
+   {
+      $this->log->error("too many priorities and partitions, the ready lists of all partitions shall be less than 256");
+   }
+
+   $partitioncounter = $this->config->getValue("/OSEK/" . $os[0],"PARTITIONCOUNTER");
+   if ( (!in_array($partitioncounter, $counters)) ||
+        ($this->config->getValue("/OSEK/" . $partitioncounter, "TYPE") != "HARDWARE") )
+   {
+      $this->log->error("PARTITIONCOUNTER shall reference a HARDWARE counter if PARTITION objects are defined");
+   }
+   elseif (count($alarms) == 0)
+   {
+      $this->log->error("PARTITION objects need at least one ALARM, the counter \"$partitioncounter\" is only incremented if alarms are configured");
+   }
+   else
+   {
+      print "/** \brief Counter which drives the partition windows */\n";
+      print "#define PARTITION_COUNTER OSEK_COUNTER_$partitioncounter\n\n";
+   }
+
+   /* collect the windows of all partitions */
+   $majorframe = $this->config->getValue("/OSEK/" . $os[0],"MAJORFRAME");
+   $windows = array();
+   foreach ($partitions as $partition)
+   {
+      foreach ($this->config->getList("/OSEK/" . $partition, "WINDOW") as $window)
+      {
+         $offset = $this->config->getValue("/OSEK/" . $partition . "/" . $window, "OFFSET");
+         $duration = $this->config->getValue("/OSEK/" . $partition . "/" . $window, "DURATION");
+         if ( ($duration == "") || ($duration <= 0) || ($offset == "") || ($offset < 0) )
+         {
+            $this->log->error("Window \"$window\" of partition \"$partition\" needs a valid OFFSET and DURATION");
+         }
+         if (isset($windows[$offset]))
+         {
+            $this->log->error("Window \"$window\" of partition \"$partition\" overlaps another window");
+         }
+         $windows[$offset] = $offset + $duration;
+      }
+   }
+   ksort($windows);
+
+   /* the gaps between the windows are background windows */
+   $windowscount = 0;
+   $end = 0;
+   foreach ($windows as $offset => $windowend)
+   {
+      if ($offset < $end)
+      {
+         $this->log->error("The partition window starting at $offset overlaps the previous window");
+      }
+      elseif ($offset > $end)
+      {
+         $windowscount++;
+      }
+      $windowscount++;
+      $end = $windowend;
+   }
+   if ( ($majorframe == "") || ($end > $majorframe) )
+   {
+      $this->log->error("MAJORFRAME shall be defined and cover all partition windows");
+   }
+   elseif ($end < $majorframe)
+   {
+      $windowscount++;
+   }
+   print "/** \brief Count of windows in the major frame */\n";
+   print "#define PARTITION_WINDOWS_COUNT " . $windowscount . "\n\n";
+
+   /* a resource can only be shared by tasks of the same partition */
+   foreach ($resources as $resource)
+   {
+      $respartition = false;
+      foreach ($tasks as $task)
+      {
+         if (in_array($resource, $this->config->getList("/OSEK/" . $task, "RESOURCE")))
+         {
+            $taskpartition = $this->config->getValue("/OSEK/" . $task, "PARTITION");
+            if ($respartition === false)
+            {
+               $respartition = $taskpartition;
+            }
+            elseif ($respartition != $taskpartition)
+            {
+               $this->log->error("Resource \"$resource\" is used by tasks of different partitions");
+            }
+         }
+      }
+   }
+}
+
 
 ?>
 
@@ -419,6 +1103,9 @@ typedef struct {
    unsigned int Extended : 1;
    unsigned int Preemtive : 1;
    unsigned int State : 2;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   unsigned int Preempted : 1;
+#endif
 } TaskFlagsType;
 
 typedef uint8 TaskActivationsType;
@@ -437,6 +1124,15 @@ typedef uint8 TaskTotalType;
 
 typedef uint8 TaskCoreType;
 
+/** \brief Partition Type */
+typedef uint8 PartitionType;
+
+/** \brief Deadline Type
+ **
+ ** Absolute and relative deadlines in ticks of the EDF_COUNTER
+ **/
+typedef uint32 DeadlineType;
+
 /** \brief Task Constant type definition
  **
  ** This structure defines all constants and constant pointers
@@ -445,6 +1141,16 @@ typedef uint8 TaskCoreType;
  ** \param EntryPoint pointer to the entry point for this task
  ** \param Priority static priority of this task
  ** \param MaxActivations maximal activations for this task
+ ** \param RelativeDeadline deadline of each activation relative to its
+ **        activation time (only if OSEK_SCHEDULING is EDF)
+ ** \param DeadlineQueue deadlines of the queued activations of this task,
+ **        MaxActivations - 1 entries (only if OSEK_SCHEDULING is EDF)
+ ** \param Partition partition of this task or OSEK_PARTITION_BACKGROUND
+ ** \param ArgQueue arguments of the queued activations of this task,
+ **        MaxActivations entries or NULL if the task has no ACTIVATIONARG
+ **        (only if OSEK_ACTIVATION_ARG is enabled)
+ ** \param ReadyNode first of the MaxActivations entries of this task in
+ **        ReadyNodes (only if OSEK_DYNAMIC_PRIORITY is enabled)
  **/
 typedef struct {
    EntryPointType EntryPoint;
@@ -457,21 +1163,46 @@ typedef struct {
    TaskEventsType EventsMask;
    TaskResourcesType ResourcesMask;
    TaskCoreType TaskCore;
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+   DeadlineType RelativeDeadline;
+   DeadlineType * DeadlineQueue;
+#endif
+#if (PARTITIONS_COUNT != 0)
+   PartitionType Partition;
+#endif
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+   ActivationArgType * ArgQueue;
+#endif
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   TaskTotalType ReadyNode;
+#endif
 } TaskConstType;
 
 /** \brief Task Variable type definition
  **
  ** This structure defines all variables needed to manage a task
  **
+ ** \param BasePriority priority of this task set with SetTaskPriority,
+ **        without resources (only if OSEK_DYNAMIC_PRIORITY is enabled)
  ** \param ActualPriority actual priority of this task
  ** \param Activations actual activations on this task
  ** \param Flags flags variable of this task
  ** \param Events of this task
  ** \param Resource of this task
+ ** \param SemaphoreNext next task waiting for the same semaphore
+ ** \param Deadline absolute deadline of the oldest ready activation
+ ** \param HeapIndex position of this task in the deadline heap
+ ** \param ReadyEntries count of ready activations of this task, 0 if the
+ **        task is not in the deadline heap
+ ** \param DeadlineQueueStart first valid entry of the DeadlineQueue
+ ** \param ArgQueueStart entry of the ArgQueue of the running activation
  **/
 typedef struct {
 #if (STACK_CHECK_TYPE == STACK_CHECK_OVERFLOW_SIZE)
    StackSizeType StackMaxUsed;
+#endif
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   TaskPriorityType BasePriority;
 #endif
    TaskPriorityType ActualPriority;
    TaskActivationsType Activations;
@@ -479,6 +1210,18 @@ typedef struct {
    TaskEventsType Events;
    TaskEventsType EventsWait;
    TaskResourcesType Resources;
+#if (SEMAPHORES_COUNT != 0)
+   TaskType SemaphoreNext;
+#endif
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+   DeadlineType Deadline;
+   TaskTotalType HeapIndex;
+   TaskActivationsType ReadyEntries;
+   TaskActivationsType DeadlineQueueStart;
+#endif
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+   TaskActivationsType ArgQueueStart;
+#endif
 } TaskVariableType;
 
 /** \brief Auto Start Structure Type
@@ -495,22 +1238,58 @@ typedef struct {
  **
  ** \param ListLength Lenght of the Ready List
  ** \param TaskRef Reference to the Ready Array for this Priority
+ ** \param TimeSlice ticks of the ROUND_ROBIN_COUNTER a task of this priority
+ **        runs before it is rotated, 0 for no rotation
  **/
 typedef struct {
    TaskTotalType ListLength;
    TaskRefType TaskRef;
+#if (ROUND_ROBIN == OSEK_ENABLE)
+   TickType TimeSlice;
+#endif
 } ReadyConstType;
 
 /** \brief Ready List Variable Type
  **
- ** \param ListStart first valid componet on the list
+ ** \param ListStart first valid componet on the list, with
+ **        OSEK_DYNAMIC_PRIORITY the first entry of ReadyNodes
  ** \param ListCount count of valid components on this list
+ ** \param Slices count of time slices which ended on this list
+ ** \param Rotations count of time slice rotations on this list
+ ** \param ListEnd last entry of ReadyNodes of this list (only if
+ **        OSEK_DYNAMIC_PRIORITY is enabled)
  **/
 typedef struct {
    TaskTotalType ListStart;
    TaskTotalType ListCount;
+#if (ROUND_ROBIN == OSEK_ENABLE)
+   uint32 Slices;
+   uint32 Rotations;
+#endif
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   TaskTotalType ListEnd;
+#endif
 } ReadyVarType;
 
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+/** \brief Ready Node Type
+ **
+ ** With OSEK_DYNAMIC_PRIORITY the ready lists are linked lists of these
+ ** nodes, each task has one node for each activation. A task can be taken
+ ** out of a list without walking the list when its priority is changed.
+ **
+ ** \param Task task of this node
+ ** \param Next next node of the list, READY_NODE_END for the last one or
+ **        READY_NODE_FREE if the node is not in a list
+ ** \param Prev previous node of the list, READY_NODE_END for the first one
+ **/
+typedef struct {
+   TaskType Task;
+   TaskTotalType Next;
+   TaskTotalType Prev;
+} ReadyNodeType;
+#endif
+
 /** \brief Alarm State
  **
  ** This type defines the possibly states of one alarm which are:
@@ -587,6 +1366,200 @@ typedef struct {
    TickType Time;
 } CounterVarType;
 
+/** \brief Partition Window Type
+ **
+ ** \param Duration length of the window in ticks of the PARTITION_COUNTER
+ ** \param Partition partition executed in this window
+ **/
+typedef struct {
+   TickType Duration;
+   PartitionType Partition;
+} PartitionWindowType;
+
+/** \brief Isr Monitor Constant Type
+ **
+ ** \param MinInterArrival minimal time between two arrivals in microseconds,
+ **        0 if the source of the isr is never masked
+ ** \param MaxBurst arrivals closer than MinInterArrival allowed in a row
+ ** \param Backoff time the source is masked in microseconds
+ **/
+typedef struct {
+   uint32 MinInterArrival;
+   uint32 MaxBurst;
+   uint32 Backoff;
+} IsrMonitorConstType;
+
+/** \brief Isr Monitor Variable Type
+ **
+ ** LastArrival and BackoffStart are in microseconds, Start is in units of
+ ** the time source of the architecture.
+ **
+ ** \param Stats statistics read by GetIsrMonitor, in microseconds
+ ** \param LastArrival time of the last arrival
+ ** \param Start time of the start of the actual execution
+ ** \param Burst arrivals in a row closer than MinInterArrival
+ ** \param BackoffStart time when the source has been masked
+ ** \param Throttled TRUE while the source is masked
+ **/
+typedef struct {
+   IsrMonitorType Stats;
+   uint32 LastArrival;
+   uint32 Start;
+   uint32 Burst;
+   uint32 BackoffStart;
+   boolean Throttled;
+} IsrMonitorVarType;
+
+/** \brief Semaphore Count Type */
+typedef uint16 SemaphoreCountType;
+
+/** \brief Semaphore Constant Type
+ **
+ ** \param InitValue count of the semaphore after StartOS
+ ** \param MaxValue maximal count of the semaphore
+ **/
+typedef struct {
+   SemaphoreCountType InitValue;
+   SemaphoreCountType MaxValue;
+} SemaphoreConstType;
+
+/** \brief Semaphore Variable Type
+ **
+ ** \param Count actual count of the semaphore
+ ** \param WaitList first task waiting for this semaphore, the list
+ **        continues over TasksVar[].SemaphoreNext ordered by priority
+ **/
+typedef struct {
+   SemaphoreCountType Count;
+   TaskType WaitList;
+} SemaphoreVarType;
+
+/** \brief Data Constant Type
+ **
+ ** \param Buffer storage of the data, two copies of a SEQLOCK data or three
+ **        buffers of a TRIPLEBUFFER data, each one of Words words
+ ** \param Size size of the data in bytes
+ ** \param Words size of each copy in 32 bit words
+ ** \param Type DATA_SEQLOCK or DATA_TRIPLEBUFFER
+ **/
+typedef struct {
+   uint32 * Buffer;
+   uint16 Size;
+   uint16 Words;
+   uint8 Type;
+} DataConstType;
+
+/** \brief Data Variable Type
+ **
+ ** \param Sequence incremented twice by every write of a SEQLOCK data, its
+ **        lowest bit selects the copy to be read. Not zero after the first
+ **        write of a TRIPLEBUFFER data
+ ** \param Exchange spare buffer of a TRIPLEBUFFER data ored with DATA_FRESH
+ **        if it has not been read yet
+ ** \param WriteBuffer buffer owned by the writer of a TRIPLEBUFFER data
+ ** \param ReadBuffer buffer owned by the reader of a TRIPLEBUFFER data
+ **/
+typedef struct {
+   volatile uint32 Sequence;
+   volatile uint32 Exchange;
+   uint8 WriteBuffer;
+   uint8 ReadBuffer;
+} DataVarType;
+
+/** \brief Pipeline Constant Type
+ **
+ ** \param FirstStage index of the first stage in PipelineStagesConst, the
+ **        stages of a pipeline are consecutive
+ ** \param LastStage index of the last stage in PipelineStagesConst
+ ** \param Words size of each buffer in 32 bit words
+ **/
+typedef struct {
+   uint8 FirstStage;
+   uint8 LastStage;
+   uint16 Words;
+} PipelineConstType;
+
+/** \brief Pipeline Stage Constant Type
+ **
+ ** \param Task task implementing the stage
+ ** \param Buffer two buffers to the next stage, NULL for the last stage
+ **/
+typedef struct {
+   TaskType Task;
+   uint32 * Buffer;
+} PipelineStageConstType;
+
+/** \brief Pipeline Stage Variable Type
+ **
+ ** \param Stats statistics of the stage
+ ** \param Start start of the actual frame in this stage
+ ** \param FrameStart start of the actual frame in the first stage
+ ** \param LastEnd time of the last hand over
+ ** \param Fill buffer to the next stage filled by this stage
+ ** \param Ready buffer handed over to the next stage
+ ** \param Started TRUE if Start is valid, only used by the first stage
+ **/
+typedef struct {
+   PipelineStatsType Stats;
+   uint32 Start;
+   uint32 FrameStart;
+   uint32 LastEnd;
+   uint8 Fill;
+   uint8 Ready;
+   boolean Started;
+} PipelineStageVarType;
+
+<?php
+if ($bootimage)
+{
+   $appmodes = $this->config->getList("/OSEK", "APPMODE");
+   $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
+   $counters = $this->helper->multicore->getLocalList("/OSEK", "COUNTER");
+   $readylistscount = count($priority) * (count($partitions) > 0 ? count($partitions) + 1 : 1);
+
+   print "/** \brief Boot Image Type\n";
+   print " **\n";
+   print " ** Kernel variables after the start of an application mode, StartOS\n";
+   print " ** copies the image of the application mode to them.\n";
+   print " **\n";
+   print " ** \\param TasksVar initial TasksVar, the auto start tasks are ready\n";
+   print " ** \\param ReadyVar initial ReadyVar\n";
+   print " ** \\param ReadyLists initial entries of all ready lists\n";
+   if (count($alarms) > 0)
+   {
+      print " ** \\param AlarmsVar initial AlarmsVar, the auto start alarms are set\n";
+      print " ** \\param CountersVar initial CountersVar\n";
+   }
+   print " **/\n";
+   print "typedef struct {\n";
+   print "   TaskVariableType TasksVar[TASKS_COUNT];\n";
+   print "   ReadyVarType ReadyVar[$readylistscount];\n";
+   print "   TaskType ReadyLists[READYLISTS_SIZE];\n";
+   if (count($alarms) > 0)
+   {
+      print "   AlarmVarType AlarmsVar[" . count($alarms) . "];\n";
+      print "   CounterVarType CountersVar[" . count($counters) . "];\n";
+   }
+   print "} BootImageType;\n\n";
+}
+
+if ($postbuild)
+{
+   print "/** \brief Post Build Symbol Type\n";
+   print " **\n";
+   print " ** Assigns a name to a task entry point or to an alarm callback, the\n";
+   print " ** post build image references the functions by these names.\n";
+   print " **\n";
+   print " ** \\param Name name of the task or of the alarm callback\n";
+   print " ** \\param Function task entry point or alarm callback\n";
+   print " **/\n";
+   print "typedef struct {\n";
+   print "   const char * Name;\n";
+   print "   EntryPointType Function;\n";
+   print "} PostBuildSymbolType;\n\n";
+}
+?>
+
 /*==================[external data declaration]==============================*/
 /** \brief ErrorHookRunning
  **
@@ -601,7 +1574,7 @@ extern uint8 ErrorHookRunning;
  ** Contents all constant and constant pointer needed to
  ** manage all FreeOSEK tasks
  **/
-extern const TaskConstType TasksConst[TASKS_COUNT];
+extern OSEK_POST_BUILD_CONST TaskConstType TasksConst[TASKS_COUNT];
 
 /** \brief Remote Tasks Core Number
  **
@@ -621,6 +1594,29 @@ extern TaskVariableType TasksVar[TASKS_COUNT];
  **/
 extern uint8 ApplicationMode;
 
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+/** \brief Isr Monitor Constant Structure, one per isr 2 */
+extern const IsrMonitorConstType IsrMonitorConst[ISR_MONITOR_COUNT];
+
+/** \brief Isr Monitor Variable Structure, one per isr 2 */
+extern IsrMonitorVarType IsrMonitorVar[ISR_MONITOR_COUNT];
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+/** \brief Interrupt mask of the resources used by isr 2
+ **
+ ** Ceiling of the isr 2 using each resource, generated by the architecture
+ ** and used with RaiseInterruptMask_Arch(). Not used for other resources.
+ **/
+extern const InterruptMaskType ResourcesInterruptMask[RESOURCES_COUNT];
+
+/** \brief Interrupt mask saved when a resource used by isr 2 is taken */
+extern InterruptMaskType ResourcesSavedMask[RESOURCES_COUNT];
+
+/** \brief Resources taken by isr 2 */
+extern TaskResourcesType IsrResources;
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
+
 <?php
 $appmodes = $this->config->getList("/OSEK", "APPMODE");
 
@@ -653,16 +1649,24 @@ print "extern const AutoStartType AutoStart[" . count($appmodes) . "];\n\n";
 /* Resources Priorities */
 $resources = $this->config->getList("/OSEK","RESOURCE");
 print "/** \brief Resources Priorities */\n";
-print "extern const TaskPriorityType ResourcesPriority[" . count($resources) . "];\n\n";
+print "extern OSEK_POST_BUILD_CONST TaskPriorityType ResourcesPriority[" . count($resources) . "];\n\n";
 
+/* each partition and the background have their own ready lists */
+$readylists = count($priority) * (count($partitions) > 0 ? count($partitions) + 1 : 1);
 print "/** \brief Ready Const List */\n";
-print "extern const ReadyConstType ReadyConst[" . count($priority) .  "];\n\n";
+print "extern OSEK_POST_BUILD_CONST ReadyConstType ReadyConst[" . $readylists .  "];\n\n";
 print "/** \brief Ready Variable List */\n";
-print "extern ReadyVarType ReadyVar[" . count($priority) . "];\n\n";
+print "extern ReadyVarType ReadyVar[" . $readylists . "];\n\n";
+
+if ($dynamicpriority)
+{
+   print "/** \brief Nodes of the ready lists */\n";
+   print "extern ReadyNodeType ReadyNodes[READYNODES_COUNT];\n\n";
+}
 
 $resources = $this->config->getList("/OSEK","RESOURCE");
 print "/** \brief Resources Priorities */\n";
-print "extern const TaskPriorityType ResourcesPriority[" . count($resources) . "];\n\n";
+print "extern OSEK_POST_BUILD_CONST TaskPriorityType ResourcesPriority[" . count($resources) . "];\n\n";
 
 $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
 
@@ -670,10 +1674,10 @@ print "/** \brief Alarms Variable Structure */\n";
 print "extern AlarmVarType AlarmsVar[" . count($alarms) . "];\n\n";
 
 print "/** \brief Alarms Constant Structure */\n";
-print "extern const AlarmConstType AlarmsConst[" . count($alarms) . "];\n\n";
+print "extern OSEK_POST_BUILD_CONST AlarmConstType AlarmsConst[" . count($alarms) . "];\n\n";
 
 print "/** \brief Alarms Constant Structure */\n";
-print "extern const AutoStartAlarmType AutoStartAlarm[ALARM_AUTOSTART_COUNT];\n\n";
+print "extern OSEK_POST_BUILD_CONST AutoStartAlarmType AutoStartAlarm[ALARM_AUTOSTART_COUNT];\n\n";
 
 $counters = $this->helper->multicore->getLocalList("/OSEK", "COUNTER");
 
@@ -681,7 +1685,76 @@ print "/** \brief Counter Var Structure */\n";
 print "extern CounterVarType CountersVar[" . count($counters) . "];\n\n";
 
 print "/** \brief Counter Const Structure */\n";
-print "extern const CounterConstType CountersConst[" . count($counters) . "];\n";
+print "extern OSEK_POST_BUILD_CONST CounterConstType CountersConst[" . count($counters) . "];\n";
+
+print "\n/** \brief Counters Order\n";
+print " **\n";
+print " ** Counters in topological order of the cascades, a counter incremented by\n";
+print " ** an alarm with the action INCREMENT follows the counter of the alarm.\n";
+print " **/\n";
+print "extern OSEK_POST_BUILD_CONST CounterType CountersOrder[" . count($counters) . "];\n";
+
+if ($bootimage)
+{
+   print "\n/** \brief Boot image of each application mode */\n";
+   print "extern const BootImageType BootImage[" . count($appmodes) . "];\n";
+}
+
+if ($bootimage || $postbuild)
+{
+   print "\n/** \brief Entries of all ready lists */\n";
+   print "extern TaskType ReadyLists[READYLISTS_SIZE];\n";
+}
+
+if ($postbuild)
+{
+   print "\n/** \brief Symbols of the task entry points and alarm callbacks */\n";
+   print "extern const PostBuildSymbolType PostBuildSymbols[POST_BUILD_SYMBOLS_COUNT];\n";
+}
+
+$semaphores = $this->config->getList("/OSEK","SEMAPHORE");
+if (count($semaphores) > 0)
+{
+   print "\n/** \brief Semaphores Constant Structure */\n";
+   print "extern const SemaphoreConstType SemaphoresConst[" . count($semaphores) . "];\n\n";
+
+   print "/** \brief Semaphores Variable Structure */\n";
+   print "extern SemaphoreVarType SemaphoresVar[" . count($semaphores) . "];\n";
+}
+
+$datas = $this->config->getList("/OSEK","DATA");
+if (count($datas) > 0)
+{
+   print "\n/** \brief Data Constant Structure */\n";
+   print "extern const DataConstType DataConst[" . count($datas) . "];\n\n";
+
+   print "/** \brief Data Variable Structure */\n";
+   print "extern DataVarType DataVar[" . count($datas) . "];\n";
+}
+
+if (count($pipelines) > 0)
+{
+   print "\n/** \brief Pipelines Constant Structure */\n";
+   print "extern const PipelineConstType PipelinesConst[PIPELINES_COUNT];\n\n";
+
+   print "/** \brief Pipeline Stages Constant Structure */\n";
+   print "extern const PipelineStageConstType PipelineStagesConst[PIPELINE_STAGES_COUNT];\n\n";
+
+   print "/** \brief Pipeline Stages Variable Structure */\n";
+   print "extern PipelineStageVarType PipelineStagesVar[PIPELINE_STAGES_COUNT];\n";
+}
+
+if ($log)
+{
+   print "\n/** \brief Format strings of the log */\n";
+   print "extern const char * const LogFormats[LOG_FORMATS_COUNT];\n";
+}
+
+if (count($partitions) > 0)
+{
+   print "\n/** \brief Windows of the major frame */\n";
+   print "extern const PartitionWindowType PartitionWindows[PARTITION_WINDOWS_COUNT];\n";
+}
 
 ?>
 /*==================[external functions declaration]=========================*/
@@ -84,6 +84,20 @@ typedef TaskContextType* TaskContextRefType;
 
 
 
+/** \brief Context of a terminated task, its value is discarded */
+extern TaskContextType cortexM4NullContext;
+
+/** \brief Context of the running task, saved by the PendSV handler */
+extern TaskContextRefType cortexM4ActiveContextPtr;
+
+/** \brief Irq number of each isr 2, used by the isr monitor */
+extern const uint8 IsrMonitorSource[];
+
+/** \brief Context of the next task, restored by the PendSV handler */
+extern TaskContextRefType cortexM4NextContextPtr;
+
+
+
 /*==================[external functions declaration]=========================*/
 
 
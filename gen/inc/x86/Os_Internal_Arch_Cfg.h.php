@@ -84,6 +84,9 @@ typedef void (*InterruptType)(void);
 /*==================[external data declaration]==============================*/
 extern InterruptType InterruptTable[INTERRUPTS_COUNT];
 
+/** \brief Interrupt of each isr 2, used by the isr monitor */
+extern const InterruptFlagsType IsrMonitorSource[];
+
 /*==================[external functions declaration]=========================*/
 
 /** @} doxygen end group definition */
@@ -63,6 +63,7 @@
 <?php
 
 $this->loadHelper("modules/rtos/gen/ginc/Multicore.php");
+$this->loadHelper("modules/rtos/gen/ginc/Priority.php");
 
 /* get tasks */
 $tasks = $this->helper->multicore->getLocalList("/OSEK", "TASK");
@@ -103,11 +104,7 @@ foreach ($tasks as $task)
       $stack_size += 4;
    }
    print "/** \brief $task stack */\n";
-   print "#if ( x86 == ARCH )\n";
    print "uint8 StackTask" . $task . "[" . $stack_size ." + TASK_STACK_ADDITIONAL_SIZE];\n";
-   print "#else\n";
-   print "uint8 StackTask" . $task . "[" . $stack_size ."];\n";
-   print "#endif\n";
 }
 if ( ($osstack == "OVERFLOW") || ($osstack == "OVERFLOW_SIZE")) {
 ?>
@@ -126,21 +123,119 @@ foreach ($tasks as $task)
 }
 print "\n";
 
-$priority = $this->config->priority2osekPriority($tasks);
+/* priorities of the ready lists, see Priority.php */
+$priority = $this->helper->priority->getReadyPriorities($tasks);
+
+$dynamicpriority = ( $this->config->getValue("/OSEK/" . $os[0],"DYNAMICPRIORITY") == "TRUE" );
+$postbuild = ( $this->config->getValue("/OSEK/" . $os[0],"POSTBUILD") == "TRUE" );
+
+$bootimage = ( $this->config->getValue("/OSEK/" . $os[0],"BOOTIMAGE") == "TRUE" );
+
+/* each partition and the background have their own ready lists, without
+ * partitions all tasks are background tasks. With DYNAMICPRIORITY the ready
+ * lists are made of the ReadyNodes, the entries are only needed for the
+ * auto start tasks of the boot image */
+$partitions = $this->config->getList("/OSEK","PARTITION");
+$readypartitions = array_merge($partitions, array("BACKGROUND"));
+$readylists = array();
+$timeslices = array();
+foreach ($readypartitions as $readypartition)
+{
+   foreach ($priority as $prio)
+   {
+      $count = 0;
+      $timeslice = 0;
+      foreach ($tasks as $task)
+      {
+         $taskpartition = $this->config->getValue("/OSEK/" . $task, "PARTITION");
+         if ($taskpartition == "")
+         {
+            $taskpartition = "BACKGROUND";
+         }
+         if ( ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] == $prio) &&
+              ($taskpartition == $readypartition) )
+         {
+            $count += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+            if ($this->config->getValue("/OSEK/" . $task, "TIMESLICE") > 0)
+            {
+               $timeslice = $this->config->getValue("/OSEK/" . $task, "TIMESLICE");
+               $timeslices[] = $timeslice;
+            }
+         }
+      }
+      if ($dynamicpriority && !$bootimage)
+      {
+         $count = 0;
+      }
+      if (count($partitions) > 0)
+      {
+         $name = "ReadyList" . $readypartition . "_" . $prio;
+      }
+      else
+      {
+         $name = "ReadyList" . $prio;
+      }
+      $readylists[] = array($name, $count, $prio, $readypartition, $timeslice);
+   }
+}
+
+/* with a boot image or a post build image all ready lists are placed in one
+ * array, each one starts at an offset of it */
+if ($bootimage || $postbuild)
+{
+   $offset = 0;
+   foreach ($readylists as $index=>$readylist)
+   {
+      $readylists[$index][0] = "&ReadyLists[$offset]";
+      $offset += $readylist[1];
+   }
+   print "/** \brief Entries of all ready lists */\n";
+   print "OSEK_HOT_DATA TaskType ReadyLists[READYLISTS_SIZE];\n\n";
+}
 
 /* Ready List */
-foreach ($priority as $prio)
+foreach ($readylists as $readylist)
+{
+   if ( ($readylist[1] > 0) && (!$bootimage) )
+   {
+      if (count($partitions) > 0)
+      {
+         print "/** \brief Ready List for Priority " . $readylist[2] . " of the partition " . $readylist[3] . " */\n";
+      }
+      else
+      {
+         print "/** \brief Ready List for Priority " . $readylist[2] . " */\n";
+      }
+      print "OSEK_HOT_DATA TaskType " . $readylist[0] . "[" . $readylist[1] . "];\n\n";
+   }
+}
+
+$scheduling = $this->config->getValue("/OSEK/" . $os[0],"SCHEDULING");
+
+/* Deadline queues of the tasks with more than one activation */
+if ($scheduling == "EDF")
 {
-   print "/** \brief Ready List for Priority $prio */\n";
-   $count = 0;
    foreach ($tasks as $task)
    {
-      if ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] == $prio)
+      $activations = $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+      if ($activations > 1)
       {
-         $count += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+         print "/** \brief Deadlines of the queued activations of $task */\n";
+         print "DeadlineType DeadlineQueue" . $task . "[" . ($activations - 1) . "];\n\n";
       }
    }
-   print "TaskType ReadyList" . $prio . "[" . $count . "];\n\n";
+}
+
+/* Argument queues of the tasks activated with an argument */
+$activationarg = false;
+foreach ($tasks as $task)
+{
+   if ($this->config->getValue("/OSEK/" . $task, "ACTIVATIONARG") == "TRUE")
+   {
+      $activationarg = true;
+      print "/** \brief Arguments of the queued activations of $task */\n";
+      print "ActivationArgType ArgQueue" . $task . "[" . $this->config->getValue("/OSEK/" . $task, "ACTIVATION") . "];\n\n";
+   }
 }
 
 $counters = $this->helper->multicore->getLocalList("/OSEK", "COUNTER");
@@ -186,9 +281,13 @@ print " */\n";
 
 ?>
 
-const TaskConstType TasksConst[TASKS_COUNT] = {
+OSEK_POST_BUILD_CONST TaskConstType TasksConst[TASKS_COUNT] = {
 <?php
 
+/* the nodes of the ready lists are assigned to the tasks one after the
+ * other */
+$readynode = 0;
+
 /* create task const structure */
 foreach ($tasks as $count=>$task)
 {
@@ -246,11 +345,60 @@ foreach ($tasks as $count=>$task)
    print "      $rlist,/* resources mask */\n";
    if (isset($this->definitions["MCORE"]))
    {
-      print "      " . $this->config->getValue("/OSEK/" . $task, "CORE") . " /* core */\n";
+      $core = $this->config->getValue("/OSEK/" . $task, "CORE");
    }
    else
    {
-      print "      0 /* core */\n";
+      $core = 0;
+   }
+   $fields = array(array($core, "core"));
+   if ($scheduling == "EDF")
+   {
+      $fields[] = array($this->config->getValue("/OSEK/" . $task, "DEADLINE"), "relative deadline");
+      if ($this->config->getValue("/OSEK/" . $task, "ACTIVATION") > 1)
+      {
+         $fields[] = array("DeadlineQueue" . $task, "deadline queue");
+      }
+      else
+      {
+         $fields[] = array("NULL", "deadline queue");
+      }
+   }
+   if (count($partitions) > 0)
+   {
+      $taskpartition = $this->config->getValue("/OSEK/" . $task, "PARTITION");
+      if ($taskpartition == "")
+      {
+         $fields[] = array("OSEK_PARTITION_BACKGROUND", "partition");
+      }
+      elseif (in_array($taskpartition, $partitions))
+      {
+         $fields[] = array("OSEK_PARTITION_" . $taskpartition, "partition");
+      }
+      else
+      {
+         $this->log->error("Task \"$task\" references the undefined partition \"$taskpartition\"");
+      }
+   }
+   if ($activationarg)
+   {
+      if ($this->config->getValue("/OSEK/" . $task, "ACTIVATIONARG") == "TRUE")
+      {
+         $fields[] = array("ArgQueue" . $task, "argument queue");
+      }
+      else
+      {
+         $fields[] = array("NULL", "argument queue");
+      }
+   }
+   if ($dynamicpriority)
+   {
+      $fields[] = array($readynode, "first ready node");
+      $readynode += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
+   }
+   foreach ($fields as $fieldcount => $field)
+   {
+      print "      " . $field[0] . (($fieldcount < (count($fields) - 1)) ? ", " : " ") . "/* " . $field[1] . " */\n";
    }
    print "   }";
 }
@@ -273,7 +421,7 @@ for($i=0; $i<count($rtasks); $i++)
 };
 
 /** \brief TaskVar Array */
-TaskVariableType TasksVar[TASKS_COUNT];
+OSEK_HOT_DATA TaskVariableType TasksVar[TASKS_COUNT];
 
 <?php
 $appmodes = $this->config->getList("/OSEK", "APPMODE");
@@ -340,40 +488,106 @@ print "\n};\n";
 ?>
 
 <?php
-print "const ReadyConstType ReadyConst[" . count($priority) .  "] = { \n";
+print "OSEK_POST_BUILD_CONST ReadyConstType ReadyConst[" . count($readylists) .  "] = { \n";
 $c = 0;
-foreach ($priority as $prio)
+foreach ($readylists as $readylist)
 {
    if ($c++ != 0) print ",\n";
    print "   {\n";
-   $count = 0;
-   foreach ($tasks as $task)
+   print "      " . $readylist[1] . ", /* Length of this ready list */\n";
+   if ($readylist[1] > 0)
    {
-      if ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] == $prio)
-      {
-         $count += $this->config->getValue("/OSEK/" . $task, "ACTIVATION");
-      }
+      print "      " . $readylist[0];
+   }
+   else
+   {
+      print "      NULL";
+   }
+   if (count($timeslices) > 0)
+   {
+      print ", /* Pointer to the Ready List */\n";
+      print "      " . $readylist[4] . " /* time slice */\n";
+   }
+   else
+   {
+      print " /* Pointer to the Ready List */\n";
    }
-   print "      $count, /* Length of this ready list */\n";
-   print "      ReadyList" . $prio . " /* Pointer to the Ready List */\n";
    print "   }";
 }
 print "\n};\n\n";
 
 print "/** TODO replace next line with: \n";
-print " ** ReadyVarType ReadyVar[" . count($priority) . "] ; */\n";
-print "ReadyVarType ReadyVar[" . count($priority) . "];\n";
+print " ** ReadyVarType ReadyVar[" . count($readylists) . "] ; */\n";
+print "OSEK_HOT_DATA ReadyVarType ReadyVar[" . count($readylists) . "];\n";
+
+if ($dynamicpriority)
+{
+   print "\n/** \brief Nodes of the ready lists */\n";
+   print "OSEK_HOT_DATA ReadyNodeType ReadyNodes[READYNODES_COUNT];\n";
+}
+
+if (count($partitions) > 0)
+{
+   /* sort the windows of all partitions by their offset, the gaps are
+    * background windows */
+   $windows = array();
+   foreach ($partitions as $partition)
+   {
+      foreach ($this->config->getList("/OSEK/" . $partition, "WINDOW") as $window)
+      {
+         $offset = $this->config->getValue("/OSEK/" . $partition . "/" . $window, "OFFSET");
+         $duration = $this->config->getValue("/OSEK/" . $partition . "/" . $window, "DURATION");
+         $windows[$offset] = array($duration, "OSEK_PARTITION_" . $partition);
+      }
+   }
+   ksort($windows);
+
+   $majorframe = $this->config->getValue("/OSEK/" . $os[0],"MAJORFRAME");
+   $windowlist = array();
+   $end = 0;
+   foreach ($windows as $offset => $window)
+   {
+      if ($offset > $end)
+      {
+         $windowlist[] = array($offset - $end, "OSEK_PARTITION_BACKGROUND");
+      }
+      $windowlist[] = $window;
+      $end = $offset + $window[0];
+   }
+   if ($end < $majorframe)
+   {
+      $windowlist[] = array($majorframe - $end, "OSEK_PARTITION_BACKGROUND");
+   }
+
+   print "\n/** \brief Windows of the major frame */\n";
+   print "const PartitionWindowType PartitionWindows[PARTITION_WINDOWS_COUNT] = {\n";
+   foreach ($windowlist as $count => $window)
+   {
+      if ($count != 0) print ",\n";
+      print "   { " . $window[0] . ", " . $window[1] . " }";
+   }
+   print "\n};\n";
+}
 ?>
 
 <?php
 /* Resources Priorities */
 $resources = $this->config->getList("/OSEK","RESOURCE");
 print "/** \brief Resources Priorities */\n";
-print "const TaskPriorityType ResourcesPriority[" . count($resources) . "]  = {\n";
+print "OSEK_POST_BUILD_CONST TaskPriorityType ResourcesPriority[" . count($resources) . "]  = {\n";
 $c = 0;
 foreach ($resources as $resource)
 {
    $count = 0;
+   foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+   {
+      /* a task taking a resource used by an isr 2 runs with interrupts
+       * masked and shall not be preempted by any other task */
+      if (in_array($resource, $this->config->getList("/OSEK/" . $int, "RESOURCE")))
+      {
+         $count = "TASK_MAX_PRIORITY";
+      }
+   }
    foreach ($tasks as $task)
    {
       $resorucestask = $this->config->getList("/OSEK/" . $task, "RESOURCE");
@@ -381,7 +595,8 @@ foreach ($resources as $resource)
       {
          if ($rt == $resource)
          {
-            if ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] > $count)
+            if ( ($count !== "TASK_MAX_PRIORITY") &&
+                 ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] > $count) )
             {
                $count = $priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")];
             }
@@ -393,13 +608,66 @@ foreach ($resources as $resource)
 
 }
 print "\n};\n";
+?>
+
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+/** \brief Interrupt mask saved when a resource used by isr 2 is taken */
+InterruptMaskType ResourcesSavedMask[RESOURCES_COUNT];
+
+/** \brief Resources taken by isr 2 */
+TaskResourcesType IsrResources;
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
+
+<?php
+if ($this->config->getValue("/OSEK/" . $os[0],"ISRMONITOR") == "TRUE")
+{
+   print "/** \brief Isr Monitor Constant Structure */\n";
+   print "const IsrMonitorConstType IsrMonitorConst[ISR_MONITOR_COUNT] = {\n";
+   $first = true;
+   foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+      {
+         $mininterarrival = $this->config->getValue("/OSEK/" . $int,"MININTERARRIVAL");
+         $maxburst = $this->config->getValue("/OSEK/" . $int,"MAXBURST");
+         $backoff = $this->config->getValue("/OSEK/" . $int,"BACKOFF");
+         if ($mininterarrival == "")
+         {
+            $mininterarrival = 0;
+         }
+         if ( ($maxburst == "") || ($maxburst < 1) )
+         {
+            $maxburst = 1;
+         }
+         if ($backoff == "")
+         {
+            $backoff = 0;
+         }
+         if ($first == false)
+         {
+            print ",\n";
+         }
+         $first = false;
+         print "   /* ISR $int */\n";
+         print "   {\n";
+         print "      $mininterarrival, /* minimal inter arrival time */\n";
+         print "      $maxburst, /* max burst */\n";
+         print "      $backoff /* back off time */\n";
+         print "   }";
+      }
+   }
+   print "\n};\n\n";
+
+   print "/** \brief Isr Monitor Variable Structure */\n";
+   print "IsrMonitorVarType IsrMonitorVar[ISR_MONITOR_COUNT];\n\n";
+}
 
 $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
 print "/** TODO replace next line with: \n";
 print " ** AlarmVarType AlarmsVar[" . count($alarms) . "]; */\n";
-print "AlarmVarType AlarmsVar[" . count($alarms) . "];\n\n";
+print "OSEK_HOT_DATA AlarmVarType AlarmsVar[" . count($alarms) . "];\n\n";
 
-print "const AlarmConstType AlarmsConst[" . count($alarms) . "]  = {\n";
+print "OSEK_POST_BUILD_CONST AlarmConstType AlarmsConst[" . count($alarms) . "]  = {\n";
 
 foreach ($alarms as $count=>$alarm)
 {
@@ -448,7 +716,7 @@ foreach ($alarms as $count=>$alarm)
 }
 print "\n};\n\n";
 
-print "const AutoStartAlarmType AutoStartAlarm[ALARM_AUTOSTART_COUNT] = {\n";
+print "OSEK_POST_BUILD_CONST AutoStartAlarmType AutoStartAlarm[ALARM_AUTOSTART_COUNT] = {\n";
 $first = true;
 foreach ($alarms as $count=>$alarm)
 {
@@ -474,11 +742,11 @@ print "\n};\n\n";
 
 $counters = $this->helper->multicore->getLocalList("/OSEK", "COUNTER");
 
-print "CounterVarType CountersVar[" . count($counters) . "];\n\n";
+print "OSEK_HOT_DATA CounterVarType CountersVar[" . count($counters) . "];\n\n";
 
 $alarms = $this->config->getList("/OSEK","ALARM");
 
-print "const CounterConstType CountersConst[" . count($counters) . "] = {\n";
+print "OSEK_POST_BUILD_CONST CounterConstType CountersConst[" . count($counters) . "] = {\n";
 foreach ($counters as $count=>$counter)
 {
    if ($count!=0)
@@ -503,6 +771,404 @@ foreach ($counters as $count=>$counter)
 }
 print "\n};\n\n";
 
+/* order of the counters for the cascades, a counter incremented by an alarm
+ * follows the counter of the alarm */
+$alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
+$derived = array();
+$incoming = array();
+foreach ($counters as $counter)
+{
+   $derived[$counter] = array();
+   $incoming[$counter] = 0;
+}
+foreach ($alarms as $alarm)
+{
+   if ($this->config->getValue("/OSEK/" . $alarm, "ACTION") == "INCREMENT")
+   {
+      $from = $this->config->getValue("/OSEK/" . $alarm, "COUNTER");
+      $to = $this->config->getValue("/OSEK/" . $alarm . "/INCREMENT", "COUNTER");
+      if (isset($derived[$from]) && isset($incoming[$to]))
+      {
+         $derived[$from][] = $to;
+         $incoming[$to]++;
+      }
+   }
+}
+$order = array();
+foreach ($counters as $counter)
+{
+   if ($incoming[$counter] == 0)
+   {
+      $order[] = $counter;
+   }
+}
+for ($pos = 0; $pos < count($order); $pos++)
+{
+   foreach ($derived[$order[$pos]] as $to)
+   {
+      $incoming[$to]--;
+      if ($incoming[$to] == 0)
+      {
+         $order[] = $to;
+      }
+   }
+}
+if (count($order) != count($counters))
+{
+   $cyclic = array_diff($counters, $order);
+   $this->log->error("The counters \"" . implode("\", \"", $cyclic) . "\" increment each other with alarms with the action INCREMENT");
+}
+
+print "OSEK_POST_BUILD_CONST CounterType CountersOrder[" . count($counters) . "] = {\n";
+foreach ($order as $count=>$counter)
+{
+   if ($count!=0)
+   {
+      print ",\n";
+   }
+   print "   OSEK_COUNTER_" . $counter . " /* position $count */";
+}
+print "\n};\n\n";
+
+if ($bootimage)
+{
+   $appmodes = $this->config->getList("/OSEK", "APPMODE");
+   $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
+
+   print "/** \brief Boot image of each application mode\n";
+   print " **\n";
+   print " ** Contents the state of the kernel after activating the auto start tasks\n";
+   print " ** and setting the auto start alarms of each application mode.\n";
+   print " **/\n";
+   print "const BootImageType BootImage[" . count($appmodes) . "] = {\n";
+   foreach ($appmodes as $modecount=>$appmode)
+   {
+      /* auto start tasks of this application mode in the order of
+       * activation */
+      $tasksinmode = array();
+      foreach($tasks as $task)
+      {
+         $taskappmodes = $this->config->getList("/OSEK/" . $task, "APPMODE");
+         foreach ($taskappmodes as $taskappmode)
+         {
+            if ($taskappmode == $appmode)
+            {
+               $tasksinmode[] = $task;
+            }
+         }
+      }
+
+      if ($modecount != 0) print ",\n";
+      print "   /* Application Mode $appmode */\n";
+      print "   {\n";
+
+      /* TasksVar, the fields which are not listed are initialized to 0 */
+      print "      .TasksVar = {\n";
+      foreach ($tasks as $count=>$task)
+      {
+         $autostart = in_array($task, $tasksinmode);
+         $prio = $priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")];
+         if ($count != 0) print ",\n";
+         print "         /* Task $task */\n";
+         print "         {\n";
+         print "#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)\n";
+         print "            .BasePriority = $prio,\n";
+         print "#endif\n";
+         print "            .ActualPriority = " . ($autostart ? $prio : 0) . ",\n";
+         print "            .Activations = " . ($autostart ? 1 : 0) . ",\n";
+         print "            .Flags = { .State = " . ($autostart ? "TASK_ST_READY" : "TASK_ST_SUSPENDED") . " }\n";
+         print "#if (SEMAPHORES_COUNT != 0)\n";
+         print "            , .SemaphoreNext = INVALID_TASK\n";
+         print "#endif\n";
+         print "         }";
+      }
+      print "\n      },\n";
+
+      /* ReadyVar and ReadyLists, the auto start tasks are the first entries
+       * of their ready lists */
+      $readyentries = array();
+      $readyvars = array();
+      foreach ($readylists as $readylist)
+      {
+         $entries = array();
+         foreach ($tasksinmode as $task)
+         {
+            $taskpartition = $this->config->getValue("/OSEK/" . $task, "PARTITION");
+            if ($taskpartition == "")
+            {
+               $taskpartition = "BACKGROUND";
+            }
+            if ( ($priority[$this->config->getValue("/OSEK/" . $task, "PRIORITY")] == $readylist[2]) &&
+                 ($taskpartition == $readylist[3]) )
+            {
+               $entries[] = $task;
+            }
+         }
+         $readyvars[] = count($entries);
+         for ($loopi = 0; $loopi < $readylist[1]; $loopi++)
+         {
+            $readyentries[] = ( $loopi < count($entries) ? $entries[$loopi] : "INVALID_TASK" );
+         }
+      }
+      print "      .ReadyVar = {\n";
+      foreach ($readyvars as $count=>$readyvar)
+      {
+         if ($count != 0) print ",\n";
+         print "         { .ListStart = 0, .ListCount = $readyvar }";
+      }
+      print "\n      },\n";
+      print "      .ReadyLists = {\n";
+      print "         " . implode(",\n         ", $readyentries) . "\n";
+      print "      }";
+
+      /* AlarmsVar, the auto start alarms of this application mode are set
+       * like SetRelAlarm does */
+      if (count($alarms) > 0)
+      {
+         print ",\n      .AlarmsVar = {\n";
+         foreach ($alarms as $count=>$alarm)
+         {
+            if ($count != 0) print ",\n";
+            if ( ($this->config->getValue("/OSEK/" . $alarm, "AUTOSTART") == "TRUE") &&
+                 ($this->config->getValue("/OSEK/" . $alarm, "APPMODE") == $appmode) )
+            {
+               print "         { .AlarmState = 1, .AlarmTime = " . $this->config->getValue("/OSEK/" . $alarm, "ALARMTIME") . ", .AlarmCycleTime = " . $this->config->getValue("/OSEK/" . $alarm, "CYCLETIME") . " } /* Alarm $alarm */";
+            }
+            else
+            {
+               print "         { .AlarmState = 0 } /* Alarm $alarm */";
+            }
+         }
+         print "\n      }";
+      }
+
+      /* CountersVar, they are only used if alarms are configured */
+      if (count($alarms) > 0)
+      {
+         print ",\n      .CountersVar = {\n";
+         foreach ($counters as $count=>$counter)
+         {
+            if ($count != 0) print ",\n";
+            print "         { .Time = 0 } /* Counter $counter */";
+         }
+         print "\n      }";
+      }
+      print "\n   }";
+   }
+   print "\n};\n\n";
+}
+
+if ($postbuild)
+{
+   $alarms = $this->helper->multicore->getLocalList("/OSEK", "ALARM");
+
+   print "/** \brief Symbols of the task entry points and alarm callbacks */\n";
+   print "const PostBuildSymbolType PostBuildSymbols[POST_BUILD_SYMBOLS_COUNT] = {\n";
+   foreach ($tasks as $count=>$task)
+   {
+      if ($count != 0) print ",\n";
+      print "   { \"$task\", OSEK_TASK_$task }";
+   }
+   foreach ($alarms as $alarm)
+   {
+      if ($this->config->getValue("/OSEK/" . $alarm, "ACTION") == "ALARMCALLBACK")
+      {
+         $callback = $this->config->getValue("/OSEK/" . $alarm . "/ALARMCALLBACK", "ALARMCALLBACKNAME");
+         print ",\n   { \"$callback\", OSEK_CALLBACK_$callback }";
+      }
+   }
+   print "\n};\n\n";
+}
+
+$semaphores = $this->config->getList("/OSEK","SEMAPHORE");
+if (count($semaphores) > 0)
+{
+   print "const SemaphoreConstType SemaphoresConst[" . count($semaphores) . "] = {\n";
+   foreach ($semaphores as $count=>$semaphore)
+   {
+      if ($count!=0)
+      {
+         print ",\n";
+      }
+      $initvalue = $this->config->getValue("/OSEK/" . $semaphore,"INITVALUE");
+      if ($initvalue == "")
+      {
+         $this->log->warning("INITVALUE not defined for semaphore $semaphore, using 0 as default");
+         $initvalue = 0;
+      }
+      $maxvalue = $this->config->getValue("/OSEK/" . $semaphore,"MAXVALUE");
+      if ($maxvalue == "")
+      {
+         $maxvalue = 65535;
+      }
+      if ( ($maxvalue > 65535) || ($initvalue > $maxvalue) )
+      {
+         $this->log->error("Semaphore $semaphore has an invalid INITVALUE or MAXVALUE");
+      }
+      print "   /* Semaphore $semaphore */\n";
+      print "   {\n";
+      print "      $initvalue, /* init value */\n";
+      print "      $maxvalue /* max value */\n";
+      print "   }";
+   }
+   print "\n};\n\n";
+
+   print "SemaphoreVarType SemaphoresVar[" . count($semaphores) . "];\n\n";
+}
+
+$datas = $this->config->getList("/OSEK","DATA");
+if (count($datas) > 0)
+{
+   $datawords = array();
+   $datasizes = array();
+   $datatypes = array();
+   foreach ($datas as $data)
+   {
+      $size = $this->config->getValue("/OSEK/" . $data,"SIZE");
+      if ( ($size == "") || ($size < 1) || ($size > 65535) )
+      {
+         $this->log->error("Data $data has an invalid SIZE");
+         $size = 1;
+      }
+      $type = $this->config->getValue("/OSEK/" . $data,"TYPE");
+      if ($type == "")
+      {
+         $type = "SEQLOCK";
+      }
+      if ( ($type != "SEQLOCK") && ($type != "TRIPLEBUFFER") )
+      {
+         $this->log->error("Data $data has an invalid TYPE $type");
+         $type = "SEQLOCK";
+      }
+      $datasizes[$data] = $size;
+      $datawords[$data] = (int)(($size + 3) / 4);
+      $datatypes[$data] = $type;
+
+      $copies = ($type == "SEQLOCK") ? 2 : 3;
+      print "/** \brief Buffer of the data $data */\n";
+      print "uint32 DataBuffer" . $data . "[" . ($copies * $datawords[$data]) . "];\n\n";
+   }
+
+   print "const DataConstType DataConst[" . count($datas) . "] = {\n";
+   foreach ($datas as $count=>$data)
+   {
+      if ($count!=0)
+      {
+         print ",\n";
+      }
+      print "   /* Data $data */\n";
+      print "   {\n";
+      print "      DataBuffer$data, /* buffer */\n";
+      print "      " . $datasizes[$data] . ", /* size */\n";
+      print "      " . $datawords[$data] . ", /* words */\n";
+      print "      DATA_" . $datatypes[$data] . " /* type */\n";
+      print "   }";
+   }
+   print "\n};\n\n";
+
+   print "DataVarType DataVar[" . count($datas) . "];\n\n";
+}
+
+$pipelines = $this->config->getList("/OSEK","PIPELINE");
+if (count($pipelines) > 0)
+{
+   $pipelinewords = array();
+   foreach ($pipelines as $pipeline)
+   {
+      $size = $this->config->getValue("/OSEK/" . $pipeline,"SIZE");
+      if ( ($size == "") || ($size < 1) || ($size > 262140) )
+      {
+         $this->log->error("Pipeline $pipeline has an invalid SIZE");
+         $size = 4;
+      }
+      $pipelinewords[$pipeline] = (int)(($size + 3) / 4);
+
+      /* two buffers for each link between two stages */
+      $stages = $this->config->getList("/OSEK/" . $pipeline, "STAGE");
+      for ($stage = 0; $stage < count($stages) - 1; $stage++)
+      {
+         print "/** \brief Buffers from stage " . $stages[$stage] . " of the pipeline $pipeline */\n";
+         print "uint32 PipelineBuffer" . $pipeline . $stages[$stage] . "[" . (2 * $pipelinewords[$pipeline]) . "];\n\n";
+      }
+   }
+
+   print "const PipelineConstType PipelinesConst[PIPELINES_COUNT] = {\n";
+   $first = 0;
+   foreach ($pipelines as $count=>$pipeline)
+   {
+      if ($count!=0)
+      {
+         print ",\n";
+      }
+      $stages = $this->config->getList("/OSEK/" . $pipeline, "STAGE");
+      print "   /* Pipeline $pipeline */\n";
+      print "   {\n";
+      print "      $first, /* first stage */\n";
+      print "      " . ($first + count($stages) - 1) . ", /* last stage */\n";
+      print "      " . $pipelinewords[$pipeline] . " /* words */\n";
+      print "   }";
+      $first += count($stages);
+   }
+   print "\n};\n\n";
+
+   print "const PipelineStageConstType PipelineStagesConst[PIPELINE_STAGES_COUNT] = {\n";
+   $count = 0;
+   foreach ($pipelines as $pipeline)
+   {
+      $stages = $this->config->getList("/OSEK/" . $pipeline, "STAGE");
+      foreach ($stages as $stage=>$task)
+      {
+         if ($count!=0)
+         {
+            print ",\n";
+         }
+         print "   /* Pipeline $pipeline stage $task */\n";
+         print "   {\n";
+         print "      $task, /* task */\n";
+         if ($stage < count($stages) - 1)
+         {
+            print "      PipelineBuffer$pipeline$task /* buffers */\n";
+         }
+         else
+         {
+            print "      NULL /* buffers */\n";
+         }
+         print "   }";
+         $count++;
+      }
+   }
+   print "\n};\n\n";
+
+   print "PipelineStageVarType PipelineStagesVar[PIPELINE_STAGES_COUNT];\n\n";
+}
+
+$log = ( $this->config->getValue("/OSEK/" . $os[0],"LOG") == "TRUE" );
+$logformats = $this->config->getList("/OSEK","LOGFORMAT");
+if ($log && (count($logformats) > 0))
+{
+   print "/** \brief Format strings of the log */\n";
+   print "const char * const LogFormats[LOG_FORMATS_COUNT] = {\n";
+   foreach ($logformats as $count=>$logformat)
+   {
+      $format = trim($this->config->getValue("/OSEK/" . $logformat, "FORMAT"), "\"");
+
+      /* the arguments are raw 32 bits values, only integer conversions
+       * can be used */
+      $conversions = preg_match_all('/%[^%]/', str_replace("%%", "", $format), $matches);
+      $integers = preg_match_all('/%[-+ #0]*[0-9]*[diouxXc]/', str_replace("%%", "", $format), $matches);
+      if ($conversions > 3)
+      {
+         $this->log->error("LOGFORMAT $logformat has more than 3 arguments");
+      }
+      elseif ($conversions != $integers)
+      {
+         $this->log->error("LOGFORMAT $logformat shall only use integer conversions, the arguments are logged as 32 bits values");
+      }
+      print "   \"$format\"" . (($count < (count($logformats) - 1)) ? "," : "") . " /* $logformat */\n";
+   }
+   print "};\n\n";
+}
+
 ?>
 
 /** TODO replace the next line with
@@ -536,12 +1202,37 @@ void OSEK_ISR2_<?php print $int;?>(void)
    /* set isr 2 context */
    SetActualContext(CONTEXT_ISR2);
 
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+   /* count the arrival, a storm masks the source of the isr */
+   IsrMonitorEnter(ISRID_<?php print $int;?>);
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+   /* record the start of the isr 2 */
+   TraceAdd(TRACE_REC_ISR_ENTER, 0, OSEK_TRACE_ISR_<?php print $int;?>, 0);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
    /* trigger isr 2 */
    OSEK_ISR_<?php print $int;?>();
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+   /* perform the activations and events posted by ISR1 */
+   ProcessIsr1Pending();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+   /* measure the execution time of the isr */
+   IsrMonitorExit(ISRID_<?php print $int;?>);
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
    /* reset context */
    SetActualContext(actualContext);
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+   /* record the end of the isr 2, a task switch caused by the isr follows */
+   TraceAdd(TRACE_REC_ISR_EXIT, 0, OSEK_TRACE_ISR_<?php print $int;?>, 0);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
 #if (NON_PREEMPTIVE == OSEK_DISABLE)
    /* check if the actual task is preemptive */
    if ( ( CONTEXT_TASK == actualContext ) &&
@@ -529,7 +529,73 @@ for($i=0; $i < $MAX_INT_COUNT; $i++)
 ?>
 };
 
+<?php
+/* BASEPRI value of the ceiling of each resource used by isr 2, the most
+ * urgent priority (lowest value) of the isrs which use it */
+$resources = $this->config->getList("/OSEK","RESOURCE");
+$isrresources = false;
+$masks = array();
+foreach ($resources as $resource)
+{
+   $ceiling = -1;
+   foreach ($intnames as $int)
+   {
+      if (in_array($resource, $this->config->getList("/OSEK/" . $int, "RESOURCE")))
+      {
+         $prio = $this->config->getValue("/OSEK/" . $int,"PRIORITY");
+         if ($prio == 0)
+         {
+            $this->log->error("ISR $int uses the resource $resource and has priority 0, BASEPRI can not mask it");
+         }
+         if (($ceiling == -1) || ($prio < $ceiling))
+         {
+            $ceiling = $prio;
+         }
+         $isrresources = true;
+      }
+   }
+   $masks[] = $ceiling;
+}
+if ($isrresources)
+{
+   print "/** \brief Interrupt mask of the resources used by isr 2 */\n";
+   print "const InterruptMaskType ResourcesInterruptMask[RESOURCES_COUNT] =\n";
+   print "{\n";
+   foreach ($resources as $count => $resource)
+   {
+      if ($masks[$count] == -1)
+      {
+         print "   0U, /* resource $resource is not used by isrs */\n";
+      }
+      else
+      {
+         print "   (" . $masks[$count] . "U << (8U - __NVIC_PRIO_BITS)), /* resource $resource */\n";
+      }
+   }
+   print "};\n";
+}
+?>
 
+<?php
+/* irq of each isr 2 in the order of the ISRID_<name> */
+$os = $this->config->getList("/OSEK","OS");
+$isrmonitor = ($this->config->getValue("/OSEK/" . $os[0],"ISRMONITOR") == "TRUE");
+if ($isrmonitor)
+{
+   print "/** \brief Irq number of each isr 2, used by the isr monitor */\n";
+   print "const uint8 IsrMonitorSource[ISR_MONITOR_COUNT] =\n";
+   print "{\n";
+   foreach ($intnames as $int)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+      {
+         $source = $this->config->getValue("/OSEK/" . $int,"INTERRUPT");
+         print "   " . array_search($source, $intList) . ", /* ISR $int, $source */\n";
+      }
+   }
+   print "};\n\n";
+}
+?>
 /** \brief Interrupt enabling and priority setting function */
 void Enable_User_ISRs(void)
 {
@@ -561,7 +627,15 @@ foreach ($intnames as $int)
    $source = $this->config->getValue("/OSEK/" . $int,"INTERRUPT");
    $cat = $this->config->getValue("/OSEK/" . $int,"CATEGORY");
 
-   if($cat == 2)
+   if( ($cat == 2) && $isrmonitor )
+   {
+      print "   /* Enabling IRQ $source if it is not masked by the isr monitor */\n";
+      print "   if (IsrMonitorVar[ISRID_$int].Throttled == FALSE)\n";
+      print "   {\n";
+      print "      NVIC_EnableIRQ(" . array_search($source, $intList) . ");\n";
+      print "   }\n";
+   }
+   elseif($cat == 2)
    {
       print "   /* Enabling IRQ $source */\n";
       print "   NVIC_EnableIRQ(" . array_search($source, $intList) . ");\n";
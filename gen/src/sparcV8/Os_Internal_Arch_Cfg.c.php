@@ -199,6 +199,40 @@ for($i = 1; $i < $INTERRUPT_NAMES_LIST_LENGTH; $i ++) {
 }
 
 
+<?php
+/* processor interrupt level of the ceiling of each resource used by isr 2,
+ * the highest irq level of the isrs which use it */
+$resources_list = $this->config->getList ( "/OSEK", "RESOURCE" );
+$isr_resources_found = 0;
+$resources_masks = array ();
+
+foreach ( $resources_list as $resource_name ) {
+	$ceiling_level = 0;
+	
+	foreach ( $interrupt_handlers_list as $interrupt_handler ) {
+		if (in_array ( $resource_name, $this->config->getList ( "/OSEK/" . $interrupt_handler, "RESOURCE" ) )) {
+			$irq_level = array_search ( $this->config->getValue ( "/OSEK/" . $interrupt_handler, "INTERRUPT" ), $interrupt_names_list );
+			
+			if ($irq_level > $ceiling_level) {
+				$ceiling_level = $irq_level;
+			}
+			$isr_resources_found = 1;
+		}
+	}
+	$resources_masks [] = $ceiling_level;
+}
+
+if ($isr_resources_found == 1) {
+	print "/** \brief Interrupt mask of the resources used by isr 2 */\n";
+	print "const InterruptMaskType ResourcesInterruptMask[RESOURCES_COUNT] = {\n";
+	foreach ( $resources_list as $i => $resource_name ) {
+		print "   " . $resources_masks [$i] . ", /* resource $resource_name */\n";
+	}
+	print "};\n";
+}
+?>
+
+
 uint32 sparcGetHardwareTimersInUseMask(void)
 {
    uint32 timersInUseMask;
@@ -161,6 +161,79 @@ for ($loopi = 0; $loopi < 32; $loopi++)
 ?>
 };
 
+<?php
+/* interrupts to be masked by each resource used by isr 2 */
+$resources = $this->config->getList("/OSEK","RESOURCE");
+$isrresources = false;
+$masks = array();
+foreach ($resources as $resource)
+{
+   $mask = 0;
+   foreach ($intnames as $int)
+   {
+      if (in_array($resource, $this->config->getList("/OSEK/" . $int, "RESOURCE")))
+      {
+         switch($this->config->getValue("/OSEK/" . $int,"INTERRUPT"))
+         {
+            case "GPIO0":
+               $mask |= 1 << 8;
+               break;
+            case "GPIO1":
+               $mask |= 1 << 9;
+               break;
+            default:
+               /* the resource would not mask the isr */
+               $this->log->error("ISR $int uses resource $resource but its interrupt \"" . $this->config->getValue("/OSEK/" . $int,"INTERRUPT") . "\" can not be masked on this architecture");
+               break;
+         }
+         $isrresources = true;
+      }
+   }
+   $masks[] = $mask;
+}
+if ($isrresources)
+{
+   print "/** \brief Interrupt mask of the resources used by isr 2 */\n";
+   print "const InterruptMaskType ResourcesInterruptMask[RESOURCES_COUNT] =\n";
+   print "{\n";
+   foreach ($resources as $count => $resource)
+   {
+      print "   0x" . sprintf("%08X", $masks[$count]) . "U, /* resource $resource */\n";
+   }
+   print "};\n";
+}
+?>
+
+<?php
+/* interrupt of each isr 2 in the order of the ISRID_<name> */
+$os = $this->config->getList("/OSEK","OS");
+if ($this->config->getValue("/OSEK/" . $os[0],"ISRMONITOR") == "TRUE")
+{
+   print "/** \brief Interrupt of each isr 2, used by the isr monitor */\n";
+   print "const InterruptFlagsType IsrMonitorSource[ISR_MONITOR_COUNT] =\n";
+   print "{\n";
+   foreach ($this->helper->multicore->getLocalList("/OSEK", "ISR") as $int)
+   {
+      if ($this->config->getValue("/OSEK/" . $int,"CATEGORY") == 2)
+      {
+         switch($this->config->getValue("/OSEK/" . $int,"INTERRUPT"))
+         {
+            case "GPIO0":
+               print "   (1U << 8), /* ISR $int */\n";
+               break;
+            case "GPIO1":
+               print "   (1U << 9), /* ISR $int */\n";
+               break;
+            default:
+               print "   0U, /* ISR $int */\n";
+               break;
+         }
+      }
+   }
+   print "};\n";
+}
+?>
+
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
@@ -88,6 +88,175 @@
 /** \brief Task Maximal Priority */
 #define TASK_MAX_PRIORITY ((TaskPriorityType)~0)
 
+/** \brief Get the priority of a task without resources
+ **
+ ** The priority of the ready list of the task. It is only changed by
+ ** SetTaskPriority, without DYNAMICPRIORITY it is the configured priority.
+ **
+ ** \param[in] TaskID task
+ **/
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+#define GetBasePriority(TaskID) (TasksVar[(TaskID)].BasePriority)
+#else
+#define GetBasePriority(TaskID) (TasksConst[(TaskID)].StaticPriority)
+#endif
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+/** \brief End of a ready list, used for ReadyNodes Next and Prev */
+#define READY_NODE_END ((TaskTotalType)~1U)
+
+/** \brief Next of a ready node which is not in a ready list */
+#define READY_NODE_FREE ((TaskTotalType)~0U)
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+/** \brief Get the first task of a ready list
+ **
+ ** \param[in] List index of a not empty ready list
+ **/
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+#define GetFirstReady(List) (ReadyNodes[ReadyVar[(List)].ListStart].Task)
+#else
+#define GetFirstReady(List) (ReadyConst[(List)].TaskRef[ReadyVar[(List)].ListStart])
+#endif
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+/** \brief Count of 32 bits words needed to store one pending bit per task */
+#define ISR1_PENDING_WORDS ((TASKS_COUNT + 31U) / 32U)
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (DATA_COUNT != 0)
+/** \brief Data with two copies selected by the lowest bit of the sequence */
+#define DATA_SEQLOCK             1U
+
+/** \brief Data with three buffers exchanged between writer and reader */
+#define DATA_TRIPLEBUFFER        2U
+
+/** \brief Set in DataVar[].Exchange when the spare buffer has a new value */
+#define DATA_FRESH               0x80U
+
+/** \brief Data barrier
+ **
+ ** Keeps the compiler from moving the copy of a data across the accesses to
+ ** its sequence or exchange word. The readers and the writer run on the same
+ ** core, therefore no hardware barrier is needed.
+ **/
+#define DataBarrier()            __asm__ __volatile__ ("" : : : "memory")
+#endif /* #if (DATA_COUNT != 0) */
+
+#if (PIPELINES_COUNT != 0)
+/** \brief Returned by PipelineGetStage if the task is no stage */
+#define PIPELINE_INVALID_STAGE   ((uint8f)0xFFU)
+
+/** \brief Time of the pipeline statistics
+ **
+ ** The time source of the trace is used, without it no times are measured.
+ **/
+#ifdef TraceGetTime_Arch
+#define PipelineGetTime()        TraceGetTime_Arch()
+#else
+#define PipelineGetTime()        (0U)
+#endif
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+/** \brief Returns TRUE if the deadline d1 expires before the deadline d2
+ **
+ ** The deadlines are taken from the free running EdfTime, the difference is
+ ** evaluated signed to remain valid after an overflow of EdfTime.
+ **/
+#define DeadlineBefore(d1, d2) ( (sint32)((DeadlineType)(d1) - (DeadlineType)(d2)) < 0 )
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (PARTITIONS_COUNT != 0)
+/** \brief Background partition
+ **
+ ** Tasks without partition belong to the background, they are executed in the
+ ** windows of the background and in the idle time of the other partitions.
+ **/
+#define OSEK_PARTITION_BACKGROUND ((PartitionType)PARTITIONS_COUNT)
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+/** \brief Hot kernel code and data
+ **
+ ** The scheduler, the ready lists and the counters are placed in the sections
+ ** of the architecture to be executed from RAM, the architectures without
+ ** them execute the kernel in place. Only data without initial value may be
+ ** tagged as hot.
+ **/
+#if ( (OSEK_HOT_SECTIONS == OSEK_ENABLE) && defined(HotCode_Arch) )
+#define OSEK_HOT_CODE            HotCode_Arch
+#define OSEK_HOT_DATA            HotData_Arch
+#else
+#define OSEK_HOT_CODE
+#define OSEK_HOT_DATA
+#endif
+
+#if (OSEK_LOG == OSEK_ENABLE)
+/** \brief Magic of the log, "OSLG", the host detects the byte order with it */
+#define LOG_MAGIC                0x474C534FU
+
+/** \brief Version of the log format */
+#define LOG_VERSION              1U
+
+/** \brief Time of the log messages
+ **
+ ** The time source of the trace is used, without it the time is 0.
+ **/
+#ifdef TraceGetTime_Arch
+#define LogGetTime()             TraceGetTime_Arch()
+#else
+#define LogGetTime()             (0U)
+#endif
+
+/** \brief Log barrier
+ **
+ ** Keeps the compiler from moving the stores of a message across the store
+ ** of its sequence. The writers run on the same core as the reader, or on
+ ** the x86 port on a host which keeps the order of the stores, therefore no
+ ** hardware barrier is needed.
+ **/
+#define LogBarrier()             __asm__ __volatile__ ("" : : : "memory")
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+/** \brief Magic of the trace, the host detects the byte order with it */
+#define TRACE_MAGIC              0x4F534B54U
+
+/** \brief Version of the trace format */
+#define TRACE_VERSION            1U
+
+/** \brief Task switch record, merges the PostTask of the previous task and
+ **        the PreTask of the next one */
+#define TRACE_REC_SWITCH         1U
+/** \brief Task activation record */
+#define TRACE_REC_ACTIVATE       2U
+/** \brief Set event record */
+#define TRACE_REC_SETEVENT       3U
+/** \brief Alarm expiration record */
+#define TRACE_REC_ALARM          4U
+/** \brief Start of an ISR category 2 record */
+#define TRACE_REC_ISR_ENTER      5U
+/** \brief End of an ISR category 2 record */
+#define TRACE_REC_ISR_EXIT       6U
+/** \brief Error record, written before the ErrorHook is called */
+#define TRACE_REC_ERROR          7U
+/** \brief Deadline miss record */
+#define TRACE_REC_DEADLINE       8U
+/** \brief Trigger record */
+#define TRACE_REC_TRIGGER        9U
+/** \brief User event record */
+#define TRACE_REC_USER           10U
+
+/** \brief The previous task has been preempted */
+#define TRACE_SWITCH_PREEMPTED   0U
+/** \brief The previous task has been terminated */
+#define TRACE_SWITCH_TERMINATED  1U
+/** \brief The previous task waits for an event or a semaphore */
+#define TRACE_SWITCH_WAITING     2U
+/** \brief No task was running before */
+#define TRACE_SWITCH_IDLE        3U
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
 /** \brief Error Checking Standard */
 #define ERROR_CHECKING_STANDARD   1
 
@@ -96,11 +265,20 @@
 
 /** \brief Release Internal Resources
  **
- ** This interface release the internal resources of the actual task
+ ** This interface release the internal resources of the actual task, its
+ ** actual priority is lowered to the ceiling of the occupied resources
  **/
+#if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE)
+#define ReleaseInternalResources()                     \
+{                                                      \
+   TasksVar[GetRunningTask()].ActualPriority =         \
+      GetCeilingPriority(GetRunningTask(), FALSE);     \
+}
+#else
 #define ReleaseInternalResources()                     \
 {                                                      \
 }
+#endif
 
 /** \brief Invalid Context */
 #define CONTEXT_INVALID ((ContextType)0U)
@@ -192,6 +370,79 @@
  **/
 typedef uint8 ContextType;
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+/** \brief Trace type
+ **
+ ** The trace is kept in one variable so that a memory dump of it can be
+ ** decoded on the host. The records between Tail and Head are stored in
+ ** Buffer, each one is a header byte with the record type in the high nibble
+ ** and an auxiliary value in the low nibble, followed by the time elapsed
+ ** since the previous record and the ids of the record. The time and the ids
+ ** are encoded as variable length integers with 7 bits per byte, the most
+ ** significant bit is set if another byte follows.
+ **/
+typedef struct {
+   uint32 Magic;        /**< TRACE_MAGIC */
+   uint8 Version;       /**< TRACE_VERSION */
+   uint8 Mode;          /**< OSEK_TRACE_SNAPSHOT or OSEK_TRACE_RING */
+   uint8 State;         /**< TRACE_RECORDING, TRACE_TRIGGERED or TRACE_STOPPED */
+   uint8 Task;          /**< running task after the last record */
+   uint8 TailTask;      /**< running task before the first record */
+   uint8 Reserved[3];   /**< not used */
+   uint32 Frequency;    /**< frequency of the time source in Hz */
+   uint32 Size;         /**< size of Buffer */
+   uint32 Head;         /**< position of the next record */
+   uint32 Tail;         /**< position of the first record */
+   uint32 Used;         /**< bytes used by the records */
+   uint32 TailTime;     /**< time before the first record */
+   uint32 LastTime;     /**< time of the last record */
+   uint32 PostTrigger;  /**< bytes to be recorded until the trace stops */
+   uint8 Buffer[OSEK_TRACE_SIZE];
+} TraceType;
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+#if (OSEK_LOG == OSEK_ENABLE)
+/** \brief Log record type
+ **
+ ** \param Sequence position of the message in the log plus one, 0 while
+ **        the message is being written
+ ** \param Time time of the message
+ ** \param Format format of the message
+ ** \param Task running task
+ ** \param Context context which logged the message
+ ** \param Args arguments of the message
+ **/
+typedef struct {
+   volatile uint32 Sequence;
+   uint32 Time;
+   uint16 Format;
+   uint8 Task;
+   uint8 Context;
+   uint32 Args[LOG_ARGS];
+} LogRecordType;
+
+/** \brief Log type
+ **
+ ** The log is kept in one variable so that a memory dump of it can be
+ ** decoded on the host. Each writer reserves the next position by an atomic
+ ** increment of Head and stores the message in Records at the position
+ ** modulo OSEK_LOG_SIZE, the sequence of the record is written last. The
+ ** reader takes the records from Tail on, a record with a newer sequence
+ ** than the expected one has overwritten messages which were not read.
+ **/
+typedef struct {
+   uint32 Magic;              /**< LOG_MAGIC */
+   uint8 Version;             /**< LOG_VERSION */
+   uint8 Reserved[3];         /**< not used */
+   uint32 Frequency;          /**< frequency of the time source in Hz */
+   uint32 Size;               /**< count of records */
+   volatile uint32 Head;      /**< position of the next message */
+   uint32 Tail;               /**< position of the next message to be read */
+   uint32 Lost;               /**< messages lost since the last read one */
+   LogRecordType Records[OSEK_LOG_SIZE];
+} LogType;
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
 /*==================[external data declaration]==============================*/
 /** \brief ActualContext
  **
@@ -202,6 +453,66 @@ extern ContextType ActualContext;
 /** \brief RunningTask variable */
 extern TaskType RunningTask;
 
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+/** \brief Time base of the deadlines, incremented with the EDF_COUNTER */
+extern DeadlineType EdfTime;
+
+/** \brief Deadline heap
+ **
+ ** Binary min heap of the ready tasks ordered by their absolute deadline,
+ ** each ready task is stored once. EdfHeap[0] is the task with the earliest
+ ** deadline.
+ **/
+extern TaskType EdfHeap[TASKS_COUNT];
+
+/** \brief Count of tasks in the deadline heap */
+extern TaskTotalType EdfHeapCount;
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (PARTITIONS_COUNT != 0)
+/** \brief Partition of the actual window */
+extern PartitionType ActivePartition;
+
+/** \brief Index of the actual window in PartitionWindows */
+extern uint8 PartitionWindow;
+
+/** \brief Ticks of the PARTITION_COUNTER elapsed in the actual window */
+extern TickType PartitionWindowTime;
+
+/** \brief Set to TRUE when a window of another partition starts
+ **
+ ** The counter interrupt handler clears it and calls the scheduler, the
+ ** running task is rescheduled even if it is non preemptive.
+ **/
+extern boolean PartitionSwitched;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+/** \brief Task consuming the actual time slice */
+extern TaskType RoundRobinTask;
+
+/** \brief Ticks of the ROUND_ROBIN_COUNTER consumed of the actual time slice */
+extern TickType RoundRobinTime;
+
+/** \brief Set to TRUE when the time slice of the running task is over
+ **
+ ** The scheduler clears it and rotates the running task. Counter interrupt
+ ** handlers which do not call the scheduler after each tick call it when
+ ** this flag is set.
+ **/
+extern boolean RoundRobinExpired;
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+/** \brief Trace of the kernel events */
+extern TraceType Osek_Trace;
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+#if (OSEK_LOG == OSEK_ENABLE)
+/** \brief Log of the messages of the application */
+extern LogType Osek_Log;
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
 /*==================[external functions declaration]=========================*/
 /** \brief Architecture Dependnece Start Os function
  **
@@ -212,7 +523,9 @@ extern void StartOs_Arch(void);
 /** \brief Get Next Task
  **
  ** This functions returns the next task that shall be executed
- ** in order of the task activation and priority
+ ** in order of the task activation and priority. If OSEK_SCHEDULING is EDF
+ ** the ready task with the earliest deadline and a preemption level higher
+ ** than the ceiling of the occupied resources is returned.
  **
  ** \return next task to be executed
  **/
@@ -237,6 +550,68 @@ void RemoveTask(TaskType TaskID);
  **/
 extern void AddReady(TaskType TaskID);
 
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+/** \brief Init the nodes of the ready lists
+ **
+ ** Frees all ReadyNodes and links the entries which are in the ready lists
+ ** of the boot image. Shall be called by StartOS before any task is
+ ** activated.
+ **/
+extern void InitReadyNodes(void);
+
+/** \brief Move a task to the ready list of another priority
+ **
+ ** Sets the base priority of the task and moves its entries from the ready
+ ** list of the old priority to the one of the new priority. The entry of a
+ ** running or preempted task is placed at the begin of the new ready list,
+ ** the other entries at the end. The actual priority is not modified.
+ **
+ ** The entries are unlinked from the ReadyNodes of the task, the time does
+ ** not depend on the count of ready tasks.
+ **
+ ** \param[in] TaskID task to be moved
+ ** \param[in] Priority new base priority of the task
+ **/
+extern void MoveReady(TaskType TaskID, TaskPriorityType Priority);
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+#if (RESOURCES_COUNT != 0)
+/** \brief Get the priority of a task raised to its resources
+ **
+ ** Returns the base priority of the task raised to the ceilings of the
+ ** resources occupied by it and, if requested, of its internal resources.
+ **
+ ** \param[in] TaskID task
+ ** \param[in] Internal TRUE if the task occupies its internal resources,
+ **            this is the case while the task is running
+ ** \return actual priority of the task
+ **/
+extern TaskPriorityType GetCeilingPriority(TaskType TaskID, boolean Internal);
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+/** \brief Consume the time slice of the running task
+ **
+ ** This function is called when the ROUND_ROBIN_COUNTER is incremented. If
+ ** the time slice of the priority of the running task is over and other
+ ** tasks with the same priority are ready, RoundRobinExpired is set. The
+ ** ready list is not changed, the running task keeps being the first one.
+ **
+ ** \param[in] Increment ticks elapsed since the last call
+ **/
+extern void RoundRobinTick(TickType Increment);
+
+/** \brief Rotate the running task after its time slice
+ **
+ ** This function is called by the scheduler before the next task is
+ ** selected. If RoundRobinExpired is set and the running task can still be
+ ** rotated, it is moved to the end of its ready list. The scheduler
+ ** switches to the next task of the list immediately afterwards, so the
+ ** running task is always the first one of its ready list.
+ **/
+extern void RoundRobinRotate(void);
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
 /** \brief No Handled Interrupt Handler
  **
  ** This is an interrupt handler used for all not handled interrupts.
@@ -248,14 +623,229 @@ extern void OSEK_ISR_NoHandler(void);
  ** This service is called to increment a specific counter an Increment amount
  ** of times.
  **
+ ** The counters incremented by alarms with the action INCREMENT are
+ ** incremented after the counter, each of them once with the sum of its
+ ** increments. The actions of the expired alarms are executed after the
+ ** cascade, an action or an interrupt may call this function again.
+ **
+ ** The pending increments and the expirations are kept in static data of
+ ** the kernel, the stack used by a call does not depend on COUNTERS_COUNT
+ ** nor on ALARMS_COUNT. A nested call needs the stack of one more call of
+ ** this function and of the action of the alarm, this has to be considered
+ ** in the stack of the tasks and of the ISRs which increment counters.
+ **
  ** \param[in] CounterID id of the counter to be incremented
  ** \param[in] Increment amount of times to increment the counter
- ** \return after how many increments of the CounterID the function has to be
- ** called. If the function is called again later as should with a grater
- ** increment some events may be executed together.
+ ** \return after how many increments of the CounterID the next alarm of the
+ ** counter or of the counters incremented by its alarms expires, -1 if no
+ ** alarm is running. If the function is called again later as should with a
+ ** grater increment some events may be executed together.
  **/
 extern CounterIncrementType IncrementCounter(CounterType CounterID, CounterIncrementType Increment);
 
+/** \brief Increment Alarm
+ **
+ ** Decrements the time of a running alarm and counts its expirations. The
+ ** action of the alarm is not executed, IncrementCounter executes it after
+ ** the cascade.
+ **
+ ** \param[in] AlarmID id of the alarm
+ ** \param[in] Increment increments of the counter of the alarm
+ ** \param[out] Expirations count of expirations of the alarm
+ ** \return increments of the counter until the next expiration of the alarm,
+ ** -1 if the alarm doesn't expire again
+ **/
+extern AlarmIncrementType IncrementAlarm(AlarmType AlarmID, AlarmIncrementType Increment, AlarmIncrementType * Expirations);
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+/** \brief Process the activations and events posted by ISR category 1
+ **
+ ** This function takes all activations and events posted with
+ ** ActivateTaskFromISR1 and SetEventFromISR1 and performs them. It is called
+ ** by the scheduler, at the end of each ISR category 2 and on each tick of
+ ** the hardware counters, it does not reschedule.
+ **/
+extern void ProcessIsr1Pending(void);
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (DATA_COUNT != 0)
+/** \brief Copy the value of a data
+ **
+ ** Copies Size bytes from Src to Dst. The buffers of the data are word
+ ** aligned, if the value of the user is aligned too and Size is a multiple
+ ** of 4 the copy is performed in words.
+ **
+ ** \param[out] Dst destination of the copy
+ ** \param[in] Src source of the copy
+ ** \param[in] Size count of bytes to be copied
+ **/
+extern void DataCopy(void * Dst, const void * Src, uint16f Size);
+#endif /* #if (DATA_COUNT != 0) */
+
+/** \brief Activate a task
+ **
+ ** Performs the activation of ActivateTask and ActivateTaskWithArg once the
+ ** parameters have been checked: the task is set ready or its activation is
+ ** queued, the activation is traced and, if called from a preemptive task,
+ ** the scheduler is called. The error hook is not called.
+ **
+ ** \param[in] TaskID task to be activated, shall be a local task
+ ** \param[in] Arg argument of the activation, only used if the task has an
+ **            argument queue
+ ** \return E_OK or E_OS_LIMIT
+ **/
+extern StatusType ActivateTaskInternal(TaskType TaskID, ActivationArgType Arg);
+
+/** \brief Terminate the running task and activate a succeeding one
+ **
+ ** Performs the task switch of ChainTask once the parameters and the
+ ** activations of TaskID have been checked. Shall be called between
+ ** IntSecure_Start and IntSecure_End, the caller calls the scheduler
+ ** afterwards.
+ **
+ ** \param[in] TaskID succeeding task, shall be a local task
+ **/
+extern void ChainTaskInternal(TaskType TaskID);
+
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+/** \brief Queue the argument of a new activation
+ **
+ ** Stores the argument behind the arguments of the queued activations of
+ ** the task, nothing is done if the task has no argument queue. Shall be
+ ** called with the interrupts disabled before the activations of the task
+ ** are incremented.
+ **
+ ** \param[in] TaskID task to be activated
+ ** \param[in] Arg argument of the activation
+ **/
+extern void PutActivationArg(TaskType TaskID, ActivationArgType Arg);
+
+/** \brief Drop the argument of the terminated activation
+ **
+ ** Shall be called with the interrupts disabled when the activations of the
+ ** terminating task are decremented.
+ **
+ ** \param[in] TaskID terminating task
+ **/
+extern void NextActivationArg(TaskType TaskID);
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+
+#if (PIPELINES_COUNT != 0)
+/** \brief Initialize the pipelines
+ **
+ ** Called from StartOS. Resets the buffers and the statistics of all
+ ** stages.
+ **/
+extern void PipelineInit(void);
+
+/** \brief Get the stage of a task
+ **
+ ** \param[in] PipelineID pipeline to be searched
+ ** \param[in] TaskID task of the stage
+ ** \return index of the stage in PipelineStagesConst or
+ **         PIPELINE_INVALID_STAGE if the task is no stage of the pipeline
+ **/
+extern uint8f PipelineGetStage(PipelineType PipelineID, TaskType TaskID);
+
+/** \brief Update the statistics of a stage at its hand over
+ **
+ ** \param[in] Stage index of the stage in PipelineStagesConst
+ ** \param[in] Now time of the hand over, PipelineGetTime units
+ **/
+extern void PipelineUpdateStats(uint8f Stage, uint32 Now);
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+/** \brief Initialize the isr monitor
+ **
+ ** Called from StartOS. Clears the statistics and unmasks the sources
+ ** masked before a RestartOS.
+ **/
+extern void IsrMonitorInit(void);
+
+/** \brief Count the arrival of an isr 2
+ **
+ ** Called at the start of the isr 2 wrapper. Masks the source of the isr
+ ** and calls the IsrStormHook if more than MaxBurst arrivals followed each
+ ** other closer than MinInterArrival.
+ **
+ ** \param[in] IsrID arriving isr
+ **/
+extern void IsrMonitorEnter(ISRType IsrID);
+
+/** \brief Measure the execution time of an isr 2
+ **
+ ** Called at the end of the isr 2 wrapper before the rescheduling.
+ **
+ ** \param[in] IsrID finishing isr
+ **/
+extern void IsrMonitorExit(ISRType IsrID);
+
+/** \brief Unmask the sources whose back off time is over
+ **
+ ** Called periodically by the architecture from the interrupt of the
+ ** hardware counter. It also advances the time of the monitor in
+ ** microseconds, so the period shall be shorter than the wrap around of
+ ** the time source of the architecture.
+ **/
+extern void IsrMonitorTick(void);
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+#if (OSEK_LOG == OSEK_ENABLE)
+/** \brief Initialize the log
+ **
+ ** Sets the header of the log, the messages recorded before are kept.
+ **/
+extern void LogInit(void);
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+/** \brief Initialize the trace
+ **
+ ** Called from StartOS. A stopped trace is kept to be read after a
+ ** RestartOS, in other case the trace is started empty.
+ **/
+extern void TraceInit(void);
+
+/** \brief Add a record to the trace
+ **
+ ** \param[in] Type record type, TRACE_REC_*
+ ** \param[in] Aux auxiliary value of the header, from 0 to 15
+ ** \param[in] Id first id of the record, ignored for records without ids
+ ** \param[in] Value second id of the record, only used by the SETEVENT,
+ **                  ERROR and USER records
+ **/
+extern void TraceAdd(uint8 Type, uint8 Aux, uint32 Id, uint32 Value);
+
+/** \brief Record a task switch
+ **
+ ** Called before the next task gets the cpu. The previous task is the task
+ ** of the last switch, the reason is taken from its state.
+ **
+ ** \param[in] NextTask task getting the cpu, INVALID_TASK if the cpu gets
+ **                     idle
+ ** \param[in] Preempted TRUE if the previous task has been preempted
+ **/
+extern void TraceSwitch(TaskType NextTask, boolean Preempted);
+
+/** \brief Record an error and trigger the trace
+ **
+ ** Called before the ErrorHook with the service id and the return value.
+ **/
+extern void TraceError(void);
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+/** \brief Check the deadline of a terminating task
+ **
+ ** Records a deadline miss and triggers the trace if the task terminates
+ ** after its deadline.
+ **
+ ** \param[in] TaskID terminating task
+ **/
+extern void TraceCheckDeadline(TaskType TaskID);
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
 
 #if (STACK_CHECK_TYPE != STACK_CHECK_OFF)
 /** \brief Checks if the current task had a stack overflow
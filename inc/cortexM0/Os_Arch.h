@@ -99,6 +99,61 @@
  **/
 #define SuspendOSInterrupts_Arch()        { Disable_ISR2_Arch(); }
 
+/** \brief Atomic Or Arch
+ **
+ ** Sets the bits of mask in the word pointed by addr, this macro may be used
+ ** from ISR category 1. The Cortex-M0 has no exclusive access instructions,
+ ** therefore PRIMASK is raised only for the read modify write.
+ **/
+#define AtomicOr_Arch(addr, mask)                                      \
+   {                                                                   \
+      uint32 primask;                                                  \
+      __asm volatile("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory"); \
+      *(addr) |= (mask);                                               \
+      __asm volatile("msr primask, %0" : : "r" (primask) : "memory");  \
+   }
+
+/** \brief Atomic Take Arch
+ **
+ ** Reads the word pointed by addr into ret and clears it.
+ **/
+#define AtomicTake_Arch(addr, ret)                                     \
+   {                                                                   \
+      uint32 primask;                                                  \
+      __asm volatile("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory"); \
+      (ret) = *(addr);                                                 \
+      *(addr) = 0U;                                                    \
+      __asm volatile("msr primask, %0" : : "r" (primask) : "memory");  \
+   }
+
+/** \brief Atomic Exchange Arch
+ **
+ ** Stores value in the word pointed by addr and returns the previous
+ ** content in ret.
+ **/
+#define AtomicExchange_Arch(addr, value, ret)                          \
+   {                                                                   \
+      uint32 primask;                                                  \
+      __asm volatile("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory"); \
+      (ret) = *(addr);                                                 \
+      *(addr) = (value);                                               \
+      __asm volatile("msr primask, %0" : : "r" (primask) : "memory");  \
+   }
+
+/** \brief Atomic Add Arch
+ **
+ ** Adds value to the word pointed by addr and returns the previous content
+ ** in ret.
+ **/
+#define AtomicAdd_Arch(addr, value, ret)                               \
+   {                                                                   \
+      uint32 primask;                                                  \
+      __asm volatile("mrs %0, primask\n\tcpsid i" : "=r" (primask) : : "memory"); \
+      (ret) = *(addr);                                                 \
+      *(addr) = (ret) + (value);                                       \
+      __asm volatile("msr primask, %0" : : "r" (primask) : "memory");  \
+   }
+
 
 
 /*==================[typedef]================================================*/
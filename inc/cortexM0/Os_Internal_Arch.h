@@ -268,6 +268,46 @@
 #define ShutdownOs_Arch()
 
 
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. The main stack pointer is
+ ** loaded with its reset value, the first word of the vector table at
+ ** address 0 (Cortex-M0 has no VTOR register), thread mode is set to use
+ ** the main stack and StartOS is called. The stack of the calling task is
+ ** abandoned.
+ **/
+#define RestartOs_Arch()                                                      \
+{                                                                             \
+   __asm__ __volatile__ (                                                     \
+      /* The vector table is located at address 0 */                          \
+      "movs r0,#0                                            \n\t"            \
+      /* Load MSP with the initial stack pointer */                           \
+      "ldr r0,[r0]                                           \n\t"            \
+      "msr msp,r0                                            \n\t"            \
+      /* Thread mode uses MSP */                                              \
+      "mrs r0,control                                        \n\t"            \
+      "movs r1,#2                                            \n\t"            \
+      "bics r0,r1                                            \n\t"            \
+      "msr control,r0                                        \n\t"            \
+      "isb                                                   \n\t"            \
+      : : : "r0", "r1"                                                        \
+   );                                                                         \
+   StartOS(ApplicationMode);                                                  \
+}
+
+/** \brief Section of the hot kernel code
+ **
+ ** The code is linked to RAM and copied from flash by StartOs_Arch, see the
+ ** linker script fragment Os_Hot.ld generated with HOTSECTIONS. Without the
+ ** fragment the section is linked with the rest of the code in flash.
+ **/
+#define HotCode_Arch __attribute__ ((section(".text.osek_hot")))
+
+/** \brief Section of the hot kernel data, cleared by StartOs_Arch */
+#define HotData_Arch __attribute__ ((section(".bss.osek_hot")))
+
+
 
 /*==================[typedef]================================================*/
 
@@ -101,6 +101,49 @@
  **/
 #define SuspendOSInterrupts_Arch()     { Disable_ISR2_Arch(); }
 
+/** \brief Atomic Or Arch
+ **
+ ** Sets the bits of mask in the word pointed by addr with a single atomic
+ ** read modify write, this macro may be used from ISR category 1.
+ **/
+#define AtomicOr_Arch(addr, mask)                        \
+   {                                                     \
+      (void)__sync_fetch_and_or((addr), (mask));         \
+   }
+
+/** \brief Atomic Take Arch
+ **
+ ** Reads the word pointed by addr into ret and clears it with a single
+ ** atomic exchange.
+ **/
+#define AtomicTake_Arch(addr, ret)                       \
+   {                                                     \
+      (ret) = __sync_lock_test_and_set((addr), 0U);      \
+      __sync_synchronize();                              \
+   }
+
+/** \brief Atomic Exchange Arch
+ **
+ ** Stores value in the word pointed by addr and returns the previous
+ ** content in ret with a single atomic exchange.
+ **/
+#define AtomicExchange_Arch(addr, value, ret)            \
+   {                                                     \
+      __sync_synchronize();                              \
+      (ret) = __sync_lock_test_and_set((addr), (value)); \
+      __sync_synchronize();                              \
+   }
+
+/** \brief Atomic Add Arch
+ **
+ ** Adds value to the word pointed by addr and returns the previous content
+ ** in ret with a single atomic read modify write.
+ **/
+#define AtomicAdd_Arch(addr, value, ret)                 \
+   {                                                     \
+      (ret) = __sync_fetch_and_add((addr), (value));     \
+   }
+
 
 
 /*==================[typedef]================================================*/
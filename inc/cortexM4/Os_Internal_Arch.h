@@ -69,8 +69,11 @@
  **
  ** TASK_STACK_ADDITIONAL_SIZE bytes of extra stack are reserver for each task
  ** running on the system.
+ **
+ ** On this architecture the initial context of the task stays reserved at the
+ ** top of its stack, see cortexM4TaskStart().
  **/
-#define TASK_STACK_ADDITIONAL_SIZE      0
+#define TASK_STACK_ADDITIONAL_SIZE      72
 
 
 /** \brief Osek_Internal_Arch_Cpu.h inclusion needed macro
@@ -131,13 +134,24 @@
 
 
 /** \brief CortexM4 implementation of the CallTask() OS interface.
+ **
+ ** The context of the next task is computed here, the PendSV handler only
+ ** saves and restores the registers.
  **/
-#define CallTask(currentTask, nextTask)         { InvokePendSV(); }
+#define CallTask(currentTask, nextTask)                                       \
+{                                                                             \
+   cortexM4NextContextPtr = TasksConst[(nextTask)].TaskContext;               \
+   InvokePendSV();                                                            \
+}
 
 
 /** \brief CortexM4 implementation of the JmpTask() OS interface.
  **/
-#define JmpTask(nextTask)                       { InvokePendSV(); }
+#define JmpTask(nextTask)                                                     \
+{                                                                             \
+   cortexM4NextContextPtr = TasksConst[(nextTask)].TaskContext;               \
+   InvokePendSV();                                                            \
+}
 
 
 
@@ -156,11 +170,27 @@
 
 
 
+/** \brief Initial stack pointer of a task
+ **
+ ** The initial context built by cortexM4ResetTaskContext() takes the 17
+ ** words at the top of the stack of the task.
+ **/
+#define cortexM4InitialStackTop(taskId)                                       \
+   (&((uint32 *)TasksConst[(taskId)].StackPtr)[(TasksConst[(taskId)].StackSize / 4) - 17])
+
+
 /** \brief CortexM4 implementation of the SenEntryPoint() OS interface.
+ **
+ ** The initial context at the top of the stack is kept valid by
+ ** cortexM4TaskStart(), so only the stack pointer of the task is reset. The
+ ** task may still be running on its stack, the context saved by the next
+ ** PendSV is therefore redirected to cortexM4NullContext and discarded.
  **/
-#define SetEntryPoint(taskId)          \
-{                                      \
-   cortexM4TerminatedTaskID = taskId;  \
+#define SetEntryPoint(taskId)                                                 \
+{                                                                             \
+   TasksConst[(taskId)].TaskContext->stackTopPointer =                        \
+      cortexM4InitialStackTop(taskId);                                        \
+   cortexM4ActiveContextPtr = &cortexM4NullContext;                           \
 }
 
 
@@ -233,16 +263,131 @@
 #define ShutdownOs_Arch()
 
 
+/** \brief Section of the hot kernel code
+ **
+ ** The code is linked to RAM and copied from flash by StartOs_Arch, see the
+ ** linker script fragment Os_Hot.ld generated with HOTSECTIONS. Without the
+ ** fragment the section is linked with the rest of the code in flash.
+ **/
+#define HotCode_Arch __attribute__ ((section(".text.osek_hot")))
+
+/** \brief Section of the hot kernel data, cleared by StartOs_Arch */
+#define HotData_Arch __attribute__ ((section(".bss.osek_hot")))
+
+/** \brief Initialize the time source of the trace
+ **
+ ** The cycle counter of the data watchpoint and trace unit (DWT) is used as
+ ** time source, the trace unit is enabled over the DEMCR register.
+ **/
+#define TraceInit_Arch()                                                      \
+{                                                                             \
+   /* DEMCR.TRCENA */                                                         \
+   (*(volatile uint32 *)0xE000EDFCU) |= 0x01000000U;                          \
+   /* DWT_CYCCNT */                                                           \
+   (*(volatile uint32 *)0xE0001004U) = 0U;                                    \
+   /* DWT_CTRL.CYCCNTENA */                                                   \
+   (*(volatile uint32 *)0xE0001000U) |= 0x00000001U;                          \
+}
 
-/*==================[typedef]================================================*/
+/** \brief Get the time of the trace in TraceGetFrequency_Arch() units */
+#define TraceGetTime_Arch() (*(volatile uint32 *)0xE0001004U)
 
+/** \brief Frequency of the time of the trace in Hz */
+#define TraceGetFrequency_Arch() (SystemCoreClock)
+
+/** \brief Mask the source of an isr during an interrupt storm
+ **
+ ** Writes the NVIC interrupt clear enable register of the irq, an arrival
+ ** while masked stays pending in the NVIC.
+ **
+ ** \param[in] isr isr to be masked, ISRID_<name>
+ **/
+#define IsrMonitorDisable_Arch(isr)                                           \
+{                                                                             \
+   /* NVIC_ICERn */                                                           \
+   ((volatile uint32 *)0xE000E180U)[IsrMonitorSource[isr] >> 5] =             \
+      (uint32)1U << (IsrMonitorSource[isr] & 0x1FU);                          \
+   __asm__ __volatile__ ("dsb \n\t isb" : : : "memory" );                     \
+}
+
+/** \brief Unmask the source of an isr masked by IsrMonitorDisable_Arch
+ **
+ ** \param[in] isr isr to be unmasked, ISRID_<name>
+ **/
+#define IsrMonitorEnable_Arch(isr)                                            \
+{                                                                             \
+   /* NVIC_ISERn */                                                           \
+   ((volatile uint32 *)0xE000E100U)[IsrMonitorSource[isr] >> 5] =             \
+      (uint32)1U << (IsrMonitorSource[isr] & 0x1FU);                          \
+}
+
+/** \brief Raise the interrupt mask for a resource shared with isrs
+ **
+ ** BASEPRI_MAX only raises the masking priority, a resource nested into a
+ ** resource with a higher ceiling keeps the higher one.
+ **
+ ** \param[in] mask BASEPRI value of the ceiling of the resource
+ ** \param[out] previous BASEPRI value before this call
+ **/
+#define RaiseInterruptMask_Arch(mask, previous)                               \
+{                                                                             \
+   __asm__ __volatile__ ("mrs %0, basepri" : "=r" (previous) );               \
+   __asm__ __volatile__ ("msr basepri_max, %0" : : "r" (mask) : "memory" );   \
+}
+
+/** \brief Restore the interrupt mask saved by RaiseInterruptMask_Arch
+ **
+ ** \param[in] previous BASEPRI value to be restored
+ **/
+#define RestoreInterruptMask_Arch(previous)                                   \
+{                                                                             \
+   __asm__ __volatile__ ("msr basepri, %0" : : "r" (previous) : "memory" );   \
+}
+
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. The main stack pointer is
+ ** loaded with its reset value, the first word of the vector table, thread
+ ** mode is set to use the main stack and StartOS is called. The stack of the
+ ** calling task is abandoned. BASEPRI is set back to 0, a resource shared
+ ** with isrs may have been held by the calling task.
+ **/
+#define RestartOs_Arch()                                                      \
+{                                                                             \
+   __asm__ __volatile__ (                                                     \
+      /* Read the vector table offset register (VTOR) */                      \
+      "ldr r0,=0xE000ED08                                    \n\t"            \
+      "ldr r0,[r0]                                           \n\t"            \
+      /* Load MSP with the initial stack pointer */                           \
+      "ldr r0,[r0]                                           \n\t"            \
+      "msr msp,r0                                            \n\t"            \
+      /* Thread mode uses MSP */                                              \
+      "mrs r0,control                                        \n\t"            \
+      "bic r0,r0,#2                                          \n\t"            \
+      "msr control,r0                                        \n\t"            \
+      "isb                                                   \n\t"            \
+      /* No resource shared with isrs is held */                              \
+      "movs r0,#0                                            \n\t"            \
+      "msr basepri,r0                                        \n\t"            \
+      : : : "r0", "memory"                                                    \
+   );                                                                         \
+   StartOS(ApplicationMode);                                                  \
+}
+
+
+
+/*==================[typedef]================================================*/
+/** \brief Interrupt mask type used by the resources shared with isrs */
+typedef uint32 InterruptMaskType;
 
 
 /*==================[external data declaration]==============================*/
 
 
 
-extern TaskType cortexM4TerminatedTaskID;
+/** \brief Core clock of CMSIS, frequency of the time of the trace */
+extern uint32 SystemCoreClock;
 
 
 
@@ -252,6 +397,9 @@ extern TaskType cortexM4TerminatedTaskID;
 
 void cortexM4ResetTaskContext(uint8 TaskID);
 
+/** \brief Initial program counter of the tasks, defined in PendSV.s */
+extern void cortexM4TaskStart(void);
+
 
 
 /** @} doxygen end group definition */
@@ -50,6 +50,17 @@
 /*==================[inclusions]=============================================*/
 
 /*==================[macros]=================================================*/
+/** \brief Extra size reserved for each stack
+ **
+ ** This macro shall be set to the amount of extra stack needed for each task
+ ** in the simulation of the rtos in systems like windows/linux. In real
+ ** embedded hw this macro shall be set to 0.
+ **
+ ** TASK_STACK_ADDITIONAL_SIZE bytes of extra stack are reserved for each task
+ ** running on the system.
+ **/
+#define TASK_STACK_ADDITIONAL_SIZE 0
+
 /** \brief Osek_Internal_Arch_Cpu.h inclusion needed macro
  **
  ** This define makes the Osek_Internal.h file to include the
@@ -208,6 +219,16 @@
  **/
 #define ShutdownOs_Arch()
 
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. StartOS is called on the
+ ** stack of the calling task, which is abandoned when the first task is
+ ** dispatched. Therefore the stack check shall not be enabled together
+ ** with RestartOS on this architecture.
+ **/
+#define RestartOs_Arch() { StartOS(ApplicationMode); }
+
 /*==================[typedef]================================================*/
 
 /*==================[external data declaration]==============================*/
@@ -89,6 +89,16 @@
 /** \brief INVALID Task State */
 #define INVALID_STATE 4U
 
+/** \brief The trace is recording */
+#define TRACE_RECORDING ((TraceStateType)0U)
+/** \brief The trace has been triggered and records the post trigger window */
+#define TRACE_TRIGGERED ((TraceStateType)1U)
+/** \brief The trace is stopped, the buffer keeps the recorded events */
+#define TRACE_STOPPED   ((TraceStateType)2U)
+
+/** \brief Count of arguments of a log message */
+#define LOG_ARGS        3U
+
 /** \brief Definition return value E_OK */
 /* \req OSEK_SYS_1.1.1 */
 #define E_OK               ((StatusType)0U)
@@ -284,6 +294,20 @@
 #define OSServiceId_GetActiveApplicationMode    24
 #define OSServiceId_StartOS                     25
 #define OSServiceId_ShutdownOS                  26
+#define OSServiceId_WaitGetClearEvent           27
+#define OSServiceId_WaitSemaphore               28
+#define OSServiceId_PostSemaphore               29
+#define OSServiceId_SetTaskPriority             30
+#define OSServiceId_GetIsrMonitor               31
+#define OSServiceId_WriteData                   32
+#define OSServiceId_ReadData                    33
+#define OSServiceId_GetStageBuffers             34
+#define OSServiceId_ChainStage                  35
+#define OSServiceId_GetPipelineStats            36
+#define OSServiceId_ActivateTaskWithArg         37
+#define OSServiceId_GetActivationArg            38
+#define OSServiceId_GetRoundRobinStats          39
+#define OSServiceId_RestartOS                   40
 
 /** \brief ErrorHook API ID to indicate an stack overflow, this is not a OSEK
  **        conform error, but an vendor extenson */
@@ -292,6 +316,49 @@
 /** \brief Resource Scheduler */
 #define RES_SCHEDULER                           255
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+/** \brief Activate a Task from an ISR category 1
+ **
+ ** ISR category 1 may not call any OS service. This macro only sets the
+ ** pending activation bit of the indicated task with an atomic or, the
+ ** kernel performs the ActivateTask at the next call of the scheduler, at
+ ** the end of the next ISR category 2 or at the next tick of a hardware
+ ** counter.
+ **
+ ** \param[in] TaskID task to be activated
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. Activations posted before the kernel takes
+ **          them are merged into one activation.
+ **/
+#define ActivateTaskFromISR1(TaskID)                                    \
+   do {                                                                 \
+      AtomicOr_Arch(&Isr1PendingActivations[(TaskID) >> 5U],            \
+                    (uint32)1U << ((TaskID) & 31U));                    \
+   } while(0)
+
+/** \brief Set Events of a Task from an ISR category 1
+ **
+ ** Sets the indicated events in the pending events word of the task and
+ ** afterwards marks the task as having pending events, both with an atomic
+ ** or. The kernel performs the SetEvent at the next call of the scheduler,
+ ** at the end of the next ISR category 2 or at the next tick of a hardware
+ ** counter.
+ **
+ ** \param[in] TaskID task to set the events
+ ** \param[in] Mask events to be set
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+#define SetEventFromISR1(TaskID, Mask)                                  \
+   do {                                                                 \
+      AtomicOr_Arch(&Isr1PendingEvents[(TaskID)], (Mask));              \
+      AtomicOr_Arch(&Isr1PendingEventTasks[(TaskID) >> 5U],             \
+                    (uint32)1U << ((TaskID) & 31U));                    \
+   } while(0)
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
 /*==================[typedef]================================================*/
 /** \brief Type definition of TaskType
  **
@@ -329,6 +396,23 @@ typedef unsigned char AppModeType;
  **/
 typedef unsigned char ResourceType;
 
+/** \brief Type definition of SemaphoreType
+ **
+ ** This type is used to represent a Semaphore
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char SemaphoreType;
+
+/** \brief Type definition of PriorityType
+ **
+ ** This type is used to represent the priority of a task as configured in
+ ** the OIL file
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char PriorityType;
+
 /** \brief Type definition of Event Mask
  **
  ** This type is used to represent Events
@@ -385,6 +469,188 @@ typedef signed char InterruptCounterType;
  ***/
 typedef uint16 StackSizeType;
 
+/** \brief Trace State Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char TraceStateType;
+
+/** \brief ISR Type
+ **
+ ** Identifies an ISR category 2, ISRID_<name> is generated for each one.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char ISRType;
+
+/** \brief ISR Monitor Type
+ **
+ ** Statistics of an ISR category 2, the times are in microseconds.
+ **
+ ** \param Arrivals count of executions of the isr
+ ** \param MaxBurst longest sequence of arrivals closer than the
+ **        MININTERARRIVAL time of the isr
+ ** \param ExecTime execution time of the last execution
+ ** \param MaxExecTime longest execution time
+ ** \param Throttles times that the source has been masked for BACKOFF
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef struct {
+   uint32 Arrivals;
+   uint32 MaxBurst;
+   uint32 ExecTime;
+   uint32 MaxExecTime;
+   uint32 Throttles;
+} IsrMonitorType;
+
+/** \brief ISR Monitor Reference Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef IsrMonitorType* IsrMonitorRefType;
+
+/** \brief Type definition of DataType
+ **
+ ** This type is used to represent a latest value channel, a macro with the
+ ** name of each DATA of the OIL file is generated.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char DataType;
+
+/** \brief Type definition of PipelineType
+ **
+ ** This type is used to represent a pipeline, a macro with the name of each
+ ** PIPELINE of the OIL file is generated.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned char PipelineType;
+
+/** \brief Pipeline Buffer Reference Type
+ **
+ ** Reference to the buffer of a pipeline stage, SIZE bytes aligned to 32
+ ** bits.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef void ** PipelineBufferRefType;
+
+/** \brief Pipeline Stats Type
+ **
+ ** Statistics of a pipeline stage, the times are in microseconds.
+ **
+ ** \param Frames count of frames handed over by the stage
+ ** \param Overruns count of frames dropped because the next stage was
+ **        still processing the previous frame
+ ** \param Latency time from the hand over to the stage to its own hand
+ **        over of the last frame, the first stage starts a frame with its
+ **        first call to GetStageBuffers or ChainStage
+ ** \param MaxLatency longest Latency
+ ** \param FrameLatency time from the start of the last frame in the first
+ **        stage until its hand over by this stage
+ ** \param MaxFrameLatency longest FrameLatency
+ ** \param Period time between the last two hand overs of the stage, its
+ **        inverse is the throughput of the stage
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef struct {
+   uint32 Frames;
+   uint32 Overruns;
+   uint32 Latency;
+   uint32 MaxLatency;
+   uint32 FrameLatency;
+   uint32 MaxFrameLatency;
+   uint32 Period;
+} PipelineStatsType;
+
+/** \brief Pipeline Stats Reference Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef PipelineStatsType* PipelineStatsRefType;
+
+/** \brief Round Robin Stats Type
+ **
+ ** Statistics of the time slices of the tasks of one priority.
+ **
+ ** \param Slices count of time slices which ended while a task of the
+ **        priority was running
+ ** \param Rotations count of ended time slices after which the running
+ **        task has been moved behind the other ready tasks of the priority
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef struct {
+   uint32 Slices;
+   uint32 Rotations;
+} RoundRobinStatsType;
+
+/** \brief Round Robin Stats Reference Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef RoundRobinStatsType* RoundRobinStatsRefType;
+
+/** \brief Type definition of ActivationArgType
+ **
+ ** Argument passed to a task activation with ActivateTaskWithArg.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef uint32 ActivationArgType;
+
+/** \brief Activation Argument Reference Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef ActivationArgType* ActivationArgRefType;
+
+/** \brief Type definition of LogFormatType
+ **
+ ** This type is used to represent the format of a log message, a macro with
+ ** the name of each LOGFORMAT of the OIL file is generated.
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef unsigned short LogFormatType;
+
+/** \brief Log Entry Type
+ **
+ ** A log message read with ReadLog.
+ **
+ ** \param Format format of the message
+ ** \param Text format string of the message, the arguments are formatted
+ **        with it, for example with printf
+ ** \param Args arguments of the message
+ ** \param Time time of the message in units of the trace time source, 0 on
+ **        architectures without it
+ ** \param Task task running when the message was logged, INVALID_TASK if
+ **        none
+ ** \param Isr TRUE if the message was logged by an ISR
+ ** \param Lost count of messages overwritten before they were read, since
+ **        the previous entry
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef struct {
+   LogFormatType Format;
+   const char * Text;
+   uint32 Args[LOG_ARGS];
+   uint32 Time;
+   TaskType Task;
+   boolean Isr;
+   uint32 Lost;
+} LogEntryType;
+
+/** \brief Log Entry Reference Type
+ **
+ ** \remarks This is not part of OSEK, is a vendor extension
+ **/
+typedef LogEntryType* LogEntryRefType;
+
 /*==================[external data declaration]==============================*/
 /** \brief Suspend OS interrupts counter */
 extern InterruptCounterType SuspendOSInterrupts_Counter;
@@ -395,6 +661,18 @@ extern InterruptCounterType DisableAllInterrupts_Counter;
 /** \brief Suspend All interrupts counter */
 extern InterruptCounterType SuspendAllInterrupts_Counter;
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+/** \brief Pending activations posted by ISR category 1, one bit per task */
+extern uint32 Isr1PendingActivations[];
+
+/** \brief Tasks with pending events posted by ISR category 1, one bit per
+ **        task */
+extern uint32 Isr1PendingEventTasks[];
+
+/** \brief Pending events posted by ISR category 1, one word per task */
+extern EventMaskType Isr1PendingEvents[];
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
 /*==================[external functions declaration]=========================*/
 /** \brief Activate the specified Task
  **
@@ -587,6 +865,283 @@ extern StatusType GetEvent(TaskType TaskID, EventMaskRefType Event);
  **/
 extern StatusType WaitEvent(EventMaskType Mask);
 
+/** \brief Wait, Get and Clear Events
+ **
+ ** This service puts the task in wait state until one or more of the
+ ** indicated events occurs, returns the set events of Mask and clears them.
+ ** The calling task continues without waiting if one of the events is
+ ** already set. It replaces the sequence WaitEvent, GetEvent and ClearEvent
+ ** with a single service.
+ **
+ ** \param[in] Mask events to wait for
+ ** \param[out] Event events of Mask which have been set, these events are
+ **                   cleared
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ACCESS if called from a basic task
+ ** \return E_OS_RESOURCE if the calling task occupies resources
+ ** \return E_OS_CALLEVEL if called from a context other than a task
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType WaitGetClearEvent(EventMaskType Mask, EventMaskRefType Event);
+
+/** \brief Wait Semaphore
+ **
+ ** Takes one unit of the indicated semaphore. If the semaphore count is 0
+ ** the calling task is put in the waiting state until another task or an
+ ** ISR2 posts the semaphore. Waiting tasks are ordered by priority, tasks
+ ** with the same priority are served in the order they start to wait.
+ **
+ ** \param[in] SemID semaphore to be taken
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid SemID is provided
+ ** \return E_OS_ACCESS if called from a basic task
+ ** \return E_OS_RESOURCE if the calling task occupies resources
+ ** \return E_OS_CALLEVEL if called from a context other than a task
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType WaitSemaphore(SemaphoreType SemID);
+
+/** \brief Post Semaphore
+ **
+ ** Releases one unit of the indicated semaphore. If a task is waiting for
+ ** the semaphore the unit is given to the highest priority waiting task,
+ ** which is set to ready. If called from an ISR2 the rescheduling takes
+ ** place at the end of the ISR2.
+ **
+ ** \param[in] SemID semaphore to be posted
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid SemID is provided
+ ** \return E_OS_LIMIT if the semaphore count is already at its maximal value
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType PostSemaphore(SemaphoreType SemID);
+
+/** \brief Set Task Priority
+ **
+ ** Changes the priority of the indicated task. A ready or running task is
+ ** moved to the ready list of the new priority, the running task stays the
+ ** first task of its new priority. The priority raised by occupied resources
+ ** is kept until they are released. If called from a task the rescheduling
+ ** takes place only if another task has now a higher priority, if called
+ ** from an ISR2 at the end of the ISR2.
+ **
+ ** \param[in] TaskID task to get the new priority
+ ** \param[in] Priority new priority of the task, the priorities of the OIL
+ **                     file are used. It shall not be higher than the
+ **                     ceiling of the resources used by the task.
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid TaskID is provided
+ ** \return E_OS_VALUE if the priority is out of the configured range or
+ **                    higher than the ceiling of a resource of the task
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if DYNAMICPRIORITY is
+ **          enabled.
+ **/
+extern StatusType SetTaskPriority(TaskType TaskID, PriorityType Priority);
+
+/** \brief Get Isr Monitor
+ **
+ ** Copies the arrival and execution time statistics of an ISR category 2.
+ ** The execution time is measured in the isr wrapper generated by the os,
+ ** the rescheduling after the isr is not included.
+ **
+ ** \param[in] IsrID isr to be read, ISRID_<name>
+ ** \param[out] Monitor reference to the statistics of the isr
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid IsrID is provided
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if ISRMONITOR is
+ **          enabled.
+ **/
+extern StatusType GetIsrMonitor(ISRType IsrID, IsrMonitorRefType Monitor);
+
+/** \brief Isr Storm Hook
+ **
+ ** Called from the isr wrapper when more than MAXBURST arrivals of an ISR
+ ** category 2 follow each other closer than its MININTERARRIVAL time. The
+ ** source of the isr has already been masked for BACKOFF microseconds, the
+ ** actual arrival is still executed after the hook.
+ **
+ ** \param[in] IsrID isr which has been masked
+ **
+ ** \remarks This is an extension, this hook is not part of the OSEK
+ **          specificiation. It has to be implemented by the user if
+ **          ISRSTORMHOOK is enabled.
+ **/
+extern void IsrStormHook(ISRType IsrID);
+
+/** \brief Write Data
+ **
+ ** Publishes a new value of the indicated data, SIZE bytes are copied from
+ ** Value. The write never waits and takes no resource, therefore it may be
+ ** used from tasks and from ISR category 2. Every data shall have only one
+ ** writer, a task or an ISR2.
+ **
+ ** For a SEQLOCK data the value is copied twice, the readers always find
+ ** one of both copies complete. For a TRIPLEBUFFER data the value is copied
+ ** once to the buffer not owned by the reader and then exchanged with the
+ ** spare buffer.
+ **
+ ** \param[in] DataID data to be written
+ ** \param[in] Value reference to the new value
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid DataID is provided, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType WriteData(DataType DataID, const void * Value);
+
+/** \brief Read Data
+ **
+ ** Copies the latest complete value of the indicated data to Value. The
+ ** read never blocks the writer. A SEQLOCK data may be read by any number
+ ** of tasks and ISR2, the copy is repeated only if the writer has run during
+ ** the copy. A TRIPLEBUFFER data may have only one reader, its read takes
+ ** always the same time.
+ **
+ ** \param[in] DataID data to be read
+ ** \param[out] Value reference where the value is copied to
+ ** \return E_OK if no error occurs
+ ** \return E_OS_NOFUNC if the data has never been written
+ ** \return E_OS_ID if an invalid DataID is provided, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType ReadData(DataType DataID, void * Value);
+
+/** \brief Get Stage Buffers
+ **
+ ** Returns the buffers of the pipeline stage implemented by the calling
+ ** task. Input is the buffer handed over by the previous stage, Output is
+ ** the buffer to be handed over to the next stage. The stages use both
+ ** buffers in place, the data is never copied. Each link between two stages
+ ** has two buffers, the previous stage may fill the second one while the
+ ** actual stage works on the first one.
+ **
+ ** \param[in] PipelineID pipeline of the stage
+ ** \param[out] Input input buffer, NULL for the first stage
+ ** \param[out] Output output buffer, NULL for the last stage
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ACCESS if the calling task is not a stage of the pipeline
+ ** \return E_OS_ID if an invalid PipelineID is provided, only in extended
+ **         mode
+ ** \return E_OS_CALLEVEL if called at interrupt level, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType GetStageBuffers(PipelineType PipelineID,
+      PipelineBufferRefType Input, PipelineBufferRefType Output);
+
+/** \brief Chain Stage
+ **
+ ** Hands over the output buffer to the next stage of the pipeline and
+ ** chains the calling task to the task of the next stage, as ChainTask
+ ** does. The last stage of the pipeline is terminated as with TerminateTask.
+ ** If no error occurs this service does not return.
+ **
+ ** If the next stage is still processing the previous frame or has been
+ ** activated otherwise, the frame is dropped, counted as overrun and
+ ** E_OS_LIMIT is returned. The check, the hand over and the chaining are
+ ** one atomic step. The caller may call ChainStage again later or
+ ** terminate.
+ **
+ ** \param[in] PipelineID pipeline of the stage
+ ** \return E_OS_LIMIT if the next stage is still active
+ ** \return E_OS_ACCESS if the calling task is not a stage of the pipeline
+ ** \return E_OS_ID if an invalid PipelineID is provided, only in extended
+ **         mode
+ ** \return E_OS_RESOURCE if the calling task still occupies resources, only
+ **         in extended mode
+ ** \return E_OS_CALLEVEL if called at interrupt level, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType ChainStage(PipelineType PipelineID);
+
+/** \brief Get Pipeline Stats
+ **
+ ** Copies the statistics of a pipeline stage. The times are only measured
+ ** on architectures with a trace time source, on the others they are 0.
+ **
+ ** \param[in] PipelineID pipeline of the stage
+ ** \param[in] StageID task of the stage
+ ** \param[out] Stats reference to the statistics of the stage
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if StageID is not a stage of the pipeline or, only in
+ **         extended mode, an invalid PipelineID is provided
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType GetPipelineStats(PipelineType PipelineID, TaskType StageID,
+      PipelineStatsRefType Stats);
+
+/** \brief Get Round Robin Stats
+ **
+ ** Copies the time slice statistics of the priority of a task. A time slice
+ ** which ends while no other task of the priority is ready is counted as
+ ** slice but not as rotation.
+ **
+ ** \param[in] TaskID task whose priority is read
+ ** \param[out] Stats reference to the statistics of the priority
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ID if an invalid TaskID is provided, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if at least one task
+ **          configures a TIMESLICE.
+ **/
+extern StatusType GetRoundRobinStats(TaskType TaskID,
+      RoundRobinStatsRefType Stats);
+
+/** \brief Activate Task With Argument
+ **
+ ** Activates the task as ActivateTask does and queues the argument together
+ ** with the activation, the activated task gets it with GetActivationArg.
+ ** The task shall be configured with ACTIVATIONARG = TRUE, it has a queue
+ ** of one argument for each of its activations. The activations done with
+ ** ActivateTask, ChainTask or an alarm queue the argument 0.
+ **
+ ** \param[in] TaskID task to be activated
+ ** \param[in] Arg argument of the activation
+ ** \return E_OK if no error occurs
+ ** \return E_OS_LIMIT if too many task activations of TaskID
+ ** \return E_OS_ACCESS if TaskID has no ACTIVATIONARG
+ ** \return E_OS_ID if the TaskID is invalid, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType ActivateTaskWithArg(TaskType TaskID, ActivationArgType Arg);
+
+/** \brief Get Activation Argument
+ **
+ ** Returns the argument queued with the activation of the calling task
+ ** which is actually running. The argument remains valid until the task
+ ** terminates.
+ **
+ ** \param[out] Arg argument of the running activation
+ ** \return E_OK if no error occurs
+ ** \return E_OS_ACCESS if the calling task has no ACTIVATIONARG
+ ** \return E_OS_CALLEVEL if called at interrupt level, only in extended mode
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation.
+ **/
+extern StatusType GetActivationArg(ActivationArgRefType Arg);
+
 /** \brief ShutdownOS
  **
  ** This api stops the os.
@@ -595,6 +1150,30 @@ extern StatusType WaitEvent(EventMaskType Mask);
  **/
 extern void ShutdownOS(StatusType Error);
 
+/** \brief RestartOS
+ **
+ ** This api restarts the os without a reset of the cpu. The state of the
+ ** tasks, ready lists, alarms, counters and the interrupt nesting counters
+ ** are set back to the state after the start of the os in the indicated
+ ** application mode and the os is started again, the auto start tasks and
+ ** alarms of the application mode are activated.
+ **
+ ** This api shall be called from task level or from the ErrorHook called
+ ** from task level. The data of the application is not reinitialized.
+ **
+ ** This function shall never return. In extended mode a call which is not
+ ** made at task level, e.g. from an isr or from the StartupHook, returns and
+ ** calls the ErrorHook with E_OS_CALLEVEL.
+ **
+ ** \param[in] Mode Application Mode
+ ** \return never
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. If BOOTIMAGE is enabled the state is
+ **          restored from the boot image of the application mode.
+ **/
+extern void RestartOS(AppModeType Mode);
+
 /** \brief Get Active Application Mode
  **
  ** This API returns the Application Mode
@@ -672,6 +1251,74 @@ extern StatusType SetAbsAlarm(AlarmType AlarmID, TickType Start, TickType Cycle)
  **/
 extern StatusType CancelAlarm(AlarmType AlarmID);
 
+/** \brief Trace Trigger
+ **
+ ** Marks the actual time in the trace and stops the trace after
+ ** TRACEPOSTTRIGGER bytes have been recorded. In RING mode the buffer keeps
+ ** the events before and after the trigger. The ErrorHook and a missed
+ ** deadline trigger the trace too. This service may be called from tasks,
+ ** ISRs and hooks, only the first trigger is taken into account.
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if TRACE is enabled.
+ **/
+extern void TraceTrigger(void);
+
+/** \brief Trace User Event
+ **
+ ** Records an event of the application in the trace.
+ **
+ ** \param[in] Id identifier of the event, from 0 to 15
+ ** \param[in] Value value stored with the event
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if TRACE is enabled.
+ **/
+extern void TraceUserEvent(uint8 Id, uint32 Value);
+
+/** \brief Get Trace State
+ **
+ ** \return TRACE_RECORDING, TRACE_TRIGGERED or TRACE_STOPPED
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if TRACE is enabled.
+ **/
+extern TraceStateType GetTraceState(void);
+
+/** \brief Log Message
+ **
+ ** Records a message with the format and raw arguments in the log, the
+ ** message is formatted later by the reader of the log. The recording costs
+ ** a few stores and does not mask interrupts, this service may be called
+ ** from tasks, ISRs and hooks. If the log is full the oldest message is
+ ** overwritten.
+ **
+ ** \param[in] Format format of the message
+ ** \param[in] Arg1 first argument of the message
+ ** \param[in] Arg2 second argument of the message
+ ** \param[in] Arg3 third argument of the message
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if LOG is enabled.
+ **/
+extern void LogMessage(LogFormatType Format, uint32 Arg1, uint32 Arg2,
+      uint32 Arg3);
+
+/** \brief Read Log
+ **
+ ** Takes the oldest message of the log. The log has a single reader, for
+ ** example a background task with the lowest priority which prints the
+ ** messages. An empty log is not an error, the ErrorHook is not called.
+ **
+ ** \param[out] Entry the message
+ ** \return E_OK if a message has been read
+ ** \return E_OS_NOFUNC if the log is empty
+ **
+ ** \remarks This is an extension, this API is not part of the OSEK
+ **          specificiation. It is only available if LOG is enabled.
+ **/
+extern StatusType ReadLog(LogEntryRefType Entry);
+
 #if (STACK_CHECK_TYPE == STACK_CHECK_OVERFLOW_SIZE)
 /** \brief Get Max Used Stack
  **
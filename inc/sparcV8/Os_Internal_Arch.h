@@ -172,6 +172,24 @@
 #define ShutdownOs_Arch()
 
 
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. StartOS is called on the
+ ** stack of the calling task, which is abandoned when the first task is
+ ** dispatched. Therefore the stack check shall not be enabled together
+ ** with RestartOS on this architecture. The processor interrupt level is
+ ** set back to 0, a resource shared with isrs may have been held by the
+ ** calling task. The interrupts stay masked on the interrupt controller
+ ** until StartOS enables them.
+ **/
+#define RestartOs_Arch()                                                         \
+{                                                                                \
+   (void)sparcSystemSetProcessorInterruptLevel(0);                               \
+   StartOS(ApplicationMode);                                                     \
+}
+
+
 /** \brief osekpause
  **
  ** According to Aeroflex Gaisler LEON 3 documentation, the LEON 3
@@ -209,9 +227,35 @@
  */
 #define JmpTask(newTask) { sparcSystemServiceTriggerSetTaskContext(); }
 
+/**
+ * \brief SPARC implementation of the mask of a resource shared with isrs.
+ *
+ * The processor interrupt level is raised to the level of the ceiling of the
+ * resource, if the level was already higher it is kept.
+ *
+ * \param[in] mask Processor interrupt level of the ceiling of the resource.
+ * \param[out] previous Processor interrupt level before this call.
+ */
+#define RaiseInterruptMask_Arch(mask, previous)                                  \
+{                                                                                \
+   (previous) = sparcSystemSetProcessorInterruptLevel(mask);                     \
+   if ((previous) > (mask))                                                      \
+   {                                                                             \
+      (void)sparcSystemSetProcessorInterruptLevel(previous);                     \
+   }                                                                             \
+}
+
+/**
+ * \brief SPARC implementation of the restore of the mask of a resource shared with isrs.
+ *
+ * \param[in] previous Processor interrupt level to be restored.
+ */
+#define RestoreInterruptMask_Arch(previous) { (void)sparcSystemSetProcessorInterruptLevel(previous); }
 
-/*==================[typedef]================================================*/
 
+/*==================[typedef]================================================*/
+/** \brief Interrupt mask type used by the resources shared with isrs */
+typedef uint32 InterruptMaskType;
 
 /*==================[external data declaration]==============================*/
 
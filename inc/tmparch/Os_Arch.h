@@ -143,6 +143,46 @@
    {                                             \
    }
 
+#error update the following macro and remove this comment
+/** \brief Atomic Or Arch
+ **
+ ** Sets the bits of mask in the word pointed by addr with a single atomic
+ ** read modify write, this macro may be used from ISR category 1.
+ **/
+#define AtomicOr_Arch(addr, mask)                   \
+   {                                                \
+   }
+
+#error update the following macro and remove this comment
+/** \brief Atomic Take Arch
+ **
+ ** Reads the word pointed by addr into ret and clears it with a single
+ ** atomic exchange.
+ **/
+#define AtomicTake_Arch(addr, ret)                  \
+   {                                                \
+   }
+
+#error update the following macro and remove this comment
+/** \brief Atomic Exchange Arch
+ **
+ ** Stores value in the word pointed by addr and returns the previous
+ ** content in ret with a single atomic exchange.
+ **/
+#define AtomicExchange_Arch(addr, value, ret)       \
+   {                                                \
+   }
+
+#error update the following macro and remove this comment
+/** \brief Atomic Add Arch
+ **
+ ** Adds value to the word pointed by addr and returns the previous content
+ ** in ret with a single atomic read modify write.
+ **/
+#define AtomicAdd_Arch(addr, value, ret)            \
+   {                                                \
+   }
+
 /*==================[typedef]================================================*/
 #error this is a remember to remove the comment on the following line
 /*****************************************************************************
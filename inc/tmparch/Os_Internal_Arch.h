@@ -93,6 +93,18 @@
  * PLEASE REMOVE THIS COMMENT
  *****************************************************************************/
 
+#error update the following macro and remove this comment
+/** \brief Extra size reserved for each stack
+ **
+ ** This macro shall be set to the amount of extra stack needed for each task
+ ** in the simulation of the rtos in systems like windows/linux. In real
+ ** embedded hw this macro shall be set to 0.
+ **
+ ** TASK_STACK_ADDITIONAL_SIZE bytes of extra stack are reserved for each task
+ ** running on the system.
+ **/
+#define TASK_STACK_ADDITIONAL_SIZE 0
+
 #error update the following macro and remove this comment
 /** \brief Osek_Internal_Arch_Cpu.h inclusion needed macro
  **
@@ -264,6 +276,31 @@
  **/
 #define ShutdownOs_Arch()
 
+#error update the following macro and remove this comment
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. The stack pointer shall be set
+ ** to the stack used by StartOS on the first start of the os before StartOS
+ ** is called again, the stack of the calling task is abandoned.
+ **/
+#define RestartOs_Arch() { StartOS(ApplicationMode); }
+
+#error update the following macros and remove this comment
+/** \brief Initialize the time source of the trace
+ **
+ ** A free running counter shall be started. The macros of the trace are
+ ** only used if TRACE is enabled, they may be removed if the architecture
+ ** does not support the trace.
+ **/
+#define TraceInit_Arch()
+
+/** \brief Get the time of the trace in TraceGetFrequency_Arch() units */
+#define TraceGetTime_Arch() (0U)
+
+/** \brief Frequency of the time of the trace in Hz */
+#define TraceGetFrequency_Arch() (1000000U)
+
 /*==================[typedef]================================================*/
 #error this is a remember to remove the comment on the following line
 /*****************************************************************************
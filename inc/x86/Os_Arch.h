@@ -89,6 +89,61 @@
       InterruptMask |= OSEK_OS_INTERRUPT_MASK;   \
    }
 
+/** \brief Atomic Or Arch
+ **
+ ** Sets the bits of mask in the word pointed by addr with a single atomic
+ ** read modify write, this macro may be used from ISR category 1.
+ **/
+#define AtomicOr_Arch(addr, mask)                        \
+   {                                                     \
+      (void)__sync_fetch_and_or((addr), (mask));         \
+   }
+
+/** \brief Atomic Take Arch
+ **
+ ** Reads the word pointed by addr into ret and clears it with a single
+ ** atomic exchange.
+ **/
+#define AtomicTake_Arch(addr, ret)                       \
+   {                                                     \
+      (ret) = __sync_lock_test_and_set((addr), 0U);      \
+      __sync_synchronize();                              \
+   }
+
+/** \brief Atomic Exchange Arch
+ **
+ ** Stores value in the word pointed by addr and returns the previous
+ ** content in ret with a single atomic exchange.
+ **/
+#define AtomicExchange_Arch(addr, value, ret)            \
+   {                                                     \
+      __sync_synchronize();                              \
+      (ret) = __sync_lock_test_and_set((addr), (value)); \
+      __sync_synchronize();                              \
+   }
+
+/** \brief Atomic Add Arch
+ **
+ ** Adds value to the word pointed by addr and returns the previous content
+ ** in ret with a single atomic read modify write.
+ **/
+#define AtomicAdd_Arch(addr, value, ret)                 \
+   {                                                     \
+      (ret) = __sync_fetch_and_add((addr), (value));     \
+   }
+
+/** \brief Magic number of a post build image, "OSPB" */
+#define POST_BUILD_MAGIC                  0x4250534FU
+
+/** \brief Version of the post build image format */
+#define POST_BUILD_VERSION                1U
+
+/** \brief Size of the symbol names of a post build image */
+#define POST_BUILD_NAME_SIZE              32U
+
+/** \brief Environment variable with the file name of the post build image */
+#define POST_BUILD_IMAGE_ENV              "OSEK_POST_BUILD_IMAGE"
+
 /*==================[typedef]================================================*/
 /** \brief Interrupt type definition */
 typedef unsigned int InterruptFlagsType;
@@ -96,6 +151,72 @@ typedef unsigned int InterruptFlagsType;
 /** \brief Interrupt state type definition */
 typedef unsigned char InterruptStateType;
 
+/** \brief Post Build Header Type
+ **
+ ** A post build image starts with this header followed by the tasks,
+ ** resources, alarms, counters and auto start alarms. All fields are
+ ** stored in the byte order of the host. The counts shall be the same as
+ ** the counts of the generated configuration.
+ **/
+typedef struct {
+   uint32 Magic;
+   uint32 Version;
+   uint32 TasksCount;
+   uint32 ResourcesCount;
+   uint32 AlarmsCount;
+   uint32 CountersCount;
+   uint32 AutoStartAlarmsCount;
+} PostBuildHeaderType;
+
+/** \brief Post Build Task Type
+ **
+ ** The entry point is the name of a generated symbol, the name of a task
+ ** of the OIL file.
+ **/
+typedef struct {
+   char EntryPoint[POST_BUILD_NAME_SIZE];
+   uint32 Priority;
+   uint32 MaxActivations;
+   uint32 Extended;
+   uint32 Preemtive;
+   uint32 EventsMask;
+   uint32 ResourcesMask;
+} PostBuildTaskType;
+
+/** \brief Post Build Resource Type */
+typedef struct {
+   uint32 Priority;
+} PostBuildResourceType;
+
+/** \brief Post Build Alarm Type
+ **
+ ** The action is coded as AlarmActionType, the callback is the name of an
+ ** alarm callback of the OIL file or empty. The counter of an alarm can
+ ** not be changed, Counter is the counter incremented by the alarm.
+ **/
+typedef struct {
+   char Callback[POST_BUILD_NAME_SIZE];
+   uint32 Action;
+   uint32 TaskID;
+   uint32 Event;
+   uint32 Counter;
+} PostBuildAlarmType;
+
+/** \brief Post Build Counter Type */
+typedef struct {
+   uint32 MaxAllowedValue;
+   uint32 MinCycle;
+   uint32 TicksPerBase;
+} PostBuildCounterType;
+
+/** \brief Post Build Auto Start Alarm Type */
+typedef struct {
+   uint32 Mode;
+   uint32 Alarm;
+   uint32 AlarmTime;
+   uint32 AlarmCycleTime;
+} PostBuildAutoStartAlarmType;
+
 /*==================[external data declaration]==============================*/
 /** \brief Interrupt Mask
  **
@@ -114,6 +235,63 @@ extern InterruptStateType InterruptState;
 /*==================[external functions declaration]=========================*/
 extern void ScheduleInterrupts(void);
 
+/** \brief Save the configuration as post build image
+ **
+ ** Writes the actual configuration of the os to a post build image, the
+ ** image can be used as template for variants of the configuration.
+ **
+ ** \param[in] FileName name of the file to be written
+ ** \return E_OK if the image has been written
+ ** \return E_OS_ACCESS if the file could not be written
+ **
+ ** \remarks This is an extension, it is only available on x86 if
+ **          POSTBUILD is enabled.
+ **/
+extern StatusType PostBuildSave_Arch(const char * FileName);
+
+/** \brief Save the trace
+ **
+ ** Writes the trace to a file, the file can be decoded with the trace tool
+ ** of the host.
+ **
+ ** \param[in] FileName name of the file to be written
+ ** \return E_OK if the trace has been written
+ ** \return E_OS_ACCESS if the file could not be written
+ **
+ ** \remarks This is an extension, it is only available on x86 if
+ **          TRACE is enabled.
+ **/
+extern StatusType TraceSave_Arch(const char * FileName);
+
+/** \brief Save the log
+ **
+ ** Writes the log to a file, the messages can be decoded with the log tool
+ ** of the host.
+ **
+ ** \param[in] FileName name of the file to be written
+ ** \return E_OK if the log has been written
+ ** \return E_OS_ACCESS if the file could not be written
+ **
+ ** \remarks This is an extension, it is only available on x86 if
+ **          LOG is enabled.
+ **/
+extern StatusType LogSave_Arch(const char * FileName);
+
+/** \brief Print the log in a thread of the host
+ **
+ ** Starts a thread of the host which reads the messages of the log with
+ ** ReadLog and prints them to the standard output, the tasks are not
+ ** delayed by the formatting. The application shall not call ReadLog
+ ** itself.
+ **
+ ** \return E_OK if the thread has been started
+ ** \return E_OS_ACCESS if the thread could not be started
+ **
+ ** \remarks This is an extension, it is only available on x86 if
+ **          LOG is enabled.
+ **/
+extern StatusType LogPrint_Arch(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -183,16 +183,22 @@
 }
 #endif
 
-/** \brief Set the entry point for a task */
+/** \brief Set the entry point for a task
+ **
+ ** The stack is also reset, a task preempted in its last execution would
+ ** start again with the stack pointer of the preemption point.
+ **/
 #if ( CPUTYPE == ia64 )
 #define SetEntryPoint(task)                                                                                           \
 {                                                                                                                     \
    TasksConst[(task)].TaskContext->tss_rip = (uint64)TasksConst[(task)].EntryPoint;                                   \
+   ResetStack(task);                                                                                                  \
 }
 #elif ( CPUTYPE == ia32 )
 #define SetEntryPoint(task)                                                                                           \
 {                                                                                                                     \
    TasksConst[(task)].TaskContext->tss_eip = (uint32)TasksConst[(task)].EntryPoint;                                   \
+   ResetStack(task);                                                                                                  \
 }
 #endif
 /** \brief */
@@ -321,7 +327,97 @@
    PostCallService();      \
 }
 
+/** \brief Initialize the time source of the trace
+ **
+ ** The time is taken from the monotonic clock of the host.
+ **/
+#define TraceInit_Arch()
+
+/** \brief Get the time of the trace in TraceGetFrequency_Arch() units */
+#define TraceGetTime_Arch() TraceTime_Arch()
+
+/** \brief Frequency of the time of the trace in Hz */
+#define TraceGetFrequency_Arch() (1000000U)
+
+/** \brief Raise the interrupt mask for a resource shared with isrs
+ **
+ ** Masks the simulated interrupts set in mask and stores the previous mask
+ ** in previous. Interrupts triggered while masked stay pending in
+ ** InterruptFlag and are executed when the mask is restored. The mask is
+ ** kept in InterruptResources and not in InterruptMask, therefore
+ ** EnableOSInterrupts and ResumeOSInterrupts do not unmask the interrupts
+ ** of a resource which is still held.
+ **
+ ** \param[in] mask interrupts to be masked
+ ** \param[out] previous mask before this call
+ **/
+#define RaiseInterruptMask_Arch(mask, previous)     \
+{                                                   \
+   (previous) = InterruptResources;                 \
+   InterruptResources |= (InterruptMaskType)(mask); \
+}
+
+/** \brief Restore the interrupt mask saved by RaiseInterruptMask_Arch
+ **
+ ** \param[in] previous mask to be restored
+ **/
+#define RestoreInterruptMask_Arch(previous)      \
+{                                                \
+   InterruptResources = (previous);              \
+}
+
+/** \brief Mask the source of an isr during an interrupt storm
+ **
+ ** The simulated interrupts of the source stay pending in InterruptFlag
+ ** until IsrMonitorEnable_Arch is called.
+ **
+ ** \param[in] isr isr to be masked, ISRID_<name>
+ **/
+#define IsrMonitorDisable_Arch(isr)                 \
+{                                                   \
+   InterruptThrottled |= IsrMonitorSource[isr];     \
+}
+
+/** \brief Unmask the source of an isr masked by IsrMonitorDisable_Arch
+ **
+ ** \param[in] isr isr to be unmasked, ISRID_<name>
+ **/
+#define IsrMonitorEnable_Arch(isr)                                      \
+{                                                                       \
+   InterruptThrottled &= (InterruptFlagsType)~IsrMonitorSource[isr];    \
+}
+
+/** \brief RestartOs Arch service
+ **
+ ** This macro is called on the RestartOS to start the os again in the
+ ** application mode saved in ApplicationMode. The pending simulated
+ ** interrupts are discarded, the interrupts masked by the resources shared
+ ** with isrs are unmasked and StartOS is called on the stack used by the
+ ** first start of the os, the stack of the calling task is abandoned.
+ **/
+#if ( CPUTYPE == ia64 )
+#define RestartOs_Arch()                                                      \
+{                                                                             \
+   InterruptFlag = 0;                                                         \
+   InterruptResources = 0;                                                    \
+   /* get the Os stack of the first start */                                  \
+   __asm__ __volatile__ ("movq %0, %%rsp;" : : "g" (OsRestartStack) );        \
+   StartOS(ApplicationMode);                                                  \
+}
+#elif ( CPUTYPE == ia32 )
+#define RestartOs_Arch()                                                      \
+{                                                                             \
+   InterruptFlag = 0;                                                         \
+   InterruptResources = 0;                                                    \
+   /* get the Os stack of the first start */                                  \
+   __asm__ __volatile__ ("movl %0, %%esp;" : : "g" (OsRestartStack) );        \
+   StartOS(ApplicationMode);                                                  \
+}
+#endif
+
 /*==================[typedef]================================================*/
+/** \brief Interrupt mask type used by the resources shared with isrs */
+typedef InterruptFlagsType InterruptMaskType;
 
 /*==================[external data declaration]==============================*/
 /** \brief Interrupt Falg
@@ -332,6 +428,20 @@
  **/
 extern InterruptFlagsType InterruptFlag;
 
+/** \brief Interrupts masked by the isr monitor
+ **
+ ** Set bits mask the interrupts like InterruptMask, but they are not
+ ** changed by the interrupt services of the os.
+ **/
+extern InterruptFlagsType InterruptThrottled;
+
+/** \brief Interrupts masked by the resources shared with isrs
+ **
+ ** Set bits mask the interrupts like InterruptMask, they are set by
+ ** GetResource and cleared by ReleaseResource only.
+ **/
+extern InterruptFlagsType InterruptResources;
+
 /** \brief Osek Hardware Timer 0
  **/
 extern uint32 OsekHWTimer0;
@@ -388,6 +498,19 @@ extern uint32 OsekStack;
 #error Unknown CPUTYPE for ARCH x86
 #endif /* #if ( CPUTYPE == ia64 ) */
 
+/** \brief Os Restart Stack
+ **
+ ** This variable is used to save the Os stack of the first start of the os,
+ ** RestartOS continues on this stack. It is 0 until the os is started.
+ **/
+#if ( CPUTYPE == ia64 )
+extern uint64 OsRestartStack;
+#elif ( CPUTYPE == ia32 )
+extern uint32 OsRestartStack;
+#else /* #if ( CPUTYPE == ia64 ) */
+#error Unknown CPUTYPE for ARCH x86
+#endif /* #if ( CPUTYPE == ia64 ) */
+
 /*==================[external functions declaration]=========================*/
 /** \brief Os Interrupt Handler
  **
@@ -403,6 +526,25 @@ extern void OSEK_ISR_HWTimer0(void);
 
 extern void OSEK_ISR_HWTimer1(void);
 
+/** \brief Load the post build image
+ **
+ ** Reads the post build image named by the environment variable
+ ** POST_BUILD_IMAGE_ENV and applies it to the configuration tables. If the
+ ** variable is not set the generated configuration is kept. The process is
+ ** terminated if the image can not be read or is not valid. It is only
+ ** available if POSTBUILD is enabled.
+ **
+ ** \remarks this header is included before Os_Internal_Cfg.h, the
+ **          declaration can not depend on the configuration.
+ **/
+extern void PostBuildLoad_Arch(void);
+
+/** \brief Get the time of the trace
+ **
+ ** \return time since the start of the process in microseconds
+ **/
+extern uint32 TraceTime_Arch(void);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -111,85 +111,8 @@
    else
 #endif
    {
-      IntSecure_Start();
-
-      /* check if the task is susspended */
-      /* \req OSEK_SYS_3.1.1-1/2 The task TaskID shall be transferred from the
-       * suspended state into the ready state. */
-      if ( TasksVar[TaskID].Flags.State == TASK_ST_SUSPENDED )
-      {
-         /* increment activation counter */
-         TasksVar[TaskID].Activations++;
-         /* if the task was suspended set it to ready */
-         /* OSEK_SYS_3.1.1-2/2 The task TaskID shall be transferred from the
-          * suspended state into the ready state.*/
-         TasksVar[TaskID].Flags.State = TASK_ST_READY;
-         /* clear all events */
-         /* \req OSEK_SYS_3.1.6 When an extended task is transferred from
-          * suspended state into ready state all its events are cleared. */
-         TasksVar[TaskID].Events = 0;
-         /* add the task to the ready list */
-         AddReady(TaskID);
-      }
-      else
-      {
-         /* task is not suspended */
-
-         /* check if the task is a extended task */
-         if ( TasksConst[TaskID].ConstFlags.Extended )
-         {
-            /* return E_OS_LIMIT */
-            /* \req OSEK_SYS_3.1.5-2/3 If other than E_OK is returned the activation
-             * is ignored */
-            /* \req OSEK_SYS_3.1.7-2/3 Possible return values in Standard mode are
-             * E_OK or E_OS_LIMIT */
-            ret = E_OS_LIMIT;
-         }
-         else
-         {
-            /* check if more activations are allowed */
-            if ( TasksVar[TaskID].Activations < TasksConst[TaskID].MaxActivations )
-            {
-               /* increment activation counter */
-               TasksVar[TaskID].Activations++;
-               /* add the task to the ready list */
-               AddReady(TaskID);
-            }
-            else
-            {
-               /* maximal activation reached, return E_OS_LIMIT */
-               /* \req OSEK_SYS_3.1.5-3/3 If other than E_OK is returned the
-                * activation is ignored */
-               /* \req OSEK_SYS_3.1.7-3/3 Possible return values in Standard mode are
-                * E_OK or E_OS_LIMIT */
-               ret = E_OS_LIMIT;
-            }
-         }
-      }
-
-      IntSecure_End();
-
-#if (NON_PREEMPTIVE == OSEK_DISABLE)
-      /* check if called from a Task Context */
-      if ( GetCallingContext() ==  CONTEXT_TASK )
-      {
-         if ( ( TasksConst[GetRunningTask()].ConstFlags.Preemtive ) &&
-              ( ret == E_OK ) )
-         {
-            /* This is needed to avoid Schedule to perform standard checks
-             * which are done when normally called from the application
-             * the actual context has to be task so is not need to store it */
-            SetActualContext(CONTEXT_SYS);
-
-            /* \req OSEK_SYS_3.1.4 Rescheduling shall take place only if called from a
-             * preemptable task. */
-            (void)Schedule();
-
-            /* restore the old context */
-            SetActualContext(CONTEXT_TASK);
-         }
-      }
-#endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
+      /* activations without argument get 0 */
+      ret = ActivateTaskInternal(TaskID, 0);
    }
 
 #if (HOOK_ERRORHOOK == OSEK_ENABLE)
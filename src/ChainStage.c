@@ -0,0 +1,205 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os ChainStage Implementation File
+ **
+ ** This file implements the ChainStage API
+ **
+ ** \file ChainStage.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (PIPELINES_COUNT != 0)
+StatusType ChainStage
+(
+   PipelineType PipelineID
+)
+{
+   uint8f stage;
+   uint32 now;
+   TaskType next;
+   PipelineStageVarType * var;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( PipelineID >= PIPELINES_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else if ( GetCallingContext() != CONTEXT_TASK )
+   {
+      ret = E_OS_CALLEVEL;
+   }
+#if ( (RESOURCES_COUNT != 0) || (NO_RES_SCHEDULER == OSEK_DISABLE) )
+   /* the checks of ChainTask and TerminateTask are performed before the
+    * hand over, they can not fail afterwards */
+   else if (
+#if (RESOURCES_COUNT != 0)
+             ( TasksVar[GetRunningTask()].Resources != 0 )
+#endif /* #if (RESOURCES_COUNT != 0) */
+#if ( (RESOURCES_COUNT != 0) && (NO_RES_SCHEDULER == OSEK_DISABLE) )
+               ||
+#endif /* #if ( (RESOURCES_COUNT != 0) && (NO_RES_SCHEDULER == OSEK_DISABLE) ) */
+#if (NO_RES_SCHEDULER == OSEK_DISABLE)
+             ( TasksVar[GetRunningTask()].ActualPriority == TASK_MAX_PRIORITY )
+#endif /* #if (NO_RES_SCHEDULER == OSEK_DISABLE) */
+           )
+   {
+      ret = E_OS_RESOURCE;
+   }
+#endif /* #if ( (RESOURCES_COUNT != 0) || (NO_RES_SCHEDULER == OSEK_DISABLE) ) */
+   else
+#endif
+   {
+      stage = PipelineGetStage(PipelineID, GetRunningTask());
+
+      if ( stage == PIPELINE_INVALID_STAGE )
+      {
+         ret = E_OS_ACCESS;
+      }
+      else
+      {
+         var = &PipelineStagesVar[stage];
+         now = PipelineGetTime();
+
+         if ( ( stage == PipelinesConst[PipelineID].FirstStage ) &&
+              ( var->Started == FALSE ) )
+         {
+            /* the first stage has not called GetStageBuffers */
+            var->Start = now;
+            var->FrameStart = now;
+         }
+         var->Started = FALSE;
+
+         if ( stage == PipelinesConst[PipelineID].LastStage )
+         {
+            PipelineUpdateStats(stage, now);
+
+            /* the frame leaves the pipeline, does not return */
+            (void)TerminateTask();
+         }
+         else
+         {
+            next = PipelineStagesConst[stage + 1].Task;
+
+            IntSecure_Start();
+
+            if ( TasksVar[next].Activations >= TasksConst[next].MaxActivations )
+            {
+               /* the next stage still uses the other buffer, drop the
+                * frame */
+               var->Stats.Overruns++;
+
+               IntSecure_End();
+
+               ret = E_OS_LIMIT;
+            }
+            else
+            {
+#if (HOOK_POSTTASKHOOK == OSEK_ENABLE)
+               PostTaskHook();
+#endif /* #if (HOOK_POSTTASKHOOK == OSEK_ENABLE) */
+
+#if (STACK_CHECK_TYPE != STACK_CHECK_OFF)
+               CheckStackOverflow();
+#if (STACK_CHECK_TYPE == STACK_CHECK_OVERFLOW_SIZE)
+               CalculateUsedStack();
+#endif
+#endif
+
+               /* hand over the filled buffer, the next frame is filled in
+                * the other one */
+               var->Ready = var->Fill;
+               var->Fill ^= 1U;
+               PipelineStagesVar[stage + 1].Start = now;
+               PipelineStagesVar[stage + 1].FrameStart = var->FrameStart;
+
+               PipelineUpdateStats(stage, now);
+
+               /* chain the next stage in the same critical section as the
+                * check of its activations, an alarm or an isr can not
+                * activate it in between */
+               ChainTaskInternal(next);
+
+               IntSecure_End();
+
+               /* does not return */
+               (void)Schedule();
+            }
+         }
+      }
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_ChainStage);
+      SetError_Param1(PipelineID);
+      SetError_Ret(ret);
+      SetError_Msg("ChainStage returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
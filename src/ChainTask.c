@@ -133,55 +133,8 @@ StatusType ChainTask
 
       IntSecure_Start();
 
-      /* release internal resources */
-      /* \req OSEK_SYS_3.3.4 If an internal resource is assigned to the calling
-       ** task it shall be automatically released, even if the succeeding task is
-       ** identical with the current task. */
-      ReleaseInternalResources();
-
-      /* decrement activations for this task */
-      TasksVar[GetRunningTask()].Activations--;
-
-      if (TasksVar[GetRunningTask()].Activations == 0)
-      {
-         /* if no more activations set state to suspended */
-         /* \req OSEK_SYS_3.3.1-1/2 This service causes the termination of the calling task. */
-         TasksVar[GetRunningTask()].Flags.State = TASK_ST_SUSPENDED;
-      }
-      else
-      {
-         /* if more activations set state to ready */
-         /* \req OSEK_SYS_3.3.1-2/2 This service causes the termination of the calling task. */
-         TasksVar[GetRunningTask()].Flags.State = TASK_ST_READY;
-      }
-
-      /* set entry point for this task again */
-      /* \req OSEK_SYS_3.1.2-1/3 The operating system shall ensure that the task
-         * code is being executed from the first statement. */
-      SetEntryPoint(GetRunningTask());
-      /* remove ready list */
-      RemoveTask(GetRunningTask());
-      /* set running task to invalid */
-      SetRunningTask(INVALID_TASK);
-      /* set actual context task */
-      SetActualContext(CONTEXT_SYS);
-      /* increment activations */
-      TasksVar[taskid].Activations++;
-      /* activate task */
-      /* \req OSEK_SYS_3.3.2 After termination of the calling task a succeeding
-       **  task TaskID shall be activated. */
-      /* \req OSEK_SYS_3.3.3 If the succeeding task is identical with the current
-       ** task, this does not result in multiple requests. The task is not
-       ** transferred to the suspended state, but will immediately become ready
-       ** again. */
-      AddReady(taskid);
-
-      if(TasksVar[taskid].Flags.State ==  TASK_ST_SUSPENDED)
-      {
-         /* \req OSEK_SYS_3.3.7 When an extended task is transferred from suspended
-          ** state into ready state all its events are cleared.*/
-         TasksVar[taskid].Events = 0;
-      }
+      /* terminate the running task and activate the succeeding one */
+      ChainTaskInternal(taskid);
 
       IntSecure_End();
 
@@ -0,0 +1,112 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os GetActivationArg Implementation File
+ **
+ ** This file implements the GetActivationArg API
+ **
+ ** \file GetActivationArg.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+StatusType GetActivationArg
+(
+   ActivationArgRefType Arg
+)
+{
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( GetCallingContext() != CONTEXT_TASK )
+   {
+      ret = E_OS_CALLEVEL;
+   }
+   else
+#endif
+   if ( NULL == TasksConst[GetRunningTask()].ArgQueue )
+   {
+      ret = E_OS_ACCESS;
+   }
+   else
+   {
+      /* the argument of the running activation is the first one of the
+       * queue, it is only dropped when the task terminates */
+      *Arg = TasksConst[GetRunningTask()].ArgQueue[
+                TasksVar[GetRunningTask()].ArgQueueStart];
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1U))
+   {
+      SetError_Api(OSServiceId_GetActivationArg);
+      SetError_Param1((unsigned int)Arg);
+      SetError_Ret(ret);
+      SetError_Msg("GetActivationArg returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
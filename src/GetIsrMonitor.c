@@ -0,0 +1,111 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os GetIsrMonitor Implementation File
+ **
+ ** This file implements the GetIsrMonitor API
+ **
+ ** \file GetIsrMonitor.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+StatusType GetIsrMonitor
+(
+   ISRType IsrID,
+   IsrMonitorRefType Monitor
+)
+{
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( IsrID >= ISR_MONITOR_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else
+#endif /* #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+   {
+      /* the statistics are updated by the isrs */
+      IntSecure_Start();
+
+      *Monitor = IsrMonitorVar[IsrID].Stats;
+
+      IntSecure_End();
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_GetIsrMonitor);
+      SetError_Param1(IsrID);
+      SetError_Param2((unsigned int)Monitor);
+      SetError_Ret(ret);
+      SetError_Msg("GetIsrMonitor returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,122 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os GetPipelineStats Implementation File
+ **
+ ** This file implements the GetPipelineStats API
+ **
+ ** \file GetPipelineStats.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (PIPELINES_COUNT != 0)
+StatusType GetPipelineStats
+(
+   PipelineType PipelineID,
+   TaskType StageID,
+   PipelineStatsRefType Stats
+)
+{
+   uint8f stage;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( PipelineID >= PIPELINES_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else
+#endif
+   {
+      stage = PipelineGetStage(PipelineID, StageID);
+
+      if ( stage == PIPELINE_INVALID_STAGE )
+      {
+         ret = E_OS_ID;
+      }
+      else
+      {
+         /* the stage may update its statistics meanwhile */
+         IntSecure_Start();
+
+         *Stats = PipelineStagesVar[stage].Stats;
+
+         IntSecure_End();
+      }
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_GetPipelineStats);
+      SetError_Param1(PipelineID);
+      SetError_Param2(StageID);
+      SetError_Param3((unsigned int)Stats);
+      SetError_Ret(ret);
+      SetError_Msg("GetPipelineStats returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
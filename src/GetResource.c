@@ -53,6 +53,11 @@
 #include "Os_Internal.h"
 
 /*==================[macros and definitions]=================================*/
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+#ifndef RaiseInterruptMask_Arch
+#error resources used by isrs are not supported on this architecture, RaiseInterruptMask_Arch is not defined
+#endif
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
 
 /*==================[internal data declaration]==============================*/
 
@@ -103,6 +108,18 @@ StatusType GetResource
       if ( ResID != RES_SCHEDULER )
 #endif /* #if (NO_RES_SCHEDULER == OSEK_DISABLE) */
    {
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+      if ( GetCallingContext() == CONTEXT_ISR2 )
+      {
+         /* an isr 2 can only take the resources used by isrs */
+         if ( ( IsrResources & ( 1 << ResID ) ) ||
+              ( ( OSEK_ISR_RESOURCES_MASK & ( 1 << ResID ) ) == 0 ) )
+         {
+            ret = E_OS_ACCESS;
+         }
+      }
+      else
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
       if ( ( TasksVar[GetRunningTask()].Resources & ( 1 << ResID ) ) ||
            ( ( TasksConst[GetRunningTask()].ResourcesMask & ( 1 << ResID ) ) == 0 ) )
       {
@@ -137,15 +154,32 @@ StatusType GetResource
 /* only if one or more resources were defined */
 #if (RESOURCES_COUNT != 0)
       {
-         /* \req OSEK_SYS_3.13.1 This call serves to enter critical sections in
-          * the code that are assigned to the resource referenced by ResID */
-         if ( TasksVar[GetRunningTask()].ActualPriority < ResourcesPriority[ResID])
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+         if ( OSEK_ISR_RESOURCES_MASK & ( 1 << ResID ) )
          {
-            TasksVar[GetRunningTask()].ActualPriority = ResourcesPriority[ResID];
+            /* mask only the interrupts up to the ceiling of the isrs which
+             * use the resource, other interrupts keep running */
+            RaiseInterruptMask_Arch(ResourcesInterruptMask[ResID], ResourcesSavedMask[ResID]);
          }
 
-         /* mark resource as set */
-         TasksVar[GetRunningTask()].Resources |= ( 1 << ResID );
+         if ( GetCallingContext() == CONTEXT_ISR2 )
+         {
+            /* the priority of the interrupted task is not changed */
+            IsrResources |= ( 1 << ResID );
+         }
+         else
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
+         {
+            /* \req OSEK_SYS_3.13.1 This call serves to enter critical sections in
+             * the code that are assigned to the resource referenced by ResID */
+            if ( TasksVar[GetRunningTask()].ActualPriority < ResourcesPriority[ResID])
+            {
+               TasksVar[GetRunningTask()].ActualPriority = ResourcesPriority[ResID];
+            }
+
+            /* mark resource as set */
+            TasksVar[GetRunningTask()].Resources |= ( 1 << ResID );
+         }
       }
 #endif /* #if (RESOURCES_COUNT != 0) */
 
@@ -73,8 +73,9 @@ StatusType GetStackSize
 
    if (TASKS_COUNT > TaskID)
    {
-      /* 4 extra bytes are used to verify an overflow */
-      *StackSize = TasksConst[TaskID].StackSize-4;
+      /* 4 extra bytes are used to verify an overflow and the
+       * TASK_STACK_ADDITIONAL_SIZE bytes are reserved by the architecture */
+      *StackSize = TasksConst[TaskID].StackSize - 4 - TASK_STACK_ADDITIONAL_SIZE;
       ret = E_OK;
    }
 
@@ -53,15 +53,507 @@
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+/** \brief Returns TRUE if TaskID1 shall be placed before TaskID2 in the heap
+ **
+ ** The task with the earlier deadline goes first, on equal deadlines the
+ ** task with the higher preemption level goes first.
+ **/
+static boolean EdfHeapBefore(TaskType TaskID1, TaskType TaskID2);
+
+/** \brief Moves the task on Position towards the top of the deadline heap
+ **/
+static void EdfHeapUp(TaskTotalType Position);
+
+/** \brief Moves the task on Position towards the bottom of the deadline heap
+ **/
+static void EdfHeapDown(TaskTotalType Position);
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (ALARMS_COUNT != 0)
+/** \brief Advance a counter and process its alarms
+ **
+ ** The actions of the expired alarms are not executed, the expirations of
+ ** the alarms with the action INCREMENT are added to CounterPending and the
+ ** other alarms are queued in ExpiredAlarms. It shall be called within
+ ** IntSecure.
+ **
+ ** \param[in] CounterID id of the counter to be incremented
+ ** \param[in] Increment amount of times to increment the counter
+ ** \param[out] Cascade set to TRUE if a running alarm with the action
+ **             INCREMENT was processed
+ ** \return increments of the counter until the next expiration of one of its
+ **         alarms, -1 if no alarm is running
+ **/
+static AlarmIncrementType AdvanceCounter(CounterType CounterID, CounterIncrementType Increment, boolean * Cascade);
+
+/** \brief Execute the action of an expired alarm
+ **
+ ** \param[in] AlarmID id of the alarm
+ **/
+static void AlarmAction(AlarmType AlarmID);
+
+/** \brief Next expiration of an alarm of a counter or of its derived counters
+ **
+ ** The derived counters are the counters incremented by alarms of the
+ ** counter. The counters are resolved in the reverse order of CountersOrder,
+ ** the derived counters of a counter are resolved before it.
+ **
+ ** \param[in] CounterID id of the counter
+ ** \return increments of the counter until the next expiration of an alarm,
+ **         -1 if no alarm is running
+ **/
+static AlarmIncrementType CounterNextExpiration(CounterType CounterID);
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+/** \brief Link a free node of a task to a ready list
+ **
+ ** \param[in] List index of the ready list
+ ** \param[in] TaskID task of the node, it shall have a free node
+ ** \param[in] First TRUE to link the node at the begin of the list, FALSE
+ **            to link it at the end
+ **/
+static void ReadyLink(TaskTotalType List, TaskType TaskID, boolean First);
+
+/** \brief Unlink a node of a ready list and free it
+ **
+ ** \param[in] List index of the ready list
+ ** \param[in] Node node of the list to be unlinked
+ **/
+static void ReadyUnlink(TaskTotalType List, TaskTotalType Node);
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
 
 /*==================[internal data definition]===============================*/
+#if (ALARMS_COUNT != 0)
+/** \brief Increments of each counter not yet processed by the cascade
+ **
+ ** Only used within the IntSecure section of IncrementCounter, it is zero
+ ** outside of it.
+ **/
+static CounterIncrementType CounterPending[COUNTERS_COUNT];
+
+/** \brief Expirations of each alarm whose actions are not yet executed
+ **/
+static AlarmIncrementType AlarmExpirations[ALARMS_COUNT];
+
+/** \brief Queue of the alarms with expirations not yet executed
+ **
+ ** The alarms are queued in order of expiration, an alarm is queued once
+ ** while AlarmExpirations of it is not zero, so ALARMS_COUNT entries are
+ ** enough. The queue is shared by all the calls to IncrementCounter, a
+ ** nested call executes the actions queued by the interrupted one too.
+ **/
+static AlarmType ExpiredAlarms[ALARMS_COUNT];
+
+/** \brief First entry of ExpiredAlarms
+ **/
+static uint8f ExpiredFirst;
+
+/** \brief Count of entries of ExpiredAlarms
+ **/
+static uint8f ExpiredCount;
+#endif /* #if (ALARMS_COUNT != 0) */
 
 /*==================[external data definition]===============================*/
-TaskType RunningTask;
+OSEK_HOT_DATA TaskType RunningTask;
+
+OSEK_HOT_DATA ContextType ActualContext;
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+DeadlineType EdfTime;
+
+TaskType EdfHeap[TASKS_COUNT];
+
+TaskTotalType EdfHeapCount;
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (PARTITIONS_COUNT != 0)
+PartitionType ActivePartition;
+
+uint8 PartitionWindow;
 
-ContextType ActualContext;
+TickType PartitionWindowTime;
+
+boolean PartitionSwitched;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+TaskType RoundRobinTask;
+
+TickType RoundRobinTime;
+
+boolean RoundRobinExpired;
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+uint32 Isr1PendingActivations[ISR1_PENDING_WORDS];
+
+uint32 Isr1PendingEventTasks[ISR1_PENDING_WORDS];
+
+EventMaskType Isr1PendingEvents[TASKS_COUNT];
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
 
 /*==================[internal functions definition]==========================*/
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+static boolean EdfHeapBefore(TaskType TaskID1, TaskType TaskID2)
+{
+   boolean ret;
+
+   if (TasksVar[TaskID1].Deadline != TasksVar[TaskID2].Deadline)
+   {
+      ret = DeadlineBefore(TasksVar[TaskID1].Deadline, TasksVar[TaskID2].Deadline);
+   }
+   else
+   {
+      ret = ( TasksConst[TaskID1].StaticPriority > TasksConst[TaskID2].StaticPriority );
+   }
+
+   return ret;
+}
+
+static void EdfHeapUp(TaskTotalType Position)
+{
+   TaskType task = EdfHeap[Position];
+   TaskTotalType parent;
+   boolean found = FALSE;
+
+   while ( ( Position > 0 ) && (!found) )
+   {
+      parent = ( Position - 1 ) >> 1;
+
+      if (EdfHeapBefore(task, EdfHeap[parent]))
+      {
+         /* move the parent one level down */
+         EdfHeap[Position] = EdfHeap[parent];
+         TasksVar[EdfHeap[Position]].HeapIndex = Position;
+         Position = parent;
+      }
+      else
+      {
+         found = TRUE;
+      }
+   }
+
+   EdfHeap[Position] = task;
+   TasksVar[task].HeapIndex = Position;
+}
+
+static void EdfHeapDown(TaskTotalType Position)
+{
+   TaskType task = EdfHeap[Position];
+   TaskTotalType child;
+   boolean found = FALSE;
+
+   while ( ( ( ( Position << 1 ) + 1 ) < EdfHeapCount ) && (!found) )
+   {
+      /* take the earlier of both children */
+      child = ( Position << 1 ) + 1;
+      if ( ( ( child + 1 ) < EdfHeapCount ) &&
+           ( EdfHeapBefore(EdfHeap[child + 1], EdfHeap[child]) ) )
+      {
+         child++;
+      }
+
+      if (EdfHeapBefore(EdfHeap[child], task))
+      {
+         /* move the child one level up */
+         EdfHeap[Position] = EdfHeap[child];
+         TasksVar[EdfHeap[Position]].HeapIndex = Position;
+         Position = child;
+      }
+      else
+      {
+         found = TRUE;
+      }
+   }
+
+   EdfHeap[Position] = task;
+   TasksVar[task].HeapIndex = Position;
+}
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (ALARMS_COUNT != 0)
+static OSEK_HOT_CODE AlarmIncrementType AdvanceCounter(CounterType CounterID, CounterIncrementType Increment, boolean * Cascade)
+{
+   uint8f loopi;
+   AlarmType AlarmID;
+   AlarmIncrementType MinimalCount = -1;
+   AlarmIncrementType TmpCount;
+   AlarmIncrementType Expirations;
+   uint8f Last;
+
+   /* increment counter */
+   CountersVar[CounterID].Time+=Increment;
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+   if (EDF_COUNTER == CounterID)
+   {
+      /* advance the time base of the deadlines */
+      EdfTime += Increment;
+   }
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+   if (ROUND_ROBIN_COUNTER == CounterID)
+   {
+      /* consume the time slice of the running task */
+      RoundRobinTick(Increment);
+   }
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
+#if (PARTITIONS_COUNT != 0)
+   if (PARTITION_COUNTER == CounterID)
+   {
+      PartitionWindowTime += Increment;
+
+      /* go to the next window if the actual one is over */
+      while (PartitionWindowTime >= PartitionWindows[PartitionWindow].Duration)
+      {
+         PartitionWindowTime -= PartitionWindows[PartitionWindow].Duration;
+
+         PartitionWindow++;
+         if (PartitionWindow >= PARTITION_WINDOWS_COUNT)
+         {
+            /* start a new major frame */
+            PartitionWindow = 0;
+         }
+      }
+
+      if (ActivePartition != PartitionWindows[PartitionWindow].Partition)
+      {
+         /* switch the partition, the scheduler is called by the counter
+          * interrupt handler */
+         ActivePartition = PartitionWindows[PartitionWindow].Partition;
+         PartitionSwitched = TRUE;
+      }
+   }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+   /* check if the timer has an overvlow */
+   while ( CountersVar[CounterID].Time >= CountersConst[CounterID].MaxAllowedValue )
+   {
+      /* reset counter */
+      CountersVar[CounterID].Time -= CountersConst[CounterID].MaxAllowedValue;
+   }
+
+   /* for alarms on this counter */
+   for(loopi = 0; loopi < CountersConst[CounterID].AlarmsCount; loopi++)
+   {
+      /* get alarm id */
+      AlarmID = CountersConst[CounterID].AlarmRef[loopi];
+
+      /* check if the alarm is eanble */
+      if (AlarmsVar[AlarmID].AlarmState == 1)
+      {
+         /* increment alarm and get the next alarm time */
+         TmpCount = IncrementAlarm(AlarmID, Increment, &Expirations);
+
+         if (AlarmsConst[AlarmID].AlarmAction == INCREMENT)
+         {
+            /* the next expiration has to be resolved through the cascade */
+            *Cascade = TRUE;
+
+            /* the counter of the alarm is incremented after this one, once
+             * with the sum of its increments */
+            CounterPending[AlarmsConst[AlarmID].AlarmActionInfo.Counter] += Expirations;
+         }
+         else if (Expirations > 0)
+         {
+            /* the action is executed after the cascade */
+            if (0 == AlarmExpirations[AlarmID])
+            {
+               Last = ExpiredFirst + ExpiredCount;
+               if (Last >= ALARMS_COUNT)
+               {
+                  Last -= ALARMS_COUNT;
+               }
+               ExpiredAlarms[Last] = AlarmID;
+               ExpiredCount++;
+            }
+            AlarmExpirations[AlarmID] += Expirations;
+         }
+         else
+         {
+            /* the alarm has not expired */
+         }
+
+         /* if the actual count is smaller */
+         if (MinimalCount > TmpCount)
+         {
+            /* set it as minimal count */
+            MinimalCount = TmpCount;
+         }
+      }
+   }
+
+   /* return the minimal increment */
+   return MinimalCount;
+}
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+static OSEK_HOT_CODE AlarmIncrementType CounterNextExpiration(CounterType CounterID)
+{
+   AlarmIncrementType Next[COUNTERS_COUNT];
+   AlarmIncrementType MinimalCount;
+   AlarmIncrementType TmpCount;
+   AlarmIncrementType Derived;
+   AlarmType AlarmID;
+   CounterType Counter;
+   uint8f loopi;
+   uint8f loopj;
+
+   /* the derived counters of a counter follow it in CountersOrder, in the
+    * reverse order they are resolved before the counter */
+   for(loopi = COUNTERS_COUNT; loopi > 0; loopi--)
+   {
+      Counter = CountersOrder[loopi - 1];
+      MinimalCount = (AlarmIncrementType)-1;
+
+      for(loopj = 0; loopj < CountersConst[Counter].AlarmsCount; loopj++)
+      {
+         AlarmID = CountersConst[Counter].AlarmRef[loopj];
+
+         if (AlarmsVar[AlarmID].AlarmState == 1)
+         {
+            TmpCount = AlarmsVar[AlarmID].AlarmTime;
+
+            if (AlarmsConst[AlarmID].AlarmAction == INCREMENT)
+            {
+               /* each expiration is one increment of the derived counter */
+               Derived = Next[AlarmsConst[AlarmID].AlarmActionInfo.Counter];
+
+               if (Derived == (AlarmIncrementType)-1)
+               {
+                  /* nothing expires on the derived counter */
+                  TmpCount = (AlarmIncrementType)-1;
+               }
+               else if (Derived > 1)
+               {
+                  if ( (AlarmsVar[AlarmID].AlarmCycleTime == 0) ||
+                       ( (Derived - 1) > ( ( (AlarmIncrementType)-2 - TmpCount ) /
+                                           AlarmsVar[AlarmID].AlarmCycleTime ) ) )
+                  {
+                     /* a single shot alarm increments only once, a too
+                      * far expiration is saturated */
+                     TmpCount = (AlarmsVar[AlarmID].AlarmCycleTime == 0) ?
+                        (AlarmIncrementType)-1 : (AlarmIncrementType)-2;
+                  }
+                  else
+                  {
+                     TmpCount += AlarmsVar[AlarmID].AlarmCycleTime * (Derived - 1);
+                  }
+               }
+            }
+
+            /* if the actual count is smaller */
+            if (MinimalCount > TmpCount)
+            {
+               /* set it as minimal count */
+               MinimalCount = TmpCount;
+            }
+         }
+      }
+
+      Next[Counter] = MinimalCount;
+   }
+
+   return Next[CounterID];
+}
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+static OSEK_HOT_CODE void AlarmAction(AlarmType AlarmID)
+{
+   /* check alarm actions differents to INCREMENT */
+   switch(AlarmsConst[AlarmID].AlarmAction)
+   {
+      case ACTIVATETASK:
+         /* activate task */
+         ActivateTask(AlarmsConst[AlarmID].AlarmActionInfo.TaskID);
+         break;
+      case ALARMCALLBACK:
+         /* callback */
+         if(AlarmsConst[AlarmID].AlarmActionInfo.CallbackFunction != NULL)
+         {
+            AlarmsConst[AlarmID].AlarmActionInfo.CallbackFunction();
+         }
+         break;
+#if (NO_EVENTS == OSEK_DISABLE)
+      case SETEVENT:
+         /* set event */
+         SetEvent(AlarmsConst[AlarmID].AlarmActionInfo.TaskID, AlarmsConst[AlarmID].AlarmActionInfo.Event);
+         break;
+#endif /* #if (NO_EVENTS == OSEK_DISABLE) */
+      default:
+         /* some error */
+         /* possibly TODO, report an error */
+         break;
+   }
+}
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+static OSEK_HOT_CODE void ReadyLink(TaskTotalType List, TaskType TaskID, boolean First)
+{
+   TaskTotalType node = TasksConst[TaskID].ReadyNode;
+
+   /* each activation of the task has a node, search a free one */
+   while (READY_NODE_FREE != ReadyNodes[node].Next)
+   {
+      node++;
+   }
+
+   if (0 == ReadyVar[List].ListCount)
+   {
+      ReadyNodes[node].Next = READY_NODE_END;
+      ReadyNodes[node].Prev = READY_NODE_END;
+      ReadyVar[List].ListStart = node;
+      ReadyVar[List].ListEnd = node;
+   }
+   else if (TRUE == First)
+   {
+      ReadyNodes[node].Next = ReadyVar[List].ListStart;
+      ReadyNodes[node].Prev = READY_NODE_END;
+      ReadyNodes[ReadyVar[List].ListStart].Prev = node;
+      ReadyVar[List].ListStart = node;
+   }
+   else
+   {
+      ReadyNodes[node].Next = READY_NODE_END;
+      ReadyNodes[node].Prev = ReadyVar[List].ListEnd;
+      ReadyNodes[ReadyVar[List].ListEnd].Next = node;
+      ReadyVar[List].ListEnd = node;
+   }
+
+   ReadyVar[List].ListCount++;
+}
+
+static OSEK_HOT_CODE void ReadyUnlink(TaskTotalType List, TaskTotalType Node)
+{
+   if (READY_NODE_END == ReadyNodes[Node].Prev)
+   {
+      ReadyVar[List].ListStart = ReadyNodes[Node].Next;
+   }
+   else
+   {
+      ReadyNodes[ReadyNodes[Node].Prev].Next = ReadyNodes[Node].Next;
+   }
+
+   if (READY_NODE_END == ReadyNodes[Node].Next)
+   {
+      ReadyVar[List].ListEnd = ReadyNodes[Node].Prev;
+   }
+   else
+   {
+      ReadyNodes[ReadyNodes[Node].Next].Prev = ReadyNodes[Node].Prev;
+   }
+
+   ReadyNodes[Node].Next = READY_NODE_FREE;
+   ReadyVar[List].ListCount--;
+}
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
 
 /*==================[external functions definition]==========================*/
 #if (STACK_CHECK_TYPE != STACK_CHECK_OFF)
@@ -112,82 +604,529 @@ void CalculateUsedStack(void)
 #endif
 #endif
 
-void AddReady(TaskType TaskID)
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_FIXED)
+OSEK_HOT_CODE void AddReady(TaskType TaskID)
 {
    TaskPriorityType priority;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE)
    TaskRefType readylist;
    TaskTotalType maxtasks;
    TaskTotalType position;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE) */
 
    /* get task priority */
-   priority = TasksConst[TaskID].StaticPriority;
+   priority = GetBasePriority(TaskID);
 
    /* set the start priority for this task */
    TasksVar[TaskID].ActualPriority = priority;
 
-   /* conver the priority to the array index */
-   /* do not remove the -1 is needed. for example if READYLIST_COUNT is 4
-   * the valida entries for this array are between 0 and 3, so the -1 is needed
-   * since the lower priority is 0.
-   */
-   priority = (READYLISTS_COUNT-1)-priority;
+   /* conver the priority to the array index */
+   /* do not remove the -1 is needed. for example if READYLIST_COUNT is 4
+   * the valida entries for this array are between 0 and 3, so the -1 is needed
+   * since the lower priority is 0.
+   */
+   priority = (READYLISTS_COUNT-1)-priority;
+
+#if (PARTITIONS_COUNT != 0)
+   /* each partition has its own ready lists */
+   priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   /* link a node of the task at the end of the list */
+   ReadyLink(priority, TaskID, FALSE);
+#else
+   /* get ready list */
+   readylist = ReadyConst[priority].TaskRef;
+   /* get max number of entries */
+   maxtasks = ReadyConst[priority].ListLength;
+
+   /* get position incrementtion */
+   position = ReadyVar[priority].ListStart + ReadyVar[priority].ListCount;
+
+   /* go arround maxtasks */
+   /* this if works like  % instruction */
+   if (position >= maxtasks)
+   {
+      position -= maxtasks;
+   }
+
+   /* set the task id in ready the list */
+   readylist[position] = TaskID;
+   /* increment the list counter */
+   ReadyVar[priority].ListCount++;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+}
+
+OSEK_HOT_CODE void RemoveTask
+(
+   TaskType TaskID
+)
+{
+   TaskPriorityType priority;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE)
+   TaskTotalType maxtasks;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE) */
+
+   /* get task priority */
+   priority = GetBasePriority(TaskID);
+   /* conver the priority to the array index */
+   /* do not remove the -1 is needed. for example if READYLIST_COUNT is 4
+   * the valida entries for this array are between 0 and 3, so the -1 is needed
+   * since the lower priority is 0.
+   */
+   priority = (READYLISTS_COUNT-1)-priority;
+
+#if (PARTITIONS_COUNT != 0)
+   /* each partition has its own ready lists */
+   priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   /* the first node of the list is the one of the running task */
+   ReadyUnlink(priority, ReadyVar[priority].ListStart);
+#else
+   /* get max number of entries */
+   maxtasks = ReadyConst[priority].ListLength;
+
+   /* increment the ListStart */
+   ReadyVar[priority].ListStart = ReadyVar[priority].ListStart + 1;
+
+   /* go arround maxtasks */
+   /* this if works like a % instruction */
+   if (ReadyVar[priority].ListStart >= maxtasks)
+   {
+      ReadyVar[priority].ListStart -= maxtasks;
+   }
+
+   /* decrement the count of ready tasks */
+   ReadyVar[priority].ListCount--;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+}
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+void InitReadyNodes
+(
+   void
+)
+{
+   TaskTotalType loopi;
+   TaskTotalType count;
+   TaskTotalType position;
+   TaskType TaskID;
+   TaskActivationsType activation;
+
+   for (TaskID = 0; TaskID < TASKS_COUNT; TaskID++)
+   {
+      for (activation = 0; activation < TasksConst[TaskID].MaxActivations; activation++)
+      {
+         ReadyNodes[TasksConst[TaskID].ReadyNode + activation].Task = TaskID;
+         ReadyNodes[TasksConst[TaskID].ReadyNode + activation].Next = READY_NODE_FREE;
+      }
+   }
+
+   /* the boot image has the entries of the auto start tasks in the ready
+    * lists, link them in the same order. Without boot image the lists are
+    * empty */
+   for (loopi = 0; loopi < (sizeof(ReadyVar) / sizeof(ReadyVar[0])); loopi++)
+   {
+      count = ReadyVar[loopi].ListCount;
+      position = ReadyVar[loopi].ListStart;
+      ReadyVar[loopi].ListCount = 0;
+
+      while (0 != count)
+      {
+         ReadyLink(loopi, ReadyConst[loopi].TaskRef[position], FALSE);
+
+         position++;
+         /* this if works like a % instruction */
+         if (position >= ReadyConst[loopi].ListLength)
+         {
+            position = 0;
+         }
+         count--;
+      }
+   }
+}
+
+void MoveReady
+(
+   TaskType TaskID,
+   TaskPriorityType Priority
+)
+{
+   TaskPriorityType priority;
+   TaskTotalType node;
+   TaskActivationsType loopi;
+   TaskActivationsType entries = 0;
+   boolean first;
+
+   /* only ready and running tasks are in a ready list, each activation of
+    * a basic task has its own entry */
+   if ( ( TASK_ST_READY == TasksVar[TaskID].Flags.State ) ||
+        ( TASK_ST_RUNNING == TasksVar[TaskID].Flags.State ) )
+   {
+      entries = TasksVar[TaskID].Activations;
+   }
+
+   if (0 != entries)
+   {
+      /* conver the priority to the array index */
+      priority = (READYLISTS_COUNT-1)-GetBasePriority(TaskID);
+
+#if (PARTITIONS_COUNT != 0)
+      /* each partition has its own ready lists */
+      priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+      /* the linked nodes of the task are its entries of the list */
+      for (loopi = 0; loopi < TasksConst[TaskID].MaxActivations; loopi++)
+      {
+         node = TasksConst[TaskID].ReadyNode + loopi;
+         if (READY_NODE_FREE != ReadyNodes[node].Next)
+         {
+            ReadyUnlink(priority, node);
+         }
+      }
+   }
+
+   /* set the new priority */
+   TasksVar[TaskID].BasePriority = Priority;
+
+   if (0 != entries)
+   {
+      /* conver the priority to the array index */
+      priority = (READYLISTS_COUNT-1)-Priority;
+
+#if (PARTITIONS_COUNT != 0)
+      /* each partition has its own ready lists */
+      priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+      /* a running or preempted task goes before the tasks which have not
+       * been started yet, the queued activations are added at the end */
+      first = ( ( TASK_ST_RUNNING == TasksVar[TaskID].Flags.State ) ||
+                ( 1 == TasksVar[TaskID].Flags.Preempted ) );
+
+      while (0 != entries)
+      {
+         ReadyLink(priority, TaskID, first);
+         first = FALSE;
+         entries--;
+      }
+   }
+}
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+void RoundRobinTick
+(
+   TickType Increment
+)
+{
+   TaskType TaskID = GetRunningTask();
+   TaskPriorityType priority;
+
+   if (RoundRobinTask != TaskID)
+   {
+      /* another task is running, it starts a new time slice */
+      RoundRobinTask = TaskID;
+      RoundRobinTime = 0;
+   }
+
+   /* only a running preemptive task which does not hold any resource can be
+    * rotated, a task with an internal resource runs with a higher priority */
+   if ( ( INVALID_TASK != TaskID ) &&
+        ( TASK_ST_RUNNING == TasksVar[TaskID].Flags.State ) &&
+        ( TasksConst[TaskID].ConstFlags.Preemtive ) &&
+        ( 0 == TasksVar[TaskID].Resources ) &&
+        ( TasksVar[TaskID].ActualPriority == GetBasePriority(TaskID) ) )
+   {
+      /* conver the priority to the array index */
+      priority = (READYLISTS_COUNT-1)-GetBasePriority(TaskID);
+
+#if (PARTITIONS_COUNT != 0)
+      /* each partition has its own ready lists */
+      priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+      if (0 != ReadyConst[priority].TimeSlice)
+      {
+         RoundRobinTime += Increment;
+
+         if (RoundRobinTime >= ReadyConst[priority].TimeSlice)
+         {
+            /* the time slice is over */
+            RoundRobinTime = 0;
+
+            ReadyVar[priority].Slices++;
+
+            if (ReadyVar[priority].ListCount > 1)
+            {
+               /* the running task stays the first one of its ready list
+                * until the scheduler rotates it, the scheduler is called by
+                * the counter interrupt handler or at the next scheduling
+                * point */
+               RoundRobinExpired = TRUE;
+            }
+         }
+      }
+   }
+}
+
+void RoundRobinRotate
+(
+   void
+)
+{
+   TaskType TaskID = GetRunningTask();
+   TaskPriorityType priority;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE)
+   TaskRefType readylist;
+   TaskTotalType maxtasks;
+   TaskTotalType position;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_DISABLE) */
+
+   RoundRobinExpired = FALSE;
+
+   /* the task may have terminated, taken a resource or changed its priority
+    * since its time slice expired */
+   if ( ( INVALID_TASK != TaskID ) &&
+        ( RoundRobinTask == TaskID ) &&
+        ( TASK_ST_RUNNING == TasksVar[TaskID].Flags.State ) &&
+        ( 0 == TasksVar[TaskID].Resources ) &&
+        ( TasksVar[TaskID].ActualPriority == GetBasePriority(TaskID) ) )
+   {
+      /* conver the priority to the array index */
+      priority = (READYLISTS_COUNT-1)-GetBasePriority(TaskID);
+
+#if (PARTITIONS_COUNT != 0)
+      /* each partition has its own ready lists */
+      priority += TasksConst[TaskID].Partition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+      if ( ( ReadyVar[priority].ListCount > 1 ) &&
+           ( TaskID == GetFirstReady(priority) ) )
+      {
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+         /* the running task is the first one of the list, move its node to
+          * the end of the list */
+         ReadyUnlink(priority, ReadyVar[priority].ListStart);
+         ReadyLink(priority, TaskID, FALSE);
+#else
+         /* get ready list */
+         readylist = ReadyConst[priority].TaskRef;
+         /* get max number of entries */
+         maxtasks = ReadyConst[priority].ListLength;
+
+         /* the running task is the first one of the list, move it to the
+          * end of the list: the entry after the last one gets the running
+          * task and the list starts one entry later */
+         position = ReadyVar[priority].ListStart + ReadyVar[priority].ListCount;
+
+         /* go arround maxtasks */
+         /* this if works like a % instruction */
+         if (position >= maxtasks)
+         {
+            position -= maxtasks;
+         }
+
+         readylist[position] = TaskID;
+
+         ReadyVar[priority].ListStart = ReadyVar[priority].ListStart + 1;
+
+         /* go arround maxtasks */
+         /* this if works like a % instruction */
+         if (ReadyVar[priority].ListStart >= maxtasks)
+         {
+            ReadyVar[priority].ListStart -= maxtasks;
+         }
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+         ReadyVar[priority].Rotations++;
+      }
+   }
+}
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
+OSEK_HOT_CODE TaskType GetNextTask
+(
+   void
+)
+{
+   /* if at least one resource is configured */
+#if (RESOURCES_COUNT != 0)
+   TaskType resTask = INVALID_TASK;
+   uint8 prio = 0;
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+   uint8f loopi;
+   uint8f first = 0;
+   boolean found = FALSE;
+   TaskType ret = INVALID_TASK;
+
+#if (PARTITIONS_COUNT != 0)
+   /* only the ready lists of the active partition are checked */
+   first = ActivePartition * READYLISTS_COUNT;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+   /* check in all ready lists */
+   for (loopi = first; ( loopi < ( first + READYLISTS_COUNT ) ) && (!found) ; loopi++)
+   {
+      /* if one or more tasks are ready */
+      if (ReadyVar[loopi].ListCount > 0)
+      {
+         /* return the first ready task */
+         ret = GetFirstReady(loopi);
+
+         /* set found true */
+         found = TRUE;
+      }
+   }
+
+#if (PARTITIONS_COUNT != 0)
+   /* the background tasks are executed in the idle time of the active
+    * partition */
+   first = OSEK_PARTITION_BACKGROUND * READYLISTS_COUNT;
+   for (loopi = first; ( loopi < ( first + READYLISTS_COUNT ) ) && (!found) ; loopi++)
+   {
+      /* if one or more tasks are ready */
+      if (ReadyVar[loopi].ListCount > 0)
+      {
+         /* return the first ready task */
+         ret = GetFirstReady(loopi);
+
+         /* set found true */
+         found = TRUE;
+      }
+   }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+   /* if at least one resource is configured */
+#if (RESOURCES_COUNT != 0)
+   for (loopi = 0; loopi < TASKS_COUNT; loopi++)
+   {
+      /* if at least one resource is occupied */
+      if ( ( 0 != TasksVar[loopi].Resources ) &&
+#if (PARTITIONS_COUNT != 0)
+           /* and the task belongs to the partition of the found task, the
+            * resources are not shared between partitions */
+           ( INVALID_TASK != ret ) &&
+           ( TasksConst[loopi].Partition == TasksConst[ret].Partition ) &&
+#endif /* #if (PARTITIONS_COUNT != 0) */
+           /* and the prio is higher */
+           ( TasksVar[loopi].ActualPriority > prio ) )
+      {
+         /* remember this task and its prio */
+         resTask = loopi;
+         prio = TasksVar[loopi].ActualPriority;
+      }
+   }
+
+   /* if the resource task is a valid one */
+   if ( (INVALID_TASK != resTask) &&
+        /* and the resource task has the same or higher prio than the task
+         * found in the ready list */
+        (prio >= TasksVar[ret].ActualPriority) )
+   {
+      /* next task to be executed is the task using the resource */
+      ret = resTask;
+   }
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+   return ret;
+}
+#elif (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+OSEK_HOT_CODE void AddReady(TaskType TaskID)
+{
+   DeadlineType deadline;
+   TaskActivationsType position;
+   TaskActivationsType queuelength;
 
-   /* get ready list */
-   readylist = ReadyConst[priority].TaskRef;
-   /* get max number of entries */
-   maxtasks = ReadyConst[priority].ListLength;
+   /* the deadline of this activation is relative to the actual time */
+   deadline = EdfTime + TasksConst[TaskID].RelativeDeadline;
 
-   /* get position incrementtion */
-   position = ReadyVar[priority].ListStart + ReadyVar[priority].ListCount;
+   if (0 == TasksVar[TaskID].ReadyEntries)
+   {
+      /* set the start priority for this task */
+      TasksVar[TaskID].ActualPriority = TasksConst[TaskID].StaticPriority;
 
-   /* go arround maxtasks */
-   /* this if works like  % instruction */
-   if (position >= maxtasks)
+      /* insert the task at the end of the heap and sort it up */
+      TasksVar[TaskID].Deadline = deadline;
+      EdfHeap[EdfHeapCount] = TaskID;
+      EdfHeapCount++;
+      EdfHeapUp(EdfHeapCount - 1);
+   }
+   else
    {
-      position -= maxtasks;
+      /* the task is already in the heap with an older activation, queue the
+       * deadline of this activation */
+      queuelength = TasksConst[TaskID].MaxActivations - 1;
+      position = TasksVar[TaskID].DeadlineQueueStart +
+                 TasksVar[TaskID].ReadyEntries - 1;
+
+      /* this if works like  % instruction */
+      if (position >= queuelength)
+      {
+         position -= queuelength;
+      }
+
+      TasksConst[TaskID].DeadlineQueue[position] = deadline;
    }
 
-   /* set the task id in ready the list */
-   readylist[position] = TaskID;
-   /* increment the list counter */
-   ReadyVar[priority].ListCount++;
+   /* increment the count of ready activations */
+   TasksVar[TaskID].ReadyEntries++;
 }
 
-void RemoveTask
+OSEK_HOT_CODE void RemoveTask
 (
    TaskType TaskID
 )
 {
-   TaskPriorityType priority;
-   TaskTotalType maxtasks;
+   TaskActivationsType queuelength;
+   TaskType lasttask;
+   TaskTotalType position;
 
-   /* get task priority */
-   priority = TasksConst[TaskID].StaticPriority;
-   /* conver the priority to the array index */
-   /* do not remove the -1 is needed. for example if READYLIST_COUNT is 4
-   * the valida entries for this array are between 0 and 3, so the -1 is needed
-   * since the lower priority is 0.
-   */
-   priority = (READYLISTS_COUNT-1)-priority;
+   /* decrement the count of ready activations */
+   TasksVar[TaskID].ReadyEntries--;
 
-   /* get max number of entries */
-   maxtasks = ReadyConst[priority].ListLength;
+   if (0 != TasksVar[TaskID].ReadyEntries)
+   {
+      /* the next queued activation takes the place of the task in the heap,
+       * its deadline is the same or later so the task only moves down */
+      queuelength = TasksConst[TaskID].MaxActivations - 1;
+      TasksVar[TaskID].Deadline =
+         TasksConst[TaskID].DeadlineQueue[TasksVar[TaskID].DeadlineQueueStart];
 
-   /* increment the ListStart */
-   ReadyVar[priority].ListStart = ReadyVar[priority].ListStart + 1;
+      TasksVar[TaskID].DeadlineQueueStart++;
+      /* this if works like  % instruction */
+      if (TasksVar[TaskID].DeadlineQueueStart >= queuelength)
+      {
+         TasksVar[TaskID].DeadlineQueueStart = 0;
+      }
 
-   /* go arround maxtasks */
-   /* this if works like a % instruction */
-   if (ReadyVar[priority].ListStart >= maxtasks)
-   {
-      ReadyVar[priority].ListStart -= maxtasks;
+      EdfHeapDown(TasksVar[TaskID].HeapIndex);
    }
+   else
+   {
+      /* remove the task by moving the last task of the heap to its place */
+      EdfHeapCount--;
+      position = TasksVar[TaskID].HeapIndex;
 
-   /* decrement the count of ready tasks */
-   ReadyVar[priority].ListCount--;
+      if (position != EdfHeapCount)
+      {
+         lasttask = EdfHeap[EdfHeapCount];
+         EdfHeap[position] = lasttask;
+         TasksVar[lasttask].HeapIndex = position;
+
+         /* the moved task may belong above or below this position */
+         EdfHeapUp(position);
+         EdfHeapDown(TasksVar[lasttask].HeapIndex);
+      }
+   }
 }
 
-TaskType GetNextTask
+OSEK_HOT_CODE TaskType GetNextTask
 (
    void
 )
@@ -196,24 +1135,16 @@ TaskType GetNextTask
 #if (RESOURCES_COUNT != 0)
    TaskType resTask = INVALID_TASK;
    uint8 prio = 0;
+   uint8f loopi;
+   TaskType task;
 #endif /* #if (RESOURCES_COUNT != 0) */
 
-   uint8f loopi;
-   boolean found = FALSE;
    TaskType ret = INVALID_TASK;
 
-   /* check in all ready lists */
-   for (loopi = 0; ( loopi < READYLISTS_COUNT ) && (!found) ; loopi++)
+   /* the task with the earliest deadline is on the top of the heap */
+   if (EdfHeapCount > 0)
    {
-      /* if one or more tasks are ready */
-      if (ReadyVar[loopi].ListCount > 0)
-      {
-         /* return the first ready task */
-         ret = ReadyConst[loopi].TaskRef[ReadyVar[loopi].ListStart];
-
-         /* set found true */
-         found = TRUE;
-      }
+      ret = EdfHeap[0];
    }
 
    /* if at least one resource is configured */
@@ -231,31 +1162,364 @@ TaskType GetNextTask
       }
    }
 
-   /* if the resource task is a valid one */
+   /* if the resource task is a valid one and the preemption level of the
+    * earliest task is not higher than the ceiling of the occupied resources */
    if ( (INVALID_TASK != resTask) &&
-        /* and the resource task has the same or higher prio than the task
-         * found in the ready list */
-        (prio >= TasksVar[ret].ActualPriority) )
+        (prio >= TasksConst[ret].StaticPriority) )
    {
-      /* next task to be executed is the task using the resource */
+      /* the earliest task is blocked (SRP), take the task with the earliest
+       * deadline from the resource task and all tasks with a higher
+       * preemption level than the ceiling. This search is only performed
+       * while a resource is occupied. */
       ret = resTask;
+      for (loopi = 0; loopi < EdfHeapCount; loopi++)
+      {
+         task = EdfHeap[loopi];
+         if ( ( TasksConst[task].StaticPriority > prio ) &&
+              ( EdfHeapBefore(task, ret) ) )
+         {
+            ret = task;
+         }
+      }
+   }
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+   return ret;
+}
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_FIXED) */
+
+#if (RESOURCES_COUNT != 0)
+TaskPriorityType GetCeilingPriority
+(
+   TaskType TaskID,
+   boolean Internal
+)
+{
+   TaskPriorityType ret = GetBasePriority(TaskID);
+   TaskResourcesType resources = TasksVar[TaskID].Resources;
+   uint8 loopi;
+
+#if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE)
+   if (TRUE == Internal)
+   {
+      /* the internal resources are occupied while the task is running */
+      resources |= TasksConst[TaskID].ResourcesMask & OSEK_INTERNAL_RESOURCES_MASK;
+   }
+#endif /* #if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE) */
+
+   for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+   {
+      if ( ( resources & ( 1 << loopi ) ) &&
+           ( ret < ResourcesPriority[loopi] ) )
+      {
+         ret = ResourcesPriority[loopi];
+      }
    }
+
+   return ret;
+}
 #endif /* #if (RESOURCES_COUNT != 0) */
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+void ProcessIsr1Pending(void)
+{
+   uint8f loopi;
+   uint8f bit;
+   uint32 pending;
+   EventMaskType events;
+   ContextType actualContext;
+
+   /* the activations and events are performed from the system context, this
+    * avoids ActivateTask and SetEvent to call the scheduler */
+   actualContext = GetCallingContext();
+   SetActualContext(CONTEXT_SYS);
+
+   for (loopi = 0; loopi < ISR1_PENDING_WORDS; loopi++)
+   {
+      /* only take the word if an ISR1 has posted something, most of the time
+       * nothing is pending and no atomic access is needed */
+      if (0U != Isr1PendingActivations[loopi])
+      {
+         AtomicTake_Arch(&Isr1PendingActivations[loopi], pending);
+
+         for (bit = 0; pending != 0U; bit++, pending >>= 1U)
+         {
+            if (0U != (pending & 1U))
+            {
+               (void)ActivateTask((TaskType)((loopi << 5U) + bit));
+            }
+         }
+      }
+
+#if (NO_EVENTS == OSEK_DISABLE)
+      /* events are processed after the activations, this allows an ISR1 to
+       * activate an extended task and set an event to it */
+      if (0U != Isr1PendingEventTasks[loopi])
+      {
+         AtomicTake_Arch(&Isr1PendingEventTasks[loopi], pending);
+
+         for (bit = 0; pending != 0U; bit++, pending >>= 1U)
+         {
+            if (0U != (pending & 1U))
+            {
+               /* the task bit is set after the events, if an ISR1 sets new
+                * events after the task bit has been taken the bit is set
+                * again and the next call finds an empty events word */
+               AtomicTake_Arch(&Isr1PendingEvents[(loopi << 5U) + bit], events);
+               if (0U != events)
+               {
+                  (void)SetEvent((TaskType)((loopi << 5U) + bit), events);
+               }
+            }
+         }
+      }
+#endif /* #if (NO_EVENTS == OSEK_DISABLE) */
+   }
+
+   SetActualContext(actualContext);
+}
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (DATA_COUNT != 0)
+void DataCopy(void * Dst, const void * Src, uint16f Size)
+{
+   uint16f loopi;
+
+   if ( 0U == ( ( (unsigned long)Dst | (unsigned long)Src | Size ) & 3U ) )
+   {
+      for (loopi = 0; loopi < (Size >> 2U); loopi++)
+      {
+         ((uint32 *)Dst)[loopi] = ((const uint32 *)Src)[loopi];
+      }
+   }
+   else
+   {
+      for (loopi = 0; loopi < Size; loopi++)
+      {
+         ((uint8 *)Dst)[loopi] = ((const uint8 *)Src)[loopi];
+      }
+   }
+}
+#endif /* #if (DATA_COUNT != 0) */
+
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+void PutActivationArg(TaskType TaskID, ActivationArgType Arg)
+{
+   uint16f position;
+
+   if (NULL != TasksConst[TaskID].ArgQueue)
+   {
+      position = TasksVar[TaskID].ArgQueueStart +
+                 TasksVar[TaskID].Activations;
+
+      /* this if works like  % instruction */
+      if (position >= TasksConst[TaskID].MaxActivations)
+      {
+         position -= TasksConst[TaskID].MaxActivations;
+      }
+
+      TasksConst[TaskID].ArgQueue[position] = Arg;
+   }
+}
+
+void NextActivationArg(TaskType TaskID)
+{
+   if (NULL != TasksConst[TaskID].ArgQueue)
+   {
+      TasksVar[TaskID].ArgQueueStart++;
+
+      /* this if works like  % instruction */
+      if (TasksVar[TaskID].ArgQueueStart >= TasksConst[TaskID].MaxActivations)
+      {
+         TasksVar[TaskID].ArgQueueStart = 0;
+      }
+   }
+}
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+
+StatusType ActivateTaskInternal(TaskType TaskID, ActivationArgType Arg)
+{
+   StatusType ret = E_OK;
+
+   IntSecure_Start();
+
+   /* check if the task is susspended */
+   /* \req OSEK_SYS_3.1.1-1/2 The task TaskID shall be transferred from the
+    * suspended state into the ready state. */
+   if ( TasksVar[TaskID].Flags.State == TASK_ST_SUSPENDED )
+   {
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+      /* the argument is queued in the same critical section as the
+       * activation, the task gets it when this activation runs */
+      PutActivationArg(TaskID, Arg);
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+      /* increment activation counter */
+      TasksVar[TaskID].Activations++;
+      /* if the task was suspended set it to ready */
+      /* OSEK_SYS_3.1.1-2/2 The task TaskID shall be transferred from the
+       * suspended state into the ready state.*/
+      TasksVar[TaskID].Flags.State = TASK_ST_READY;
+      /* clear all events */
+      /* \req OSEK_SYS_3.1.6 When an extended task is transferred from
+       * suspended state into ready state all its events are cleared. */
+      TasksVar[TaskID].Events = 0;
+      /* add the task to the ready list */
+      AddReady(TaskID);
+   }
+   else
+   {
+      /* task is not suspended */
+
+      /* check if the task is a extended task */
+      if ( TasksConst[TaskID].ConstFlags.Extended )
+      {
+         /* return E_OS_LIMIT */
+         /* \req OSEK_SYS_3.1.5-2/3 If other than E_OK is returned the activation
+          * is ignored */
+         /* \req OSEK_SYS_3.1.7-2/3 Possible return values in Standard mode are
+          * E_OK or E_OS_LIMIT */
+         ret = E_OS_LIMIT;
+      }
+      else
+      {
+         /* check if more activations are allowed */
+         if ( TasksVar[TaskID].Activations < TasksConst[TaskID].MaxActivations )
+         {
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+            PutActivationArg(TaskID, Arg);
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+            /* increment activation counter */
+            TasksVar[TaskID].Activations++;
+            /* add the task to the ready list */
+            AddReady(TaskID);
+         }
+         else
+         {
+            /* maximal activation reached, return E_OS_LIMIT */
+            /* \req OSEK_SYS_3.1.5-3/3 If other than E_OK is returned the
+             * activation is ignored */
+            /* \req OSEK_SYS_3.1.7-3/3 Possible return values in Standard mode are
+             * E_OK or E_OS_LIMIT */
+            ret = E_OS_LIMIT;
+         }
+      }
+   }
+
+   IntSecure_End();
+
+#if (OSEK_ACTIVATION_ARG == OSEK_DISABLE)
+   /* without argument queues the argument is not used */
+   (void)Arg;
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_DISABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+   if (E_OK == ret)
+   {
+      /* record the activation */
+      TraceAdd(TRACE_REC_ACTIVATE, 0, TaskID, 0);
+   }
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+#if (NON_PREEMPTIVE == OSEK_DISABLE)
+   /* check if called from a Task Context */
+   if ( GetCallingContext() ==  CONTEXT_TASK )
+   {
+      if ( ( TasksConst[GetRunningTask()].ConstFlags.Preemtive ) &&
+           ( ret == E_OK ) )
+      {
+         /* This is needed to avoid Schedule to perform standard checks
+          * which are done when normally called from the application
+          * the actual context has to be task so is not need to store it */
+         SetActualContext(CONTEXT_SYS);
+
+         /* \req OSEK_SYS_3.1.4 Rescheduling shall take place only if called from a
+          * preemptable task. */
+         (void)Schedule();
+
+         /* restore the old context */
+         SetActualContext(CONTEXT_TASK);
+      }
+   }
+#endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
+
    return ret;
 }
 
+void ChainTaskInternal(TaskType TaskID)
+{
+   /* release internal resources */
+   /* \req OSEK_SYS_3.3.4 If an internal resource is assigned to the calling
+    ** task it shall be automatically released, even if the succeeding task is
+    ** identical with the current task. */
+   ReleaseInternalResources();
+
+   /* decrement activations for this task */
+   TasksVar[GetRunningTask()].Activations--;
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+   NextActivationArg(GetRunningTask());
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+
+   if (TasksVar[GetRunningTask()].Activations == 0)
+   {
+      /* if no more activations set state to suspended */
+      /* \req OSEK_SYS_3.3.1-1/2 This service causes the termination of the calling task. */
+      TasksVar[GetRunningTask()].Flags.State = TASK_ST_SUSPENDED;
+   }
+   else
+   {
+      /* if more activations set state to ready */
+      /* \req OSEK_SYS_3.3.1-2/2 This service causes the termination of the calling task. */
+      TasksVar[GetRunningTask()].Flags.State = TASK_ST_READY;
+   }
+
+   /* set entry point for this task again */
+   /* \req OSEK_SYS_3.1.2-1/3 The operating system shall ensure that the task
+      * code is being executed from the first statement. */
+   SetEntryPoint(GetRunningTask());
+#if ( (OSEK_TRACE == OSEK_ENABLE) && \
+   (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) )
+   /* check the deadline before the one of the next activation is set */
+   TraceCheckDeadline(GetRunningTask());
+#endif /* #if ( (OSEK_TRACE == OSEK_ENABLE) && ... */
+   /* remove ready list */
+   RemoveTask(GetRunningTask());
+   /* set running task to invalid */
+   SetRunningTask(INVALID_TASK);
+   /* set actual context task */
+   SetActualContext(CONTEXT_SYS);
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+   /* a chained activation gets the argument 0 */
+   PutActivationArg(TaskID, 0);
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+   /* increment activations */
+   TasksVar[TaskID].Activations++;
+   /* activate task */
+   /* \req OSEK_SYS_3.3.2 After termination of the calling task a succeeding
+    **  task TaskID shall be activated. */
+   /* \req OSEK_SYS_3.3.3 If the succeeding task is identical with the current
+    ** task, this does not result in multiple requests. The task is not
+    ** transferred to the suspended state, but will immediately become ready
+    ** again. */
+   AddReady(TaskID);
+
+   if(TasksVar[TaskID].Flags.State ==  TASK_ST_SUSPENDED)
+   {
+      /* \req OSEK_SYS_3.3.7 When an extended task is transferred from suspended
+       ** state into ready state all its events are cleared.*/
+      TasksVar[TaskID].Events = 0;
+   }
+}
+
 void OSEK_ISR_NoHandler(void)
 {
    while(1);
 }
 
 #if (ALARMS_COUNT != 0)
-AlarmIncrementType IncrementAlarm(AlarmType AlarmID, AlarmIncrementType Increment)
+OSEK_HOT_CODE AlarmIncrementType IncrementAlarm(AlarmType AlarmID, AlarmIncrementType Increment, AlarmIncrementType * Expirations)
 {
    AlarmIncrementType RestIncrements;
    AlarmIncrementType AlarmCount;
-   CounterIncrementType CounterIncrement;
 
    /* init arlarms count */
    AlarmCount = 0;
@@ -288,8 +1552,8 @@ AlarmIncrementType IncrementAlarm(AlarmType AlarmID, AlarmIncrementType Incremen
          /* disable alarm */
          AlarmsVar[AlarmID].AlarmState = 0;
 
-         /* set rest increments to zero */
-         RestIncrements = 0;
+         /* the alarm doesn't expire again */
+         RestIncrements = (AlarmIncrementType)-1;
       }
       else
       {
@@ -312,91 +1576,84 @@ AlarmIncrementType IncrementAlarm(AlarmType AlarmID, AlarmIncrementType Incremen
          RestIncrements = AlarmsVar[AlarmID].AlarmTime;
       }
 
-      if (AlarmsConst[AlarmID].AlarmAction == INCREMENT)
-      {
-         /* call counter function */
-         CounterIncrement = IncrementCounter(AlarmsConst[AlarmID].AlarmActionInfo.Counter, AlarmCount);
-
-         /* re-calculate the rest of the increments */
-         RestIncrements += AlarmsVar[AlarmID].AlarmCycleTime * ( CounterIncrement-1 );
-      }
-      else
-      {
-         /* execute the alarm so many times as needed */
-         for ( ;AlarmCount > 0; AlarmCount--)
-         {
-            /* check alarm actions differents to INCREMENT */
-            switch(AlarmsConst[AlarmID].AlarmAction)
-            {
-               case ACTIVATETASK:
-                  /* activate task */
-                  ActivateTask(AlarmsConst[AlarmID].AlarmActionInfo.TaskID);
-                  break;
-               case ALARMCALLBACK:
-                  /* callback */
-                  if(AlarmsConst[AlarmID].AlarmActionInfo.CallbackFunction != NULL)
-                  {
-                     AlarmsConst[AlarmID].AlarmActionInfo.CallbackFunction();
-                  }
-                  break;
-#if (NO_EVENTS == OSEK_DISABLE)
-               case SETEVENT:
-                  /* set event */
-                  SetEvent(AlarmsConst[AlarmID].AlarmActionInfo.TaskID, AlarmsConst[AlarmID].AlarmActionInfo.Event);
-                  break;
-#endif /* #if (NO_EVENTS == OSEK_DISABLE) */
-               default:
-                  /* some error */
-                  /* possibly TODO, report an error */
-                  break;
-            }
-         }
-      }
+#if (OSEK_TRACE == OSEK_ENABLE)
+      /* record the expiration of the alarm */
+      TraceAdd(TRACE_REC_ALARM, 0, AlarmID, 0);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
    }
 
+   /* the actions are executed by the caller */
+   *Expirations = AlarmCount;
+
    return RestIncrements;
 }
 #endif /* #if (ALARMS_COUNT != 0) */
 
 #if (ALARMS_COUNT != 0)
-CounterIncrementType IncrementCounter(CounterType CounterID, CounterIncrementType Increment)
+OSEK_HOT_CODE CounterIncrementType IncrementCounter(CounterType CounterID, CounterIncrementType Increment)
 {
-   uint8f loopi;
+   AlarmIncrementType MinimalCount;
    AlarmType AlarmID;
-   AlarmIncrementType MinimalCount = -1;
-   AlarmIncrementType TmpCount;
+   CounterType Counter;
+   CounterIncrementType CounterIncrement;
+   boolean Cascade = FALSE;
+   uint8f loopi;
 
-   /* increment counter */
-   CountersVar[CounterID].Time+=Increment;
+   /* the state of the cascade is static and only used within IntSecure, a
+    * nested call from an interrupt or from an alarm action does not add a
+    * copy of it to the stack */
+   IntSecure_Start();
 
-   /* check if the timer has an overvlow */
-   while ( CountersVar[CounterID].Time >= CountersConst[CounterID].MaxAllowedValue )
+   MinimalCount = AdvanceCounter(CounterID, Increment, &Cascade);
+
+   if (TRUE == Cascade)
    {
-      /* reset counter */
-      CountersVar[CounterID].Time -= CountersConst[CounterID].MaxAllowedValue;
+      /* the derived counters follow their counters in CountersOrder, each
+       * of them is incremented once with the sum of its increments */
+      for(loopi = 0; loopi < COUNTERS_COUNT; loopi++)
+      {
+         Counter = CountersOrder[loopi];
+         CounterIncrement = CounterPending[Counter];
+
+         if (CounterIncrement > 0)
+         {
+            CounterPending[Counter] = 0;
+            (void)AdvanceCounter(Counter, CounterIncrement, &Cascade);
+         }
+      }
    }
 
-   /* for alarms on this counter */
-   for(loopi = 0; loopi < CountersConst[CounterID].AlarmsCount; loopi++)
+   /* execute the actions of the expired alarms after the cascade, one
+    * expiration at a time out of IntSecure, an action may increment a
+    * counter again */
+   while (ExpiredCount > 0)
    {
-      /* get alarm id */
-      AlarmID = CountersConst[CounterID].AlarmRef[loopi];
-
-      /* check if the alarm is eanble */
-      if (AlarmsVar[AlarmID].AlarmState == 1)
+      AlarmID = ExpiredAlarms[ExpiredFirst];
+      AlarmExpirations[AlarmID]--;
+      if (0 == AlarmExpirations[AlarmID])
       {
-         /* increment alarm and get the next alarm time */
-         TmpCount = IncrementAlarm(AlarmID, Increment);
-
-         /* if the actual count is smaller */
-         if (MinimalCount > TmpCount)
+         ExpiredFirst++;
+         if (ExpiredFirst >= ALARMS_COUNT)
          {
-            /* set it as minimal count */
-            MinimalCount = TmpCount;
+            ExpiredFirst = 0;
          }
+         ExpiredCount--;
       }
+
+      IntSecure_End();
+      AlarmAction(AlarmID);
+      IntSecure_Start();
    }
 
+   if (TRUE == Cascade)
+   {
+      /* the next expiration depends on the alarms of the derived counters,
+       * it is resolved after the actions which may have changed them */
+      MinimalCount = CounterNextExpiration(CounterID);
+   }
+
+   IntSecure_End();
+
    /* return the minimal increment */
    return (CounterIncrementType)MinimalCount;
 }
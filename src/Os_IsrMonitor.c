@@ -0,0 +1,229 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Isr Monitor Implementation File
+ **
+ ** This file implements the measurement of the arrivals and of the
+ ** execution time of the isrs category 2 and the masking of their sources
+ ** during interrupt storms
+ **
+ ** \file Os_IsrMonitor.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+#ifndef TraceGetTime_Arch
+#error ISRMONITOR is not supported on this architecture, TraceGetTime_Arch is not defined
+#endif
+#ifndef IsrMonitorDisable_Arch
+#error ISRMONITOR is not supported on this architecture, IsrMonitorDisable_Arch is not defined
+#endif
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Time of the monitor in microseconds
+ **
+ ** Shall be called with the interrupts suspended.
+ **/
+static uint32 IsrMonitorNow(void);
+
+/*==================[internal data definition]===============================*/
+/** \brief Ticks of the time source per microsecond */
+static uint32 IsrMonitorTicksPerUs;
+
+/** \brief Time of the monitor in microseconds at IsrMonitorBase
+ **
+ ** The time source of the architecture may wrap around in a few seconds,
+ ** IsrMonitorTick moves its elapsed time to this counter, which wraps
+ ** around after 2^32 microseconds like the configured times.
+ **/
+static uint32 IsrMonitorTime;
+
+/** \brief Time of the time source when IsrMonitorTime was updated */
+static uint32 IsrMonitorBase;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32 IsrMonitorNow(void)
+{
+   return IsrMonitorTime +
+      ( ( TraceGetTime_Arch() - IsrMonitorBase ) / IsrMonitorTicksPerUs );
+}
+
+/*==================[external functions definition]==========================*/
+void IsrMonitorInit(void)
+{
+   uint8f loopi;
+
+   /* the time of the trace is used */
+   TraceInit_Arch();
+
+   IsrMonitorTicksPerUs = TraceGetFrequency_Arch() / 1000000U;
+   if (IsrMonitorTicksPerUs == 0)
+   {
+      IsrMonitorTicksPerUs = 1;
+   }
+   IsrMonitorTime = 0;
+   IsrMonitorBase = TraceGetTime_Arch();
+
+   for (loopi = 0; loopi < ISR_MONITOR_COUNT; loopi++)
+   {
+      if (IsrMonitorVar[loopi].Throttled)
+      {
+         /* unmask the sources masked before a RestartOS */
+         IsrMonitorEnable_Arch(loopi);
+      }
+      IsrMonitorVar[loopi].Stats.Arrivals = 0;
+      IsrMonitorVar[loopi].Stats.MaxBurst = 0;
+      IsrMonitorVar[loopi].Stats.ExecTime = 0;
+      IsrMonitorVar[loopi].Stats.MaxExecTime = 0;
+      IsrMonitorVar[loopi].Stats.Throttles = 0;
+      IsrMonitorVar[loopi].Burst = 0;
+      IsrMonitorVar[loopi].Throttled = FALSE;
+   }
+}
+
+void IsrMonitorEnter(ISRType IsrID)
+{
+   IsrMonitorVarType * var = &IsrMonitorVar[IsrID];
+   uint32 now;
+
+   IntSecure_Start();
+   var->Start = TraceGetTime_Arch();
+   now = IsrMonitorNow();
+   IntSecure_End();
+
+   var->Stats.Arrivals++;
+
+   /* the first arrival and the arrivals after a pause start a new burst */
+   if ( ( var->Burst != 0 ) &&
+        ( ( now - var->LastArrival ) < IsrMonitorConst[IsrID].MinInterArrival ) )
+   {
+      var->Burst++;
+   }
+   else
+   {
+      var->Burst = 1;
+   }
+   var->LastArrival = now;
+
+   if ( var->Burst > var->Stats.MaxBurst )
+   {
+      var->Stats.MaxBurst = var->Burst;
+   }
+
+   if ( ( IsrMonitorConst[IsrID].MinInterArrival != 0 ) &&
+        ( var->Burst > IsrMonitorConst[IsrID].MaxBurst ) )
+   {
+      IntSecure_Start();
+
+      /* mask the source until the back off time is over */
+      IsrMonitorDisable_Arch(IsrID);
+      var->BackoffStart = now;
+      var->Throttled = TRUE;
+      var->Burst = 0;
+      var->Stats.Throttles++;
+
+      IntSecure_End();
+
+#if (HOOK_ISRSTORMHOOK == OSEK_ENABLE)
+      IsrStormHook(IsrID);
+#endif /* #if (HOOK_ISRSTORMHOOK == OSEK_ENABLE) */
+   }
+}
+
+void IsrMonitorExit(ISRType IsrID)
+{
+   IsrMonitorVarType * var = &IsrMonitorVar[IsrID];
+   uint32 exectime;
+
+   exectime = ( TraceGetTime_Arch() - var->Start ) / IsrMonitorTicksPerUs;
+
+   var->Stats.ExecTime = exectime;
+   if ( exectime > var->Stats.MaxExecTime )
+   {
+      var->Stats.MaxExecTime = exectime;
+   }
+}
+
+void IsrMonitorTick(void)
+{
+   uint8f loopi;
+   uint32 elapsed;
+   uint32 now;
+
+   IntSecure_Start();
+
+   /* move the elapsed whole microseconds to the time of the monitor, it is
+    * called more often than the time source wraps around */
+   elapsed = ( TraceGetTime_Arch() - IsrMonitorBase ) / IsrMonitorTicksPerUs;
+   IsrMonitorBase += elapsed * IsrMonitorTicksPerUs;
+   IsrMonitorTime += elapsed;
+   now = IsrMonitorTime;
+
+   IntSecure_End();
+
+   for (loopi = 0; loopi < ISR_MONITOR_COUNT; loopi++)
+   {
+      if ( ( IsrMonitorVar[loopi].Throttled ) &&
+           ( ( now - IsrMonitorVar[loopi].BackoffStart ) >=
+             IsrMonitorConst[loopi].Backoff ) )
+      {
+         /* the back off time is over, the arrivals latched meanwhile are
+          * executed when the source is unmasked */
+         IsrMonitorVar[loopi].Throttled = FALSE;
+         IsrMonitorEnable_Arch(loopi);
+      }
+   }
+}
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,149 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os Pipeline Implementation File
+ **
+ ** This file implements the internal functions of the pipelines, the
+ ** lookup of the stage of a task and the statistics of the stages
+ **
+ ** \file Os_Pipeline.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+#if (PIPELINES_COUNT != 0)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief Ticks of the time source per microsecond */
+static uint32 PipelineTicksPerUs;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void PipelineInit(void)
+{
+   uint8f loopi;
+
+#ifdef TraceGetTime_Arch
+   /* the time of the trace is used */
+   TraceInit_Arch();
+
+   PipelineTicksPerUs = TraceGetFrequency_Arch() / 1000000U;
+#endif /* #ifdef TraceGetTime_Arch */
+   if (PipelineTicksPerUs == 0)
+   {
+      PipelineTicksPerUs = 1;
+   }
+
+   for (loopi = 0; loopi < PIPELINE_STAGES_COUNT; loopi++)
+   {
+      PipelineStagesVar[loopi].Stats.Frames = 0;
+      PipelineStagesVar[loopi].Stats.Overruns = 0;
+      PipelineStagesVar[loopi].Stats.Latency = 0;
+      PipelineStagesVar[loopi].Stats.MaxLatency = 0;
+      PipelineStagesVar[loopi].Stats.FrameLatency = 0;
+      PipelineStagesVar[loopi].Stats.MaxFrameLatency = 0;
+      PipelineStagesVar[loopi].Stats.Period = 0;
+      PipelineStagesVar[loopi].Fill = 0;
+      PipelineStagesVar[loopi].Ready = 1;
+      PipelineStagesVar[loopi].Started = FALSE;
+   }
+}
+
+uint8f PipelineGetStage(PipelineType PipelineID, TaskType TaskID)
+{
+   uint8f stage;
+   uint8f ret = PIPELINE_INVALID_STAGE;
+
+   /* pipelines have only a few stages, a linear search is enough */
+   for (stage = PipelinesConst[PipelineID].FirstStage;
+        stage <= PipelinesConst[PipelineID].LastStage;
+        stage++)
+   {
+      if (PipelineStagesConst[stage].Task == TaskID)
+      {
+         ret = stage;
+      }
+   }
+
+   return ret;
+}
+
+void PipelineUpdateStats(uint8f Stage, uint32 Now)
+{
+   PipelineStageVarType * var = &PipelineStagesVar[Stage];
+
+   var->Stats.Latency = ( Now - var->Start ) / PipelineTicksPerUs;
+   if (var->Stats.Latency > var->Stats.MaxLatency)
+   {
+      var->Stats.MaxLatency = var->Stats.Latency;
+   }
+
+   var->Stats.FrameLatency = ( Now - var->FrameStart ) / PipelineTicksPerUs;
+   if (var->Stats.FrameLatency > var->Stats.MaxFrameLatency)
+   {
+      var->Stats.MaxFrameLatency = var->Stats.FrameLatency;
+   }
+
+   /* the period is only known from the second frame on */
+   if (var->Stats.Frames != 0)
+   {
+      var->Stats.Period = ( Now - var->LastEnd ) / PipelineTicksPerUs;
+   }
+   var->LastEnd = Now;
+
+   var->Stats.Frames++;
+}
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
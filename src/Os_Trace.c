@@ -0,0 +1,343 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os Trace Implementation File
+ **
+ ** This file implements the recording of the kernel events in the trace
+ **
+ ** \file Os_Trace.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+#if (OSEK_TRACE == OSEK_ENABLE)
+#ifndef TraceGetTime_Arch
+#error TRACE is not supported on this architecture, TraceGetTime_Arch is not defined
+#endif
+
+/** \brief Maximal size of a record, header, time and two ids */
+#define TRACE_RECORD_MAX_SIZE    16U
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Encode a value as variable length integer
+ **
+ ** \param[out] Record where the value is written
+ ** \param[in] Value value to be encoded
+ ** \return count of written bytes, from 1 to 5
+ **/
+static uint32 TraceEncode(uint8 * Record, uint32 Value);
+
+/** \brief Decode a variable length integer of the buffer
+ **
+ ** \param[inout] Position position of the value in the buffer, returns the
+ **                        position after the value
+ ** \return decoded value
+ **/
+static uint32 TraceDecode(uint32 * Position);
+
+/** \brief Remove the first record of the buffer
+ **
+ ** The time of the record is added to TailTime and the task of a SWITCH
+ ** record is kept as TailTask, so the records left can still be decoded.
+ **/
+static void TraceDrop(void);
+
+/*==================[internal data definition]===============================*/
+/** \brief Count of ids of each record type */
+static const uint8 TraceRecordIds[TRACE_REC_USER + 1] =
+{
+   0, /* not used */
+   1, /* TRACE_REC_SWITCH: next task + 1, 0 if idle */
+   1, /* TRACE_REC_ACTIVATE: task */
+   2, /* TRACE_REC_SETEVENT: task and event mask */
+   1, /* TRACE_REC_ALARM: alarm */
+   1, /* TRACE_REC_ISR_ENTER: isr */
+   1, /* TRACE_REC_ISR_EXIT: isr */
+   2, /* TRACE_REC_ERROR: service id and return value */
+   1, /* TRACE_REC_DEADLINE: task */
+   0, /* TRACE_REC_TRIGGER */
+   1  /* TRACE_REC_USER: value, the user id is stored as aux */
+};
+
+/*==================[external data definition]===============================*/
+TraceType Osek_Trace;
+
+/*==================[internal functions definition]==========================*/
+static uint32 TraceEncode(uint8 * Record, uint32 Value)
+{
+   uint32 length = 0;
+
+   while (Value > 0x7FU)
+   {
+      Record[length] = (uint8)((Value & 0x7FU) | 0x80U);
+      Value >>= 7;
+      length++;
+   }
+   Record[length] = (uint8)Value;
+   length++;
+
+   return length;
+}
+
+static uint32 TraceDecode(uint32 * Position)
+{
+   uint32 value = 0;
+   uint32 shift = 0;
+   uint8 byte;
+
+   do
+   {
+      byte = Osek_Trace.Buffer[*Position];
+      value |= (uint32)(byte & 0x7FU) << shift;
+      shift += 7;
+
+      /* this if works like % instruction */
+      (*Position)++;
+      if (*Position >= OSEK_TRACE_SIZE)
+      {
+         *Position = 0;
+      }
+   } while ( (byte & 0x80U) != 0 );
+
+   return value;
+}
+
+static void TraceDrop(void)
+{
+   uint32 position = Osek_Trace.Tail;
+   uint8 type;
+   uint32 id;
+
+   type = Osek_Trace.Buffer[position] >> 4;
+   position++;
+   if (position >= OSEK_TRACE_SIZE)
+   {
+      position = 0;
+   }
+
+   Osek_Trace.TailTime += TraceDecode(&position);
+
+   if (TraceRecordIds[type] > 0)
+   {
+      id = TraceDecode(&position);
+      if (TRACE_REC_SWITCH == type)
+      {
+         Osek_Trace.TailTask = (0 == id) ? INVALID_TASK : (uint8)(id - 1);
+      }
+   }
+   if (TraceRecordIds[type] > 1)
+   {
+      (void)TraceDecode(&position);
+   }
+
+   /* free the bytes of the record */
+   if (position >= Osek_Trace.Tail)
+   {
+      Osek_Trace.Used -= position - Osek_Trace.Tail;
+   }
+   else
+   {
+      Osek_Trace.Used -= (OSEK_TRACE_SIZE - Osek_Trace.Tail) + position;
+   }
+   Osek_Trace.Tail = position;
+}
+
+/*==================[external functions definition]==========================*/
+void TraceInit(void)
+{
+   /* a stopped trace is kept, it may be read after a RestartOS */
+   if ( (TRACE_MAGIC != Osek_Trace.Magic) ||
+        (TRACE_STOPPED != Osek_Trace.State) )
+   {
+      TraceInit_Arch();
+
+      Osek_Trace.Magic = TRACE_MAGIC;
+      Osek_Trace.Version = TRACE_VERSION;
+      Osek_Trace.Mode = OSEK_TRACE_MODE;
+      Osek_Trace.State = TRACE_RECORDING;
+      Osek_Trace.Task = INVALID_TASK;
+      Osek_Trace.TailTask = INVALID_TASK;
+      Osek_Trace.Frequency = TraceGetFrequency_Arch();
+      Osek_Trace.Size = OSEK_TRACE_SIZE;
+      Osek_Trace.Head = 0;
+      Osek_Trace.Tail = 0;
+      Osek_Trace.Used = 0;
+      Osek_Trace.TailTime = TraceGetTime_Arch();
+      Osek_Trace.LastTime = Osek_Trace.TailTime;
+      Osek_Trace.PostTrigger = OSEK_TRACE_POST_TRIGGER;
+   }
+}
+
+void TraceAdd(uint8 Type, uint8 Aux, uint32 Id, uint32 Value)
+{
+   uint8 record[TRACE_RECORD_MAX_SIZE];
+   uint32 length;
+   uint32 time;
+   uint32 loopi;
+
+   IntSecure_Start();
+
+   if (TRACE_STOPPED != Osek_Trace.State)
+   {
+      time = TraceGetTime_Arch();
+
+      /* header, time since the last record and the ids */
+      record[0] = (uint8)((Type << 4) | (Aux & 0x0FU));
+      length = 1;
+      length += TraceEncode(&record[length], time - Osek_Trace.LastTime);
+      if (TraceRecordIds[Type] > 0)
+      {
+         length += TraceEncode(&record[length], Id);
+      }
+      if (TraceRecordIds[Type] > 1)
+      {
+         length += TraceEncode(&record[length], Value);
+      }
+
+      if ( (TRACE_TRIGGERED == Osek_Trace.State) &&
+           (length > Osek_Trace.PostTrigger) )
+      {
+         /* the window after the trigger is full */
+         Osek_Trace.State = TRACE_STOPPED;
+      }
+#if (OSEK_TRACE_MODE == OSEK_TRACE_SNAPSHOT)
+      else if ( (Osek_Trace.Used + length) > OSEK_TRACE_SIZE )
+      {
+         /* the buffer is full */
+         Osek_Trace.State = TRACE_STOPPED;
+      }
+#endif /* #if (OSEK_TRACE_MODE == OSEK_TRACE_SNAPSHOT) */
+      else
+      {
+#if (OSEK_TRACE_MODE == OSEK_TRACE_RING)
+         /* overwrite the oldest records */
+         while ( (Osek_Trace.Used + length) > OSEK_TRACE_SIZE )
+         {
+            TraceDrop();
+         }
+#endif /* #if (OSEK_TRACE_MODE == OSEK_TRACE_RING) */
+
+         for (loopi = 0; loopi < length; loopi++)
+         {
+            Osek_Trace.Buffer[Osek_Trace.Head] = record[loopi];
+
+            /* this if works like % instruction */
+            Osek_Trace.Head++;
+            if (Osek_Trace.Head >= OSEK_TRACE_SIZE)
+            {
+               Osek_Trace.Head = 0;
+            }
+         }
+         Osek_Trace.Used += length;
+         Osek_Trace.LastTime = time;
+
+         if (TRACE_TRIGGERED == Osek_Trace.State)
+         {
+            Osek_Trace.PostTrigger -= length;
+         }
+      }
+   }
+
+   IntSecure_End();
+}
+
+void TraceSwitch(TaskType NextTask, boolean Preempted)
+{
+   uint8 reason;
+
+   /* the idle loop of the scheduler calls this function on each loop */
+   if ( (INVALID_TASK != NextTask) || (INVALID_TASK != Osek_Trace.Task) )
+   {
+      if (Preempted)
+      {
+         reason = TRACE_SWITCH_PREEMPTED;
+      }
+      else if (INVALID_TASK == Osek_Trace.Task)
+      {
+         reason = TRACE_SWITCH_IDLE;
+      }
+      else if (TASK_ST_WAITING == TasksVar[Osek_Trace.Task].Flags.State)
+      {
+         reason = TRACE_SWITCH_WAITING;
+      }
+      else
+      {
+         reason = TRACE_SWITCH_TERMINATED;
+      }
+
+      /* the next task is stored + 1, 0 is used for the idle time */
+      TraceAdd(TRACE_REC_SWITCH, reason,
+               (INVALID_TASK == NextTask) ? 0U : (uint32)NextTask + 1U, 0);
+
+      Osek_Trace.Task = NextTask;
+   }
+}
+
+void TraceError(void)
+{
+   TraceAdd(TRACE_REC_ERROR, 0, Osek_ErrorApi, Osek_ErrorRet);
+
+   TraceTrigger();
+}
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+void TraceCheckDeadline(TaskType TaskID)
+{
+   /* the deadline of the actual activation is still set */
+   if (DeadlineBefore(TasksVar[TaskID].Deadline, EdfTime))
+   {
+      TraceAdd(TRACE_REC_DEADLINE, 0, TaskID, 0);
+
+      TraceTrigger();
+   }
+}
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,153 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os PostSemaphore Implementation File
+ **
+ ** This file implements the PostSemaphore API
+ **
+ ** \file PostSemaphore.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (SEMAPHORES_COUNT != 0)
+StatusType PostSemaphore
+(
+   SemaphoreType SemID
+)
+{
+   TaskType task;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( SemID >= SEMAPHORES_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else
+#endif
+   {
+      /* enter to critical code */
+      IntSecure_Start();
+
+      task = SemaphoresVar[SemID].WaitList;
+
+      if ( INVALID_TASK != task )
+      {
+         /* the unit is handed over to the first task of the wait list, which
+          * is the highest priority waiting task */
+         SemaphoresVar[SemID].WaitList = TasksVar[task].SemaphoreNext;
+
+         AddReady(task);
+
+         TasksVar[task].Flags.State = TASK_ST_READY;
+
+         IntSecure_End();
+
+#if (NON_PREEMPTIVE == OSEK_DISABLE)
+         /* check if called from a Task Context, if called from an ISR2 the
+          * scheduler is called at the end of the ISR2 */
+         if ( GetCallingContext() ==  CONTEXT_TASK )
+         {
+            if ( TasksConst[GetRunningTask()].ConstFlags.Preemtive )
+            {
+               /* This is needed to avoid Schedule to perform standard checks
+                * which are done when normally called from the application
+                * the actual context has to be task so is not need to store it */
+               SetActualContext(CONTEXT_SYS);
+
+               (void)Schedule();
+
+               /* restore the task context */
+               SetActualContext(CONTEXT_TASK);
+            }
+         }
+#endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
+      }
+      else if ( SemaphoresVar[SemID].Count >= SemaphoresConst[SemID].MaxValue )
+      {
+         IntSecure_End();
+
+         ret = E_OS_LIMIT;
+      }
+      else
+      {
+         /* no task is waiting, increment the semaphore count */
+         SemaphoresVar[SemID].Count++;
+
+         IntSecure_End();
+      }
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_PostSemaphore);
+      SetError_Param1(SemID);
+      SetError_Ret(ret);
+      SetError_Msg("PostSemaphore returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (SEMAPHORES_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,149 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os ReadData Implementation File
+ **
+ ** This file implements the ReadData API
+ **
+ ** \file ReadData.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (DATA_COUNT != 0)
+StatusType ReadData
+(
+   DataType DataID,
+   void * Value
+)
+{
+   uint32 sequence;
+   uint32 previous;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( DataID >= DATA_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else
+#endif
+   if ( DataVar[DataID].Sequence == 0U )
+   {
+      /* the data has never been written */
+      ret = E_OS_NOFUNC;
+   }
+   else
+   {
+      if ( DataConst[DataID].Type == DATA_SEQLOCK )
+      {
+         do
+         {
+            sequence = DataVar[DataID].Sequence;
+            DataBarrier();
+
+            /* read the copy which is not being written, the copy is only
+             * repeated if the writer has run in the meantime */
+            DataCopy(Value, &DataConst[DataID].Buffer[
+                     (sequence & 1U) * DataConst[DataID].Words],
+                  DataConst[DataID].Size);
+
+            DataBarrier();
+         } while ( sequence != DataVar[DataID].Sequence );
+
+         if ( sequence == 1U )
+         {
+            /* the first write is still being performed by a preempted
+             * writer, the second copy has no value yet */
+            ret = E_OS_NOFUNC;
+         }
+      }
+      else
+      {
+         if ( ( DataVar[DataID].Exchange & DATA_FRESH ) != 0U )
+         {
+            /* take the new value and give the old buffer to the writer */
+            AtomicExchange_Arch(&DataVar[DataID].Exchange,
+                  (uint32)DataVar[DataID].ReadBuffer, previous);
+            DataVar[DataID].ReadBuffer = (uint8)(previous & ~DATA_FRESH);
+         }
+
+         DataCopy(Value, &DataConst[DataID].Buffer[
+                  DataVar[DataID].ReadBuffer * DataConst[DataID].Words],
+               DataConst[DataID].Size);
+      }
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_ReadData);
+      SetError_Param1(DataID);
+      SetError_Param2((unsigned int)Value);
+      SetError_Ret(ret);
+      SetError_Msg("ReadData returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (DATA_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,142 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os ReadLog Implementation File
+ **
+ ** This file implements the ReadLog API
+ **
+ ** \file ReadLog.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (OSEK_LOG == OSEK_ENABLE)
+StatusType ReadLog
+(
+   LogEntryRefType Entry
+)
+{
+   StatusType ret = E_OS_NOFUNC;
+   boolean done = FALSE;
+   uint32 expected;
+   uint32 sequence;
+   uint32 tail;
+   LogRecordType * record;
+
+   while ( (FALSE == done) && (Osek_Log.Tail != Osek_Log.Head) )
+   {
+      record = &Osek_Log.Records[Osek_Log.Tail & (OSEK_LOG_SIZE - 1U)];
+      expected = Osek_Log.Tail + 1U;
+      sequence = record->Sequence;
+      LogBarrier();
+
+      if ( (sequence == expected) && (0U != expected) )
+      {
+         Entry->Format = record->Format;
+         Entry->Time = record->Time;
+         Entry->Task = record->Task;
+         Entry->Isr = ( (CONTEXT_ISR1 == record->Context) ||
+                        (CONTEXT_ISR2 == record->Context) );
+         Entry->Args[0] = record->Args[0];
+         Entry->Args[1] = record->Args[1];
+         Entry->Args[2] = record->Args[2];
+         LogBarrier();
+
+         /* the copy is only valid if the record has not been overwritten
+          * meanwhile, in other case it is taken as lost in the next loop */
+         if (record->Sequence == expected)
+         {
+            Entry->Text = (Entry->Format < LOG_FORMATS_COUNT) ?
+                          LogFormats[Entry->Format] : NULL;
+            Entry->Lost = Osek_Log.Lost;
+            Osek_Log.Lost = 0;
+            Osek_Log.Tail++;
+            ret = E_OK;
+            done = TRUE;
+         }
+      }
+      else if ( (0U == expected) ||
+                ( (0U != sequence) &&
+                  ( (sint32)(sequence - expected) > 0 ) ) )
+      {
+         /* the message has been overwritten before it has been read, the
+          * oldest message which may still be in the log follows. The
+          * sequence 0 of the message at position 0xFFFFFFFF can not be
+          * told apart of a message being written, it is dropped too. */
+         tail = Osek_Log.Head - OSEK_LOG_SIZE;
+         if ( (sint32)(tail - Osek_Log.Tail) <= 0 )
+         {
+            tail = Osek_Log.Tail + 1U;
+         }
+         Osek_Log.Lost += tail - Osek_Log.Tail;
+         Osek_Log.Tail = tail;
+      }
+      else
+      {
+         /* the message is still being written by a preempted writer */
+         done = TRUE;
+      }
+   }
+
+   return ret;
+}
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
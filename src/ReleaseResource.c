@@ -80,12 +80,8 @@ StatusType ReleaseResource
     * E_OK  */
    StatusType ret = E_OK;
 
-#if (RESOURCES_COUNT != 0)
-   uint8 loopi;
-#endif /* #if (RESOURCES_COUNT != 0) */
-
    /* asign the static priority to the task */
-   TaskPriorityType priority = TasksConst[GetRunningTask()].StaticPriority;
+   TaskPriorityType priority = GetBasePriority(GetRunningTask());
 
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
    if (
@@ -111,6 +107,16 @@ StatusType ReleaseResource
       if ( ResID != RES_SCHEDULER )
 #endif /* #if (NO_RES_SCHEDULER == OSEK_DISABLE) */
    {
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+      if ( GetCallingContext() == CONTEXT_ISR2 )
+      {
+         if ( ( IsrResources & ( 1 << ResID ) ) == 0 )
+         {
+            ret = E_OS_NOFUNC;
+         }
+      }
+      else
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
       if ( ( TasksVar[GetRunningTask()].Resources & ( 1 << ResID ) ) == 0 )
       {
          /* \req OSEK_SYS_3.14.3-2/2 Extra possible return values in Extended mode are
@@ -130,31 +136,46 @@ StatusType ReleaseResource
    {
       IntSecure_Start();
 
-#if (RESOURCES_COUNT != 0)
-#if (NO_RES_SCHEDULER == OSEK_DISABLE)
-      if ( ResID != RES_SCHEDULER )
-#endif /* #if (NO_RES_SCHEDULER == OSEK_DISABLE) */
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+      if ( GetCallingContext() == CONTEXT_ISR2 )
       {
-         /* clear resource */
-         TasksVar[GetRunningTask()].Resources &= ~( 1 << ResID );
-      }
+         /* the resource was taken by an isr 2, the priority of the
+          * interrupted task is not changed */
+         IsrResources &= ~( 1 << ResID );
 
-      for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+         /* unmask the interrupts masked by GetResource */
+         RestoreInterruptMask_Arch(ResourcesSavedMask[ResID]);
+      }
+      else
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
       {
-         if ( TasksVar[GetRunningTask()].Resources & ( 1 << loopi ) )
+#if (RESOURCES_COUNT != 0)
+#if (NO_RES_SCHEDULER == OSEK_DISABLE)
+         if ( ResID != RES_SCHEDULER )
+#endif /* #if (NO_RES_SCHEDULER == OSEK_DISABLE) */
          {
-            if ( priority < ResourcesPriority[loopi] )
+            /* clear resource */
+            TasksVar[GetRunningTask()].Resources &= ~( 1 << ResID );
+
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+            if ( OSEK_ISR_RESOURCES_MASK & ( 1 << ResID ) )
             {
-               priority = ResourcesPriority[loopi];
+               /* unmask the interrupts masked by GetResource */
+               RestoreInterruptMask_Arch(ResourcesSavedMask[ResID]);
             }
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
          }
-      }
+
+         /* the priority is raised to the ceiling of the resources which
+          * are still occupied and of the internal resources */
+         priority = GetCeilingPriority(GetRunningTask(), TRUE);
 #endif /* #if (RESOURCES_COUNT != 0) */
 
-      /* \req OSEK_SYS_3.14.1 ReleaseResource is the counterpart of GetResource
-       * and serves to leave critical sections in the code that are assigned to
-       * the resource referenced by ResID */
-      TasksVar[GetRunningTask()].ActualPriority = priority;
+         /* \req OSEK_SYS_3.14.1 ReleaseResource is the counterpart of GetResource
+          * and serves to leave critical sections in the code that are assigned to
+          * the resource referenced by ResID */
+         TasksVar[GetRunningTask()].ActualPriority = priority;
+      }
 
       IntSecure_End();
 
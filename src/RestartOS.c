@@ -0,0 +1,215 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os RestartOS Implementation File
+ **
+ ** This file implements the RestartOS API
+ **
+ ** \file RestartOS.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+#if (OSEK_BOOT_IMAGE == OSEK_DISABLE)
+/** \brief Clear a block of kernel variables
+ **
+ ** \param[out] Destination kernel variables to be cleared
+ ** \param[in] Size size of the block in bytes
+ **/
+static void ClearKernelVar(void * Destination, uint32 Size);
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_DISABLE) */
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+#if (OSEK_BOOT_IMAGE == OSEK_DISABLE)
+static void ClearKernelVar(void * Destination, uint32 Size)
+{
+   uint8 * dst = (uint8 *)Destination;
+
+   while (Size > 0)
+   {
+      *dst = 0;
+      dst++;
+      Size--;
+   }
+}
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_DISABLE) */
+
+/*==================[external functions definition]==========================*/
+void RestartOS
+(
+   AppModeType Mode
+)
+{
+#if ( (OSEK_ISR1_PENDING == OSEK_ENABLE) || (OSEK_ISR_RESOURCES == OSEK_ENABLE) )
+   uint8f loopi;
+#endif /* #if ( (OSEK_ISR1_PENDING == OSEK_ENABLE) || ... */
+#if (OSEK_LOG == OSEK_ENABLE)
+   uint32 position;
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   /* the os can only be restarted from task level, also from the ErrorHook
+    * called from task level. An isr or a hook called out of task level would
+    * be left in the middle of the handling of the os. */
+   if ( GetCallingContext() != CONTEXT_TASK )
+   {
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+      if (ErrorHookRunning != 1U)
+      {
+         SetError_Api(OSServiceId_RestartOS);
+         SetError_Param1(Mode);
+         SetError_Ret(E_OS_CALLEVEL);
+         SetError_Msg("RestartOS called from a wrong context");
+         SetError_ErrorHook();
+      }
+#endif /* #if (HOOK_ERRORHOOK == OSEK_ENABLE) */
+   }
+   else
+#endif /* #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+   {
+      /* no interrupt shall be handled while the state of the kernel is
+       * reset, the interrupts are enabled again at the end of StartOS */
+      IntSecure_Start();
+
+#if (OSEK_BOOT_IMAGE == OSEK_DISABLE)
+      /* set the kernel variables back to the values of the c startup,
+       * StartOS activates the auto start tasks and alarms again. If the boot
+       * image is enabled these variables are copied from it by StartOS. The
+       * ready nodes, the round robin and the partition windows are
+       * initialized by StartOS in both cases. */
+      ClearKernelVar(TasksVar, sizeof(TasksVar));
+      ClearKernelVar(ReadyVar, sizeof(ReadyVar));
+#if (ALARMS_COUNT != 0)
+      ClearKernelVar(AlarmsVar, sizeof(AlarmsVar));
+      ClearKernelVar(CountersVar, sizeof(CountersVar));
+#endif /* #if (ALARMS_COUNT != 0) */
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_DISABLE) */
+
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+      /* no task is ready */
+      EdfTime = 0;
+      EdfHeapCount = 0;
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+      /* drop the requests of the category 1 interrupts */
+      for (loopi = 0; loopi < ISR1_PENDING_WORDS; loopi++)
+      {
+         Isr1PendingActivations[loopi] = 0;
+         Isr1PendingEventTasks[loopi] = 0;
+      }
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (OSEK_ISR_RESOURCES == OSEK_ENABLE)
+      /* the resources shared with isrs are free, the interrupt mask is set
+       * back by RestartOs_Arch */
+      IsrResources = 0;
+      for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+      {
+         ResourcesSavedMask[loopi] = 0;
+      }
+#endif /* #if (OSEK_ISR_RESOURCES == OSEK_ENABLE) */
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+      /* the records of a trigger window are kept to be read after the
+       * restart, TraceInit starts a new trace if it is not stopped */
+      if (TRACE_TRIGGERED == Osek_Trace.State)
+      {
+         Osek_Trace.State = TRACE_STOPPED;
+      }
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+#if (OSEK_LOG == OSEK_ENABLE)
+      /* the messages which are still being written are never completed,
+       * their sequence of the next round lets ReadLog count them as lost */
+      position = Osek_Log.Head - OSEK_LOG_SIZE;
+      if ( (sint32)(position - Osek_Log.Tail) < 0 )
+      {
+         position = Osek_Log.Tail;
+      }
+      for (; position != Osek_Log.Head; position++)
+      {
+         if (0U == Osek_Log.Records[position & (OSEK_LOG_SIZE - 1U)].Sequence)
+         {
+            Osek_Log.Records[position & (OSEK_LOG_SIZE - 1U)].Sequence =
+               position + 1U + OSEK_LOG_SIZE;
+         }
+      }
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+      /* the restart may be requested from the error hook */
+      ErrorHookRunning = (uint8)0U;
+
+      /* reset the interrupt nesting counters, the interrupts stay disabled
+       * until StartOS enables them */
+      SuspendOSInterrupts_Counter = 0;
+      DisableAllInterrupts_Counter = 0;
+      SuspendAllInterrupts_Counter = 0;
+
+      /* save the aplication mode to be started, StartOS also clears the
+       * statistics of the isr monitor */
+      ApplicationMode = Mode;
+
+      /* architecture dependent restart, calls StartOS on the stack of the
+       * os */
+      RestartOs_Arch();
+
+      /* this function shall never return */
+      while(1);
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -65,12 +65,12 @@
 
 /*==================[external functions definition]==========================*/
 #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
-extern StatusType Schedule_Int
+extern OSEK_HOT_CODE StatusType Schedule_Int
 (
    boolean PerformChecks
 )
 #elif (ERROR_CHECKING_TYPE == ERROR_CHECKING_STANDARD)
-extern StatusType Schedule
+extern OSEK_HOT_CODE StatusType Schedule
 (
    void
 )
@@ -129,6 +129,20 @@ extern StatusType Schedule
    if (ret == E_OK)
 #endif
    {
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+      /* perform the activations and events posted by ISR1 */
+      ProcessIsr1Pending();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+      if (RoundRobinExpired)
+      {
+         /* the time slice of the running task is over, it is rotated only
+          * here because the next task of its list is selected below */
+         RoundRobinRotate();
+      }
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
       /* get next task */
       nextTask = GetNextTask();
 
@@ -136,6 +150,11 @@ extern StatusType Schedule
       while ( ( actualTask == INVALID_TASK ) &&
             ( nextTask == INVALID_TASK) )
       {
+#if (OSEK_TRACE == OSEK_ENABLE)
+         /* record the start of the idle time */
+         TraceSwitch(INVALID_TASK, FALSE);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
          IntSecure_End();
 
          /* macro used to indicate the processor that we are in idle time */
@@ -143,15 +162,36 @@ extern StatusType Schedule
 
          IntSecure_Start();
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+         /* an ISR1 may have posted an activation during the idle time */
+         ProcessIsr1Pending();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
          /* get next task */
          nextTask = GetNextTask();
       };
 
+#if (PARTITIONS_COUNT != 0)
+      if ( INVALID_TASK == nextTask )
+      {
+         /* no task of the active partition nor of the background is ready,
+          * the running task continues even out of its partition window */
+         nextTask = actualTask;
+      }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
       /* if the actual task is invalid */
       if ( actualTask == INVALID_TASK )
       {
          /* set task state to running */
          TasksVar[nextTask].Flags.State = TASK_ST_RUNNING;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+         TasksVar[nextTask].Flags.Preempted = 0;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+#if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE)
+         /* the task occupies its internal resources while it is running */
+         TasksVar[nextTask].ActualPriority = GetCeilingPriority(nextTask, TRUE);
+#endif /* #if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE) */
 
          /* set as running task */
          SetRunningTask(nextTask);
@@ -159,6 +199,11 @@ extern StatusType Schedule
          /* set actual context task */
          SetActualContext(CONTEXT_TASK);
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+         /* record the switch from the terminated or waiting task */
+         TraceSwitch(nextTask, FALSE);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
          IntSecure_End();
 
 #if (HOOK_PRETASKHOOK == OSEK_ENABLE)
@@ -174,7 +219,26 @@ extern StatusType Schedule
          /* \req OSEK_SYS_3.4.1 If a task with a lower or equal priority than the
           ** ceiling priority of the internal resource and higher priority than
           ** the priority of the calling task is ready */
-         if ( TasksConst[nextTask].StaticPriority > TasksVar[actualTask].ActualPriority )
+         if ( ( GetBasePriority(nextTask) > TasksVar[actualTask].ActualPriority )
+#if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF)
+              /* with EDF the priority is the preemption level, the next task
+               * shall also have an earlier deadline */
+              && ( DeadlineBefore(TasksVar[nextTask].Deadline, TasksVar[actualTask].Deadline) )
+#endif /* #if (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) */
+#if (PARTITIONS_COUNT != 0)
+              /* a task out of its partition window is preempted by the tasks
+               * of the active partition and of the background */
+              || ( ( TasksConst[actualTask].Partition != ActivePartition ) &&
+                   ( TasksConst[nextTask].Partition != TasksConst[actualTask].Partition ) )
+#endif /* #if (PARTITIONS_COUNT != 0) */
+#if (ROUND_ROBIN == OSEK_ENABLE)
+              /* the time slice of the actual task is over and it has been
+               * moved to the end of its ready list */
+              || ( ( nextTask != actualTask ) &&
+                   ( GetBasePriority(nextTask) == GetBasePriority(actualTask) ) &&
+                   ( TasksVar[actualTask].ActualPriority == GetBasePriority(actualTask) ) )
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+            )
          {
 
 #if (HOOK_POSTTASKHOOK == OSEK_ENABLE)
@@ -194,9 +258,21 @@ extern StatusType Schedule
 
             /* \req OSEK_SYS_3.4.1.2 the current task is put into the ready state */
             TasksVar[actualTask].Flags.State = TASK_ST_READY;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+            /* a preempted task stays before the tasks which have not been
+             * started also if its priority is changed */
+            TasksVar[actualTask].Flags.Preempted = 1;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
 
             /* set the new task to running */
             TasksVar[nextTask].Flags.State = TASK_ST_RUNNING;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+            TasksVar[nextTask].Flags.Preempted = 0;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+#if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE)
+            /* the task occupies its internal resources while it is running */
+            TasksVar[nextTask].ActualPriority = GetCeilingPriority(nextTask, TRUE);
+#endif /* #if (OSEK_INTERNAL_RESOURCES == OSEK_ENABLE) */
 
             /* set as running task */
             SetRunningTask(nextTask);
@@ -204,6 +280,11 @@ extern StatusType Schedule
             /* set actual context task */
             SetActualContext(CONTEXT_TASK);
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+            /* record the switch from the preempted task */
+            TraceSwitch(nextTask, TRUE);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
             IntSecure_End();
 
 #if (HOOK_PRETASKHOOK == OSEK_ENABLE)
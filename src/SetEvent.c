@@ -132,6 +132,11 @@ StatusType SetEvent
           * of the events specified in Mask */
          TasksVar[TaskID].Events |= ( Mask & TasksConst[TaskID].EventsMask );
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+         /* record the event */
+         TraceAdd(TRACE_REC_SETEVENT, 0, TaskID, Mask);
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
          /* if the task is waiting and one waiting event occurrs set it to ready */
          if ( ( TasksVar[TaskID].Flags.State == TASK_ST_WAITING ) &&
               ( TasksVar[TaskID].EventsWait & TasksVar[TaskID].Events ) )
@@ -0,0 +1,166 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os SetTaskPriority Implementation File
+ **
+ ** This file implements the SetTaskPriority API
+ **
+ ** \file SetTaskPriority.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+StatusType SetTaskPriority
+(
+   TaskType TaskID,
+   PriorityType Priority
+)
+{
+   StatusType ret = E_OK;
+   TaskPriorityType priority = (TaskPriorityType)Priority;
+
+#if ( (RESOURCES_COUNT != 0) && \
+      (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) )
+   uint8 loopi;
+#endif /* #if ( (RESOURCES_COUNT != 0) && ... */
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( TaskID >= TASKS_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else if ( Priority >= READYLISTS_COUNT )
+   {
+      ret = E_OS_VALUE;
+   }
+   else
+   {
+#if (RESOURCES_COUNT != 0)
+      /* the priority shall not be higher than the ceiling of the resources
+       * used by the task, otherwise the ceilings do not protect them */
+      for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+      {
+         if ( ( TasksConst[TaskID].ResourcesMask & ( 1 << loopi ) ) &&
+              ( Priority > ResourcesPriority[loopi] ) )
+         {
+            ret = E_OS_VALUE;
+         }
+      }
+#endif /* #if (RESOURCES_COUNT != 0) */
+   }
+
+   if ( ret == E_OK )
+#endif /* #if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) */
+   {
+      IntSecure_Start();
+
+      if ( GetBasePriority(TaskID) != priority )
+      {
+         MoveReady(TaskID, priority);
+
+         /* the actual priority is the new priority raised to the ceiling of
+          * the occupied resources, a running task also occupies its
+          * internal resources */
+#if (RESOURCES_COUNT != 0)
+         priority = GetCeilingPriority(TaskID,
+               ( TASK_ST_RUNNING == TasksVar[TaskID].Flags.State ) );
+#endif /* #if (RESOURCES_COUNT != 0) */
+         TasksVar[TaskID].ActualPriority = priority;
+      }
+
+      IntSecure_End();
+
+#if (NON_PREEMPTIVE == OSEK_DISABLE)
+      /* check if called from a Task Context, if called from an ISR2 the
+       * scheduler is called at the end of the ISR2 */
+      if ( GetCallingContext() ==  CONTEXT_TASK )
+      {
+         if ( TasksConst[GetRunningTask()].ConstFlags.Preemtive )
+         {
+            /* the scheduler only switches the task if another task has now
+             * a higher priority than the running task */
+            SetActualContext(CONTEXT_SYS);
+
+            (void)Schedule();
+
+            /* restore the task context */
+            SetActualContext(CONTEXT_TASK);
+         }
+      }
+#endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_SetTaskPriority);
+      SetError_Param1(TaskID);
+      SetError_Param2(Priority);
+      SetError_Ret(ret);
+      SetError_Msg("SetTaskPriority returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
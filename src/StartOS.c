@@ -50,6 +50,9 @@
 
 /*==================[inclusions]=============================================*/
 #include "Os_Internal.h"
+#if (OSEK_BOOT_IMAGE == OSEK_ENABLE)
+#include <string.h>
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_ENABLE) */
 
 /*==================[macros and definitions]=================================*/
 
@@ -90,6 +93,33 @@ void StartOS
    /* StartOs_Arch */
    StartOs_Arch();
 
+#if (OSEK_TRACE == OSEK_ENABLE)
+   /* start the trace, a stopped trace is kept */
+   TraceInit();
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+#if (OSEK_LOG == OSEK_ENABLE)
+   /* the messages of the log are kept */
+   LogInit();
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+   /* clear the statistics of the isrs */
+   IsrMonitorInit();
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
+#if (OSEK_BOOT_IMAGE == OSEK_ENABLE)
+   /* restore the state of the kernel after the start of this application
+    * mode, the auto start tasks are ready and the auto start alarms are set */
+   memcpy(TasksVar, BootImage[Mode].TasksVar, sizeof(TasksVar));
+   memcpy(ReadyVar, BootImage[Mode].ReadyVar, sizeof(ReadyVar));
+   memcpy(ReadyLists, BootImage[Mode].ReadyLists, sizeof(ReadyLists));
+#if (ALARMS_COUNT != 0)
+   memcpy(AlarmsVar, BootImage[Mode].AlarmsVar, sizeof(AlarmsVar));
+   memcpy(CountersVar, BootImage[Mode].CountersVar, sizeof(CountersVar));
+#endif /* #if (ALARMS_COUNT != 0) */
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_ENABLE) */
+
    /* init every task */
    for( loopi = 0; loopi < TASKS_COUNT; loopi++)
    {
@@ -97,6 +127,21 @@ void StartOS
        ** code is being executed from the first statement. */
       SetEntryPoint(loopi); /* set task entry point */
 
+#if ( (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) && \
+      (OSEK_BOOT_IMAGE == OSEK_DISABLE) )
+      /* start with the configured priority */
+      TasksVar[loopi].BasePriority = TasksConst[loopi].StaticPriority;
+#endif /* #if ( (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) && ... */
+
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+      /* the auto start activations, also the ones of the boot image, have
+       * the argument 0 */
+      if (NULL != TasksConst[loopi].ArgQueue)
+      {
+         TasksConst[loopi].ArgQueue[TasksVar[loopi].ArgQueueStart] = 0;
+      }
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
+
 #if (STACK_CHECK_TYPE != STACK_CHECK_OFF)
 #if (STACK_CHECK_TYPE == STACK_CHECK_OVERFLOW)
       /* if the stack check for overflow is enable set the first 4 bytes of the
@@ -120,12 +165,58 @@ void StartOS
 #endif
    }
 
+#if (SEMAPHORES_COUNT != 0)
+   /* init every semaphore */
+   for (loopi = 0; loopi < SEMAPHORES_COUNT; loopi++)
+   {
+      SemaphoresVar[loopi].Count = SemaphoresConst[loopi].InitValue;
+      SemaphoresVar[loopi].WaitList = INVALID_TASK;
+   }
+#endif /* #if (SEMAPHORES_COUNT != 0) */
+
+#if (DATA_COUNT != 0)
+   /* no data has been written, the third buffer of a triple buffer is the
+    * spare one */
+   for (loopi = 0; loopi < DATA_COUNT; loopi++)
+   {
+      DataVar[loopi].Sequence = 0;
+      DataVar[loopi].WriteBuffer = 0;
+      DataVar[loopi].Exchange = 1;
+      DataVar[loopi].ReadBuffer = 2;
+   }
+#endif /* #if (DATA_COUNT != 0) */
+
+#if (PIPELINES_COUNT != 0)
+   PipelineInit();
+#endif /* #if (PIPELINES_COUNT != 0) */
+
+#if (PARTITIONS_COUNT != 0)
+   /* start the major frame with the first window */
+   PartitionWindow = 0;
+   PartitionWindowTime = 0;
+   ActivePartition = PartitionWindows[0].Partition;
+   PartitionSwitched = FALSE;
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+   /* no time slice has been started */
+   RoundRobinTask = INVALID_TASK;
+   RoundRobinTime = 0;
+   RoundRobinExpired = FALSE;
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   /* link the ready lists of the boot image, the other nodes are free */
+   InitReadyNodes();
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
    /* set sys context */
    SetActualContext(CONTEXT_SYS);
 
    /* set actual task to invalid task */
    SetRunningTask(INVALID_TASK);
 
+#if (OSEK_BOOT_IMAGE == OSEK_DISABLE)
    /* add to ready the corresponding tasks for this
     * Application Mode */
    for (loopi = 0; loopi < AutoStart[Mode].TotalTasks; loopi++)
@@ -141,6 +232,7 @@ void StartOS
          (void)SetRelAlarm(AutoStartAlarm[loopi].Alarm, AutoStartAlarm[loopi].AlarmTime, AutoStartAlarm[loopi].AlarmCycleTime);
       }
    }
+#endif /* #if (OSEK_BOOT_IMAGE == OSEK_DISABLE) */
 
 #if (HOOK_STARTUPHOOK == OSEK_ENABLE)
    StartupHook();
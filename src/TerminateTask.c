@@ -129,6 +129,9 @@ StatusType TerminateTask
 
       /* decrement activations for this task */
       TasksVar[GetRunningTask()].Activations--;
+#if (OSEK_ACTIVATION_ARG == OSEK_ENABLE)
+      NextActivationArg(GetRunningTask());
+#endif /* #if (OSEK_ACTIVATION_ARG == OSEK_ENABLE) */
 
       if (TasksVar[GetRunningTask()].Activations == 0)
       {
@@ -147,6 +150,11 @@ StatusType TerminateTask
       /* \req OSEK_SYS_3.1.2-3/3 The operating system shall ensure that the task
        ** code is being executed from the first statement. */
       SetEntryPoint(GetRunningTask());
+#if ( (OSEK_TRACE == OSEK_ENABLE) && \
+      (OSEK_SCHEDULING == OSEK_SCHEDULING_EDF) )
+      /* check the deadline before the one of the next activation is set */
+      TraceCheckDeadline(GetRunningTask());
+#endif /* #if ( (OSEK_TRACE == OSEK_ENABLE) && ... */
       /* remove ready list */
       RemoveTask(GetRunningTask());
       /* set running task to invalid */
@@ -0,0 +1,190 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os WaitSemaphore Implementation File
+ **
+ ** This file implements the WaitSemaphore API
+ **
+ ** \file WaitSemaphore.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (SEMAPHORES_COUNT != 0)
+StatusType WaitSemaphore
+(
+   SemaphoreType SemID
+)
+{
+   volatile uint8 flag = 1;
+   TaskType task;
+   TaskType prev;
+   TaskPriorityType priority;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( SemID >= SEMAPHORES_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else if ( GetCallingContext() != CONTEXT_TASK )
+   {
+      ret = E_OS_CALLEVEL;
+   }
+   else if ( !TasksConst[GetRunningTask()].ConstFlags.Extended )
+   {
+      ret = E_OS_ACCESS;
+   }
+   else if ( TasksVar[GetRunningTask()].Resources != 0 )
+   {
+      ret = E_OS_RESOURCE;
+   }
+   else
+#endif
+   {
+      /* enter to critical code */
+      IntSecure_Start();
+
+      if ( SemaphoresVar[SemID].Count > 0 )
+      {
+         /* take one unit of the semaphore */
+         SemaphoresVar[SemID].Count--;
+
+         /* finish cirtical code */
+         IntSecure_End();
+      }
+      else
+      {
+         /* look for the position in the wait list, the task is placed after
+          * all tasks with the same or higher priority */
+         priority = GetBasePriority(GetRunningTask());
+         prev = INVALID_TASK;
+         task = SemaphoresVar[SemID].WaitList;
+         while ( ( INVALID_TASK != task ) &&
+                 ( GetBasePriority(task) >= priority ) )
+         {
+            prev = task;
+            task = TasksVar[task].SemaphoreNext;
+         }
+
+         /* insert the running task in the wait list */
+         TasksVar[GetRunningTask()].SemaphoreNext = task;
+         if ( INVALID_TASK == prev )
+         {
+            SemaphoresVar[SemID].WaitList = GetRunningTask();
+         }
+         else
+         {
+            TasksVar[prev].SemaphoreNext = GetRunningTask();
+         }
+
+         /* the task waits in the same state as for WaitEvent, the wait mask
+          * is cleared so SetEvent does not set the task to ready */
+         TasksVar[GetRunningTask()].Flags.State = TASK_ST_WAITING;
+         TasksVar[GetRunningTask()].EventsWait = 0;
+
+         /* save actual task context */
+         SaveContext(GetRunningTask());
+
+         if (flag)
+         {
+            /* execute this code only ones */
+            flag = 0;
+
+            /* remove of the Ready List */
+            RemoveTask(GetRunningTask());
+
+            /* set system context */
+            SetActualContext(CONTEXT_SYS);
+
+            /* set running task to invalid */
+            SetRunningTask(INVALID_TASK);
+
+            /* finish cirtical code */
+            IntSecure_End();
+
+            /* the unit of the semaphore is handed over by PostSemaphore,
+             * when this task runs again the semaphore is taken */
+            (void)Schedule();
+         }
+         else
+         {
+            /* finish critical code */
+            IntSecure_End();
+         }
+      }
+   }
+
+#if ( (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED) && \
+      (HOOK_ERRORHOOK == OSEK_ENABLE) )
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_WaitSemaphore);
+      SetError_Param1(SemID);
+      SetError_Ret(ret);
+      SetError_Msg("WaitSemaphore returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (SEMAPHORES_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
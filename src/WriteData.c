@@ -0,0 +1,151 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/** \brief FreeOSEK Os WriteData Implementation File
+ **
+ ** This file implements the WriteData API
+ **
+ ** \file WriteData.c
+ **
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Global
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+#if (DATA_COUNT != 0)
+StatusType WriteData
+(
+   DataType DataID,
+   const void * Value
+)
+{
+   uint32 sequence;
+   uint32 previous;
+   StatusType ret = E_OK;
+
+#if (ERROR_CHECKING_TYPE == ERROR_CHECKING_EXTENDED)
+   if ( DataID >= DATA_COUNT )
+   {
+      ret = E_OS_ID;
+   }
+   else
+#endif
+   {
+      if ( DataConst[DataID].Type == DATA_SEQLOCK )
+      {
+         sequence = DataVar[DataID].Sequence;
+
+         /* an odd sequence sends the readers to the second copy while the
+          * first one is written */
+         DataVar[DataID].Sequence = sequence + 1U;
+         DataBarrier();
+
+         DataCopy(DataConst[DataID].Buffer, Value, DataConst[DataID].Size);
+
+         DataBarrier();
+
+         /* an even sequence sends the readers back to the first copy, which
+          * is complete now, and the second copy is updated. A sequence of 0
+          * marks a data never written, therefore it is skipped on overflow */
+         sequence += 2U;
+         if ( sequence == 0U )
+         {
+            sequence = 2U;
+         }
+         DataVar[DataID].Sequence = sequence;
+         DataBarrier();
+
+         DataCopy(&DataConst[DataID].Buffer[DataConst[DataID].Words], Value,
+               DataConst[DataID].Size);
+      }
+      else
+      {
+         /* write the buffer owned by the writer, the reader can not get it
+          * before the exchange */
+         DataCopy(&DataConst[DataID].Buffer[
+                  DataVar[DataID].WriteBuffer * DataConst[DataID].Words],
+               Value, DataConst[DataID].Size);
+
+         DataBarrier();
+
+         /* publish it as spare buffer and take the old spare buffer, which
+          * may have never been read */
+         AtomicExchange_Arch(&DataVar[DataID].Exchange,
+               (uint32)DataVar[DataID].WriteBuffer | DATA_FRESH, previous);
+         DataVar[DataID].WriteBuffer = (uint8)(previous & ~DATA_FRESH);
+
+         DataVar[DataID].Sequence = 1U;
+      }
+   }
+
+#if (HOOK_ERRORHOOK == OSEK_ENABLE)
+   if ( ( ret != E_OK ) && (ErrorHookRunning != 1))
+   {
+      SetError_Api(OSServiceId_WriteData);
+      SetError_Param1(DataID);
+      SetError_Param2((unsigned int)Value);
+      SetError_Ret(ret);
+      SetError_Msg("WriteData returns != than E_OK");
+      SetError_ErrorHook();
+   }
+#endif
+
+   return ret;
+}
+#endif /* #if (DATA_COUNT != 0) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
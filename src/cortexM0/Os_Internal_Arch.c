@@ -113,7 +113,7 @@ void ReturnHook_Arch(void)
 
 
 
-void CheckTerminatingTask_Arch(void)
+OSEK_HOT_CODE void CheckTerminatingTask_Arch(void)
 {
    /*
     * If there is task being terminated, destroy its context information and
@@ -283,6 +283,13 @@ void RIT_IRQHandler(void)
 
 #endif /* #if (ALARMS_COUNT != 0) */
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+      /* perform the activations and events posted by ISR1 */
+      IntSecure_Start();
+      ProcessIsr1Pending();
+      IntSecure_End();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
       /* reset context */
       SetActualContext(actualContext);
 
@@ -302,6 +309,22 @@ void RIT_IRQHandler(void)
 
 #endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
 
+#if (PARTITIONS_COUNT != 0)
+      if (PartitionSwitched)
+      {
+         PartitionSwitched = FALSE;
+
+         /* a new partition window started, the running task is rescheduled
+          * even if it is non preemptive, preemptive tasks are already
+          * rescheduled above */
+         if ( ( CONTEXT_TASK == actualContext ) &&
+              ( !TasksConst[GetRunningTask()].ConstFlags.Preemtive ) )
+         {
+            PostIsr2_Arch(isr);
+         }
+      }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
       Chip_RIT_ClearInt(LPC_RITIMER);
 
       NVIC_ClearPendingIRQ(RITIMER_IRQn);
@@ -47,6 +47,10 @@
    .thumb_func
    .syntax unified
 
+   /* hot kernel code, executed from RAM with HOTSECTIONS */
+   .section .text.osek_hot.PendSV_Handler,"ax",%progbits
+   .align 2
+
    .global PendSV_Handler
    .extern Osek_OldTaskPtr_Arch,Osek_NewTaskPtr_Arch,CheckTerminatingTask_Arch
 
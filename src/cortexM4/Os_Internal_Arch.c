@@ -70,15 +70,15 @@
 
 
 
-TaskType cortexM4TerminatedTaskID = INVALID_TASK;
+/*==================[external data definition]===============================*/
 
-TaskContextType cortexM4NullContext;
 
-TaskContextRefType cortexM4ActiveContextPtr = &cortexM4NullContext;
 
+TaskContextType cortexM4NullContext;
 
+TaskContextRefType cortexM4ActiveContextPtr = &cortexM4NullContext;
 
-/*==================[external data definition]===============================*/
+TaskContextRefType cortexM4NextContextPtr = &cortexM4NullContext;
 
 
 
@@ -202,9 +202,18 @@ void cortexM4ResetTaskContext(uint8 TaskID)
     *
     * */
 
+   /*
+    * The task is started over cortexM4TaskStart(), which keeps the stack
+    * pointer of the task below this initial context and jumps to the entry
+    * point passed in R0. The initial context is therefore never overwritten
+    * and SetEntryPoint() only has to reset the stack pointer of the task.
+    *
+    * */
+
    taskStackRegionPtr[taskStackSizeWords - 1] = (uint32) (1 << 24);                       /* xPSR.T = 1 */
-   taskStackRegionPtr[taskStackSizeWords - 2] = (uint32) TasksConst[TaskID].EntryPoint;   /* initial PC */
+   taskStackRegionPtr[taskStackSizeWords - 2] = (uint32) cortexM4TaskStart;               /* initial PC */
    taskStackRegionPtr[taskStackSizeWords - 3] = (uint32) cortexM4ReturnHook;              /* Stacked LR */
+   taskStackRegionPtr[taskStackSizeWords - 8] = (uint32) TasksConst[TaskID].EntryPoint;   /* R0 */
 
    /*
     *  BLOCK 3
@@ -267,21 +276,7 @@ void cortexM4ResetTaskContext(uint8 TaskID)
     *
     */
 
-   TasksConst[TaskID].TaskContext->stackTopPointer   = &(taskStackRegionPtr[taskStackSizeWords - 17]);
-}
-
-
-
-void cortexM4UpdateActiveTaskContextPtr()
-{
-   if (cortexM4TerminatedTaskID != INVALID_TASK)
-   {
-      cortexM4ResetTaskContext(cortexM4TerminatedTaskID);
-
-      cortexM4TerminatedTaskID = INVALID_TASK;
-   }
-
-   cortexM4ActiveContextPtr = TasksConst[RunningTask].TaskContext;
+   TasksConst[TaskID].TaskContext->stackTopPointer   = cortexM4InitialStackTop(TaskID);
 }
 
 
@@ -295,6 +290,11 @@ void SysTick_Handler(void)
    /* Set ISR2 context. */
    SetActualContext(CONTEXT_ISR2);
 
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+   /* unmask the isrs whose back off time is over */
+   IsrMonitorTick();
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
 #if (ALARMS_COUNT != 0)
 
    /* Counter increment. */
@@ -319,6 +319,13 @@ void SysTick_Handler(void)
 
 #endif /* #if (ALARMS_COUNT != 0) */
 
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+   /* perform the activations and events posted by ISR1 */
+   IntSecure_Start();
+   ProcessIsr1Pending();
+   IntSecure_End();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
    /* reset context */
    SetActualContext(actualContext);
 
@@ -337,6 +344,23 @@ void SysTick_Handler(void)
    }
 
 #endif /* #if (NON_PREEMPTIVE == OSEK_DISABLE) */
+
+#if (PARTITIONS_COUNT != 0)
+   if (PartitionSwitched)
+   {
+      PartitionSwitched = FALSE;
+
+      /* a new partition window started, the running task is rescheduled
+       * even if it is non preemptive, preemptive tasks are already
+       * rescheduled above */
+      if ( ( CONTEXT_TASK == actualContext ) &&
+           ( !TasksConst[GetRunningTask()].ConstFlags.Preemtive ) )
+      {
+         PostIsr2_Arch(isr);
+      }
+   }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
 }
 
 
@@ -47,10 +47,13 @@
    .thumb_func
    .syntax unified
 
-    /* .section .after_vectors */
+   /* hot kernel code, executed from RAM with HOTSECTIONS */
+   .section .text.osek_hot.PendSV_Handler,"ax",%progbits
+   .align 2
 
    .global PendSV_Handler
-   .extern cortexM4ActiveContextPtr,cortexM4UpdateActiveTaskContextPtr
+   .global cortexM4TaskStart
+   .extern cortexM4ActiveContextPtr,cortexM4NextContextPtr
 
    /*
     * Pendable Service Call, used for context-switching in all Cortex-M processors
@@ -152,43 +155,33 @@ PendSV_Handler:
     * Update the pointer to the top of the stack in the
     * task context block.
     *
+    * If the calling task has been terminated the pointer points to
+    * cortexM4NullContext, see SetEntryPoint(), and the stored value
+    * is discarded.
+    *
     */
 
    ldr   r1,=cortexM4ActiveContextPtr
    ldr   r2,[r1]           /* Load the address of the stack pointer.    */
    str   r0,[r2]           /* Store the updated value of the stack ptr. */
 
-
-   /* ************************************* */
-   /* ************************************* */
-   /* ************************************* */
-
-
    /*
-    * Update the pointer to the context data of the
-    * currently active task.
-    *
-    * This is done in an external C routine.
+    * Update the pointer to the context data of the currently active
+    * task with the one of the task being activated. The pointer has
+    * already been computed by the scheduler in CallTask()/JmpTask()
+    * before this exception was pended.
     * */
 
-   push {lr}
-
-   bl cortexM4UpdateActiveTaskContextPtr
-
-   pop {lr}
-
-   /* ************************************* */
-   /* ************************************* */
-   /* ************************************* */
+   ldr   r2,=cortexM4NextContextPtr
+   ldr   r2,[r2]
+   str   r2,[r1]
 
    /*
     * Load the stack pointer of the task being activated from its
     * task context block.
     * */
 
-   ldr   r1,=cortexM4ActiveContextPtr
-   ldr   r1,[r1]
-   ldr   r0,[r1]
+   ldr   r0,[r2]
 
    /*
     * Recover the values of the registers in BLOCK 4.
@@ -254,3 +247,19 @@ PendSV_Handler:
     */
 
    bx lr
+
+   /*
+    * Initial program counter of every task, see cortexM4ResetTaskContext().
+    *
+    * The stack pointer is moved below the initial context built at the top
+    * of the task stack. Since the task never writes there the initial context
+    * stays valid and a terminated task can be started again by only resetting
+    * its stack pointer, without rebuilding the context. The entry point of
+    * the task is passed in R0, LR already contains cortexM4ReturnHook.
+    * */
+
+   .thumb_func
+cortexM4TaskStart:
+
+   sub   sp,sp,#72         /* 17 words of initial context, 8 byte aligned. */
+   bx    r0
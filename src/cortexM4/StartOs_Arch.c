@@ -62,10 +62,26 @@
 
 
 /*==================[internal data declaration]==============================*/
+#if (OSEK_HOT_SECTIONS == OSEK_ENABLE)
+/* limits of the hot sections, defined by the linker script fragment */
+extern uint32 __osek_hot_text_load[];
+extern uint32 __osek_hot_text_start[];
+extern uint32 __osek_hot_text_end[];
+extern uint32 __osek_hot_bss_start[];
+extern uint32 __osek_hot_bss_end[];
+#endif /* #if (OSEK_HOT_SECTIONS == OSEK_ENABLE) */
 
 
 
 /*==================[internal functions declaration]=========================*/
+#if (OSEK_HOT_SECTIONS == OSEK_ENABLE)
+/** \brief Copy the hot kernel code to RAM and clear the hot kernel data
+ **
+ ** Shall be called before any hot code is executed, the copied code is
+ ** synchronized with the instruction fetch before it returns.
+ **/
+static void StartHotSections(void);
+#endif /* #if (OSEK_HOT_SECTIONS == OSEK_ENABLE) */
 
 
 
@@ -78,6 +94,29 @@
 
 
 /*==================[internal functions definition]==========================*/
+#if (OSEK_HOT_SECTIONS == OSEK_ENABLE)
+static void StartHotSections(void)
+{
+   uint32 * src = __osek_hot_text_load;
+   uint32 * dst = __osek_hot_text_start;
+
+   /* the code is copied again on a RestartOS, it has not been modified */
+   while (dst < __osek_hot_text_end)
+   {
+      *dst = *src;
+      dst++;
+      src++;
+   }
+
+   /* the hot data is kernel data without initial value */
+   for (dst = __osek_hot_bss_start; dst < __osek_hot_bss_end; dst++)
+   {
+      *dst = 0;
+   }
+
+   __asm__ __volatile__ ("dsb \n\t isb" : : : "memory" );
+}
+#endif /* #if (OSEK_HOT_SECTIONS == OSEK_ENABLE) */
 
 
 
@@ -98,6 +137,11 @@ void StartOs_Arch(void)
 {
    uint8 loopi;
 
+#if (OSEK_HOT_SECTIONS == OSEK_ENABLE)
+   /* before the first call to the hot code */
+   StartHotSections();
+
+#endif /* #if (OSEK_HOT_SECTIONS == OSEK_ENABLE) */
    /*
     * Set the the stacks of all the tasks to an initialized
     * state.
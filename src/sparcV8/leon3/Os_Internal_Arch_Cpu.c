@@ -655,6 +655,13 @@ void sparcCheckPendingTimerInterrupts()
             IncrementCounter(sparcGetHardwareTimerID(timerIndex), 1);
             IntSecure_End();
 #endif
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+            /* perform the activations and events posted by ISR1 */
+            IntSecure_Start();
+            ProcessIsr1Pending();
+            IntSecure_End();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
          }
       }
    }
@@ -0,0 +1,172 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, Juan Cecconi
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Log Architecture Dependece Implementation File
+ **
+ ** This file implements the saving of the log to a file of the host and the
+ ** printing of the log in a thread of the host.
+ **
+ ** \file x86/Log_Arch.c
+ ** \arch x86
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+#if (OSEK_LOG == OSEK_ENABLE)
+#include <stdio.h>
+#include <time.h>
+#include <signal.h>
+#include <pthread.h>
+
+/*==================[macros and definitions]=================================*/
+/** \brief Period of the log printer thread in nanoseconds */
+#define LOG_PRINT_PERIOD_NS      1000000L
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Log printer thread
+ **
+ ** Prints the messages of the log until the process is terminated.
+ **/
+static void * LogPrintThread(void * Parameter);
+
+/*==================[internal data definition]===============================*/
+/** \brief Copy of the log written by LogSave_Arch */
+static LogType LogImage;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void * LogPrintThread(void * Parameter)
+{
+   LogEntryType entry;
+   struct timespec period = { 0, LOG_PRINT_PERIOD_NS };
+
+   while (1)
+   {
+      while (E_OK == ReadLog(&entry))
+      {
+         if (0U != entry.Lost)
+         {
+            printf("log: %u messages lost\n", (unsigned int)entry.Lost);
+         }
+         printf("%10u %-3s %3u: ", (unsigned int)entry.Time,
+               entry.Isr ? "isr" : "", (unsigned int)entry.Task);
+         if (NULL == entry.Text)
+         {
+            printf("unknown format %u", (unsigned int)entry.Format);
+         }
+         else
+         {
+            printf(entry.Text, entry.Args[0], entry.Args[1], entry.Args[2]);
+         }
+         printf("\n");
+      }
+      fflush(stdout);
+      nanosleep(&period, NULL);
+   }
+
+   return Parameter;
+}
+
+/*==================[external functions definition]==========================*/
+StatusType LogSave_Arch(const char * FileName)
+{
+   StatusType ret = E_OK;
+   FILE * file;
+
+   /* the writers are not stopped, the records being written are ignored
+    * by the decoder with their sequence */
+   LogImage = Osek_Log;
+
+   file = fopen(FileName, "wb");
+   if (NULL == file)
+   {
+      ret = E_OS_ACCESS;
+   }
+   else
+   {
+      if (1 != fwrite(&LogImage, sizeof(LogImage), 1, file))
+      {
+         ret = E_OS_ACCESS;
+      }
+      if (0 != fclose(file))
+      {
+         ret = E_OS_ACCESS;
+      }
+   }
+
+   return ret;
+}
+
+StatusType LogPrint_Arch(void)
+{
+   StatusType ret = E_OK;
+   pthread_t thread;
+   sigset_t signals;
+   sigset_t previous;
+
+   /* the interrupts of the os are signals, the thread inherits the mask
+    * and shall never run an interrupt handler */
+   sigfillset(&signals);
+   pthread_sigmask(SIG_BLOCK, &signals, &previous);
+   if (0 != pthread_create(&thread, NULL, LogPrintThread, NULL))
+   {
+      ret = E_OS_ACCESS;
+   }
+   else
+   {
+      (void)pthread_detach(thread);
+   }
+   pthread_sigmask(SIG_SETMASK, &previous, NULL);
+
+   return ret;
+}
+#endif /* #if (OSEK_LOG == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -72,7 +72,9 @@ void ScheduleInterrupts(void)
 
    if (InterruptState)
    {
-      InterruptToBeExecuted = ( InterruptFlag & ( (InterruptFlagsType) ~InterruptMask ) );
+      InterruptToBeExecuted = ( InterruptFlag &
+                                ( (InterruptFlagsType) ~( InterruptMask | InterruptThrottled |
+                                                         InterruptResources ) ) );
       while(InterruptToBeExecuted != 0)
       {
          if (InterruptToBeExecuted & 1)
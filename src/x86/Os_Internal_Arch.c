@@ -75,6 +75,10 @@ uint32 OsekHWTimer0;
 
 InterruptFlagsType InterruptFlag;
 
+InterruptFlagsType InterruptThrottled;
+
+InterruptFlagsType InterruptResources;
+
 uint32* OSEK_InterruptFlags;
 
 #ifdef CPUTYPE
@@ -82,10 +86,14 @@ uint32* OSEK_InterruptFlags;
 uint64 OsStack;
 
 uint64 OsekStack;
+
+uint64 OsRestartStack;
 #elif ( CPUTYPE == ia32 )
 uint32 OsStack;
 
 uint32 OsekStack;
+
+uint32 OsRestartStack;
 #else /* #if ( CPUTYPE == ia64 ) */
 #error Unknown CPUTYPE for ARCH x86
 #endif /* #if ( CPUTYPE == ia64 ) */
@@ -161,9 +169,53 @@ static uint8 OSEK_GetFirstIsr(void)
 /*==================[external functions definition]==========================*/
 void OSEK_ISR_HWTimer0(void)
 {
+#if (OSEK_ISR_MONITOR == OSEK_ENABLE)
+   /* unmask the isrs whose back off time is over */
+   IsrMonitorTick();
+#endif /* #if (OSEK_ISR_MONITOR == OSEK_ENABLE) */
+
 #if (ALARMS_COUNT != 0)
    IncrementCounter(HardwareCounter, 1);
 #endif /* #if (ALARMS_COUNT != 0) */
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+   /* perform the activations and events posted by ISR1 */
+   ProcessIsr1Pending();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
+
+#if (PARTITIONS_COUNT != 0)
+   if (PartitionSwitched)
+   {
+      PartitionSwitched = FALSE;
+
+      /* a new partition window started, the running task is rescheduled
+       * even if it is non preemptive */
+      if ( GetCallingContext() == CONTEXT_TASK )
+      {
+         SetActualContext(CONTEXT_SYS);
+
+         (void)Schedule();
+
+         SetActualContext(CONTEXT_TASK);
+      }
+   }
+#endif /* #if (PARTITIONS_COUNT != 0) */
+
+#if (ROUND_ROBIN == OSEK_ENABLE)
+   if (RoundRobinExpired)
+   {
+      /* the time slice of the running task is over, only preemptive tasks
+       * are rotated, the scheduler rotates the task and clears the flag */
+      if ( GetCallingContext() == CONTEXT_TASK )
+      {
+         SetActualContext(CONTEXT_SYS);
+
+         (void)Schedule();
+
+         SetActualContext(CONTEXT_TASK);
+      }
+   }
+#endif /* #if (ROUND_ROBIN == OSEK_ENABLE) */
 }
 
 void OSEK_ISR_HWTimer1(void)
@@ -173,6 +225,11 @@ void OSEK_ISR_HWTimer1(void)
    IncrementCounter(HWCOUNTER1, 1);
 #endif /* #if (ALARMS_COUNT != 0) */
 #endif /* #if (defined HWCOUNTER1) */
+
+#if (OSEK_ISR1_PENDING == OSEK_ENABLE)
+   /* perform the activations and events posted by ISR1 */
+   ProcessIsr1Pending();
+#endif /* #if (OSEK_ISR1_PENDING == OSEK_ENABLE) */
 }
 
 void OsInterruptHandler(int signal)
@@ -201,7 +258,8 @@ void OsInterruptHandler(int signal)
          printf("Interrupt: %d\n",interrupt);
 #endif
          if ( (InterruptState) &&
-               ( (InterruptMask & (1 << interrupt ) )  == 0 ) )
+               ( ( (InterruptMask | InterruptThrottled | InterruptResources) &
+                   (1 << interrupt ) )  == 0 ) )
          {
             InterruptTable[interrupt]();
          }
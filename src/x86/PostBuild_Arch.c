@@ -0,0 +1,645 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, Juan Cecconi
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Post Build Architecture Dependece Implementation File
+ **
+ ** This file implements the loading of the configuration from a post build
+ ** image at the start of the os.
+ **
+ ** \file x86/PostBuild_Arch.c
+ ** \arch x86
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+#if (OSEK_POST_BUILD == OSEK_ENABLE)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+/** \brief Post Build Image Type
+ **
+ ** Complete content of a post build image of this configuration
+ **/
+typedef struct {
+   PostBuildHeaderType Header;
+   PostBuildTaskType Tasks[TASKS_COUNT];
+#if (RESOURCES_COUNT != 0)
+   PostBuildResourceType Resources[RESOURCES_COUNT];
+#endif /* #if (RESOURCES_COUNT != 0) */
+#if (ALARMS_COUNT != 0)
+   PostBuildAlarmType Alarms[ALARMS_COUNT];
+#endif /* #if (ALARMS_COUNT != 0) */
+#if (COUNTERS_COUNT != 0)
+   PostBuildCounterType Counters[COUNTERS_COUNT];
+#endif /* #if (COUNTERS_COUNT != 0) */
+#if (ALARM_AUTOSTART_COUNT != 0)
+   PostBuildAutoStartAlarmType AutoStartAlarms[ALARM_AUTOSTART_COUNT];
+#endif /* #if (ALARM_AUTOSTART_COUNT != 0) */
+} PostBuildImageType;
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Look up a symbol by its name
+ **
+ ** \param[in] Name name of the symbol, it shall be terminated within
+ **            POST_BUILD_NAME_SIZE characters
+ ** \return function of the symbol or NULL if not found
+ **/
+static EntryPointType PostBuildSymbol(const char * Name);
+
+/** \brief Look up the name of a function
+ **
+ ** \param[in] Function task entry point or alarm callback
+ ** \return name of the symbol or NULL if not found
+ **/
+static const char * PostBuildName(EntryPointType Function);
+
+/** \brief Check the post build image
+ **
+ ** Prints a message for the first invalid entry found.
+ **
+ ** \return TRUE if the image can be applied, FALSE in other case
+ **/
+static boolean PostBuildCheck(void);
+
+/** \brief Apply the post build image to the configuration tables */
+static void PostBuildApply(void);
+
+#if (ALARMS_COUNT != 0)
+/** \brief Order the counters of the post build image for the cascades
+ **
+ ** \param[out] Order counters in topological order, a counter incremented by
+ **             an alarm follows the counter of the alarm
+ ** \return FALSE if the counters increment each other in a loop
+ **/
+static boolean PostBuildCountersOrder(CounterType * Order);
+#endif /* #if (ALARMS_COUNT != 0) */
+
+/*==================[internal data definition]===============================*/
+/** \brief Post build image read by PostBuildLoad_Arch */
+static PostBuildImageType PostBuildImage;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static EntryPointType PostBuildSymbol(const char * Name)
+{
+   EntryPointType ret = NULL;
+   uint32f loopi;
+
+   if (NULL != memchr(Name, '\0', POST_BUILD_NAME_SIZE))
+   {
+      for (loopi = 0; (loopi < POST_BUILD_SYMBOLS_COUNT) && (NULL == ret); loopi++)
+      {
+         if (0 == strcmp(PostBuildSymbols[loopi].Name, Name))
+         {
+            ret = PostBuildSymbols[loopi].Function;
+         }
+      }
+   }
+
+   return ret;
+}
+
+static const char * PostBuildName(EntryPointType Function)
+{
+   const char * ret = NULL;
+   uint32f loopi;
+
+   for (loopi = 0; (loopi < POST_BUILD_SYMBOLS_COUNT) && (NULL == ret); loopi++)
+   {
+      if (PostBuildSymbols[loopi].Function == Function)
+      {
+         ret = PostBuildSymbols[loopi].Name;
+      }
+   }
+
+   return ret;
+}
+
+static boolean PostBuildCheck(void)
+{
+   boolean ret = TRUE;
+   uint32f loopi;
+   uint32f loopj;
+   uint32f entries = 0;
+   uint32f length;
+#if (ALARMS_COUNT != 0)
+   CounterType order[COUNTERS_COUNT];
+#endif /* #if (ALARMS_COUNT != 0) */
+
+   if ( (PostBuildImage.Header.Magic != POST_BUILD_MAGIC) ||
+        (PostBuildImage.Header.Version != POST_BUILD_VERSION) )
+   {
+      printf("Post build image: invalid magic number or version\n");
+      ret = FALSE;
+   }
+   else if ( (PostBuildImage.Header.TasksCount != TASKS_COUNT) ||
+             (PostBuildImage.Header.ResourcesCount != RESOURCES_COUNT) ||
+             (PostBuildImage.Header.AlarmsCount != ALARMS_COUNT) ||
+             (PostBuildImage.Header.CountersCount != COUNTERS_COUNT) ||
+             (PostBuildImage.Header.AutoStartAlarmsCount != ALARM_AUTOSTART_COUNT) )
+   {
+      printf("Post build image: the count of objects does not match the generated configuration\n");
+      ret = FALSE;
+   }
+
+   for (loopi = 0; (loopi < TASKS_COUNT) && (TRUE == ret); loopi++)
+   {
+      if (NULL == PostBuildSymbol(PostBuildImage.Tasks[loopi].EntryPoint))
+      {
+         printf("Post build image: task %u has an unknown entry point\n", (unsigned int)loopi);
+         ret = FALSE;
+      }
+      else if (PostBuildImage.Tasks[loopi].Priority >= READYLISTS_COUNT)
+      {
+         printf("Post build image: task %u has a priority higher than %u\n", (unsigned int)loopi, READYLISTS_COUNT - 1);
+         ret = FALSE;
+      }
+      else if ( (PostBuildImage.Tasks[loopi].MaxActivations == 0) ||
+                (PostBuildImage.Tasks[loopi].MaxActivations > 255) ||
+                ( (PostBuildImage.Tasks[loopi].Extended != 0) &&
+                  (PostBuildImage.Tasks[loopi].MaxActivations != 1) ) )
+      {
+         printf("Post build image: task %u has an invalid count of activations\n", (unsigned int)loopi);
+         ret = FALSE;
+      }
+      else if ( (RESOURCES_COUNT < 32) &&
+                ( (PostBuildImage.Tasks[loopi].ResourcesMask >> RESOURCES_COUNT) != 0 ) )
+      {
+         printf("Post build image: task %u uses an unknown resource\n", (unsigned int)loopi);
+         ret = FALSE;
+      }
+      else
+      {
+#if (RESOURCES_COUNT != 0)
+         /* the ceiling priority of each resource shall not be lower than
+          * the priority of the tasks using it */
+         for (loopj = 0; (loopj < RESOURCES_COUNT) && (TRUE == ret); loopj++)
+         {
+            if ( ( (PostBuildImage.Tasks[loopi].ResourcesMask & (1U << loopj)) != 0 ) &&
+                 ( PostBuildImage.Resources[loopj].Priority < PostBuildImage.Tasks[loopi].Priority ) )
+            {
+               printf("Post build image: resource %u has a ceiling lower than the priority of task %u\n", (unsigned int)loopj, (unsigned int)loopi);
+               ret = FALSE;
+            }
+         }
+#endif /* #if (RESOURCES_COUNT != 0) */
+      }
+      entries += PostBuildImage.Tasks[loopi].MaxActivations;
+   }
+
+#if (RESOURCES_COUNT != 0)
+   for (loopi = 0; (loopi < RESOURCES_COUNT) && (TRUE == ret); loopi++)
+   {
+      if (PostBuildImage.Resources[loopi].Priority >= READYLISTS_COUNT)
+      {
+         printf("Post build image: resource %u has a priority higher than %u\n", (unsigned int)loopi, READYLISTS_COUNT - 1);
+         ret = FALSE;
+      }
+   }
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+   for (loopi = 0; (loopi < ALARMS_COUNT) && (TRUE == ret); loopi++)
+   {
+      switch (PostBuildImage.Alarms[loopi].Action)
+      {
+         case ALARMCALLBACK:
+            if (NULL == PostBuildSymbol(PostBuildImage.Alarms[loopi].Callback))
+            {
+               printf("Post build image: alarm %u has an unknown callback\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            break;
+         case SETEVENT:
+            if (PostBuildImage.Alarms[loopi].TaskID >= TASKS_COUNT)
+            {
+               printf("Post build image: alarm %u references an unknown task\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            else if (PostBuildImage.Tasks[PostBuildImage.Alarms[loopi].TaskID].Extended == 0)
+            {
+               /* only an extended task can receive events */
+               printf("Post build image: alarm %u sets an event of a basic task\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            else if ( (PostBuildImage.Alarms[loopi].Event &
+                       ~PostBuildImage.Tasks[PostBuildImage.Alarms[loopi].TaskID].EventsMask) != 0 )
+            {
+               printf("Post build image: alarm %u sets an event not owned by the task\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            else
+            {
+               /* the alarm is valid */
+            }
+            break;
+         case ACTIVATETASK:
+            if (PostBuildImage.Alarms[loopi].TaskID >= TASKS_COUNT)
+            {
+               printf("Post build image: alarm %u references an unknown task\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            break;
+         case INCREMENT:
+            if (PostBuildImage.Alarms[loopi].Counter >= COUNTERS_COUNT)
+            {
+               printf("Post build image: alarm %u references an unknown counter\n", (unsigned int)loopi);
+               ret = FALSE;
+            }
+            break;
+         default:
+            printf("Post build image: alarm %u has an invalid action\n", (unsigned int)loopi);
+            ret = FALSE;
+            break;
+      }
+   }
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+   if ( (TRUE == ret) && (FALSE == PostBuildCountersOrder(order)) )
+   {
+      printf("Post build image: the alarms increment the counters in a loop\n");
+      ret = FALSE;
+   }
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (COUNTERS_COUNT != 0)
+   for (loopi = 0; (loopi < COUNTERS_COUNT) && (TRUE == ret); loopi++)
+   {
+      if ( (PostBuildImage.Counters[loopi].TicksPerBase == 0) ||
+           (PostBuildImage.Counters[loopi].MinCycle > PostBuildImage.Counters[loopi].MaxAllowedValue) )
+      {
+         printf("Post build image: counter %u has invalid attributes\n", (unsigned int)loopi);
+         ret = FALSE;
+      }
+   }
+#endif /* #if (COUNTERS_COUNT != 0) */
+
+#if (ALARM_AUTOSTART_COUNT != 0)
+   for (loopi = 0; (loopi < ALARM_AUTOSTART_COUNT) && (TRUE == ret); loopi++)
+   {
+      if (PostBuildImage.AutoStartAlarms[loopi].Alarm >= ALARMS_COUNT)
+      {
+         printf("Post build image: auto start alarm %u references an unknown alarm\n", (unsigned int)loopi);
+         ret = FALSE;
+      }
+   }
+#endif /* #if (ALARM_AUTOSTART_COUNT != 0) */
+
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+   if ( (TRUE == ret) && (entries > READYNODES_COUNT) )
+   {
+      /* each activation needs a node of the ready lists */
+      printf("Post build image: more than %u activations\n", (unsigned int)READYNODES_COUNT);
+      ret = FALSE;
+   }
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+
+   if (TRUE == ret)
+   {
+      /* each ready list shall fit in the ready list entries */
+      length = 0;
+      for (loopi = 0; loopi < READYLISTS_COUNT; loopi++)
+      {
+         length = 0;
+         for (loopj = 0; loopj < TASKS_COUNT; loopj++)
+         {
+            if (PostBuildImage.Tasks[loopj].Priority == loopi)
+            {
+               length += PostBuildImage.Tasks[loopj].MaxActivations;
+            }
+         }
+         if (length > 255)
+         {
+            printf("Post build image: the ready list of priority %u has more than 255 entries\n", (unsigned int)loopi);
+            ret = FALSE;
+         }
+      }
+   }
+
+   return ret;
+}
+
+static void PostBuildApply(void)
+{
+   uint32f loopi;
+   uint32f loopj;
+   uint32f offset = 0;
+   uint32f length;
+   uint32f entries = 0;
+
+   for (loopi = 0; loopi < TASKS_COUNT; loopi++)
+   {
+      TasksConst[loopi].EntryPoint = PostBuildSymbol(PostBuildImage.Tasks[loopi].EntryPoint);
+      TasksConst[loopi].StaticPriority = (TaskPriorityType)PostBuildImage.Tasks[loopi].Priority;
+      TasksConst[loopi].MaxActivations = (TaskActivationsType)PostBuildImage.Tasks[loopi].MaxActivations;
+      TasksConst[loopi].ConstFlags.Extended = (PostBuildImage.Tasks[loopi].Extended != 0);
+      TasksConst[loopi].ConstFlags.Preemtive = (PostBuildImage.Tasks[loopi].Preemtive != 0);
+      TasksConst[loopi].EventsMask = PostBuildImage.Tasks[loopi].EventsMask;
+      TasksConst[loopi].ResourcesMask = PostBuildImage.Tasks[loopi].ResourcesMask;
+#if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE)
+      /* the nodes of the ready lists follow the ones of the previous task */
+      TasksConst[loopi].ReadyNode = (TaskTotalType)entries;
+#endif /* #if (OSEK_DYNAMIC_PRIORITY == OSEK_ENABLE) */
+      entries += PostBuildImage.Tasks[loopi].MaxActivations;
+   }
+
+   /* arrange the ready lists one after the other, the ready list of the
+    * highest priority is the first one */
+   for (loopi = 0; loopi < READYLISTS_COUNT; loopi++)
+   {
+      length = 0;
+      for (loopj = 0; loopj < TASKS_COUNT; loopj++)
+      {
+         if (PostBuildImage.Tasks[loopj].Priority == ((READYLISTS_COUNT - 1) - loopi))
+         {
+            length += PostBuildImage.Tasks[loopj].MaxActivations;
+         }
+      }
+      ReadyConst[loopi].ListLength = (TaskTotalType)length;
+      ReadyConst[loopi].TaskRef = (length > 0) ? &ReadyLists[offset] : NULL;
+      offset += length;
+   }
+
+#if (RESOURCES_COUNT != 0)
+   for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+   {
+      ResourcesPriority[loopi] = (TaskPriorityType)PostBuildImage.Resources[loopi].Priority;
+   }
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+   for (loopi = 0; loopi < ALARMS_COUNT; loopi++)
+   {
+      AlarmsConst[loopi].AlarmAction = (AlarmActionType)PostBuildImage.Alarms[loopi].Action;
+      AlarmsConst[loopi].AlarmActionInfo.CallbackFunction = NULL;
+      if (ALARMCALLBACK == AlarmsConst[loopi].AlarmAction)
+      {
+         AlarmsConst[loopi].AlarmActionInfo.CallbackFunction = PostBuildSymbol(PostBuildImage.Alarms[loopi].Callback);
+      }
+      AlarmsConst[loopi].AlarmActionInfo.TaskID = (TaskType)PostBuildImage.Alarms[loopi].TaskID;
+      AlarmsConst[loopi].AlarmActionInfo.Event = PostBuildImage.Alarms[loopi].Event;
+      AlarmsConst[loopi].AlarmActionInfo.Counter = (CounterType)PostBuildImage.Alarms[loopi].Counter;
+   }
+
+   /* the image is checked, the counters can be ordered */
+   (void)PostBuildCountersOrder(CountersOrder);
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (COUNTERS_COUNT != 0)
+   for (loopi = 0; loopi < COUNTERS_COUNT; loopi++)
+   {
+      CountersConst[loopi].MaxAllowedValue = PostBuildImage.Counters[loopi].MaxAllowedValue;
+      CountersConst[loopi].MinCycle = PostBuildImage.Counters[loopi].MinCycle;
+      CountersConst[loopi].TicksPerBase = PostBuildImage.Counters[loopi].TicksPerBase;
+   }
+#endif /* #if (COUNTERS_COUNT != 0) */
+
+#if (ALARM_AUTOSTART_COUNT != 0)
+   for (loopi = 0; loopi < ALARM_AUTOSTART_COUNT; loopi++)
+   {
+      AutoStartAlarm[loopi].Mode = (AppModeType)PostBuildImage.AutoStartAlarms[loopi].Mode;
+      AutoStartAlarm[loopi].Alarm = (AlarmType)PostBuildImage.AutoStartAlarms[loopi].Alarm;
+      AutoStartAlarm[loopi].AlarmTime = PostBuildImage.AutoStartAlarms[loopi].AlarmTime;
+      AutoStartAlarm[loopi].AlarmCycleTime = PostBuildImage.AutoStartAlarms[loopi].AlarmCycleTime;
+   }
+#endif /* #if (ALARM_AUTOSTART_COUNT != 0) */
+}
+
+#if (ALARMS_COUNT != 0)
+static boolean PostBuildCountersOrder(CounterType * Order)
+{
+   uint32f incoming[COUNTERS_COUNT];
+   uint32f count = 0;
+   uint32f position;
+   uint32f loopi;
+   CounterType counter;
+
+   for (loopi = 0; loopi < COUNTERS_COUNT; loopi++)
+   {
+      incoming[loopi] = 0;
+   }
+   for (loopi = 0; loopi < ALARMS_COUNT; loopi++)
+   {
+      if (INCREMENT == PostBuildImage.Alarms[loopi].Action)
+      {
+         incoming[PostBuildImage.Alarms[loopi].Counter]++;
+      }
+   }
+
+   /* the counters not incremented by alarms go first, each other counter
+    * follows once all the counters incrementing it are placed */
+   for (loopi = 0; loopi < COUNTERS_COUNT; loopi++)
+   {
+      if (0 == incoming[loopi])
+      {
+         Order[count] = (CounterType)loopi;
+         count++;
+      }
+   }
+   for (position = 0; position < count; position++)
+   {
+      for (loopi = 0; loopi < ALARMS_COUNT; loopi++)
+      {
+         if ( (INCREMENT == PostBuildImage.Alarms[loopi].Action) &&
+              (AlarmsConst[loopi].Counter == Order[position]) )
+         {
+            counter = (CounterType)PostBuildImage.Alarms[loopi].Counter;
+            incoming[counter]--;
+            if (0 == incoming[counter])
+            {
+               Order[count] = counter;
+               count++;
+            }
+         }
+      }
+   }
+
+   return (COUNTERS_COUNT == count) ? TRUE : FALSE;
+}
+#endif /* #if (ALARMS_COUNT != 0) */
+
+/*==================[external functions definition]==========================*/
+void PostBuildLoad_Arch(void)
+{
+   const char * fileName = getenv(POST_BUILD_IMAGE_ENV);
+   FILE * file;
+   size_t size = 0;
+
+   /* without an image the generated configuration is used */
+   if (NULL != fileName)
+   {
+      file = fopen(fileName, "rb");
+      if (NULL != file)
+      {
+         size = fread(&PostBuildImage, 1, sizeof(PostBuildImage), file);
+         /* the image shall not have more data than expected */
+         if (EOF != fgetc(file))
+         {
+            size = 0;
+         }
+         fclose(file);
+      }
+
+      if (sizeof(PostBuildImage) != size)
+      {
+         printf("Post build image %s could not be read or has an invalid size\n", fileName);
+         exit(-1);
+      }
+
+      if (FALSE == PostBuildCheck())
+      {
+         exit(-1);
+      }
+
+      PostBuildApply();
+   }
+}
+
+StatusType PostBuildSave_Arch(const char * FileName)
+{
+   StatusType ret = E_OK;
+   const char * name;
+   FILE * file;
+   uint32f loopi;
+
+   memset(&PostBuildImage, 0, sizeof(PostBuildImage));
+
+   PostBuildImage.Header.Magic = POST_BUILD_MAGIC;
+   PostBuildImage.Header.Version = POST_BUILD_VERSION;
+   PostBuildImage.Header.TasksCount = TASKS_COUNT;
+   PostBuildImage.Header.ResourcesCount = RESOURCES_COUNT;
+   PostBuildImage.Header.AlarmsCount = ALARMS_COUNT;
+   PostBuildImage.Header.CountersCount = COUNTERS_COUNT;
+   PostBuildImage.Header.AutoStartAlarmsCount = ALARM_AUTOSTART_COUNT;
+
+   for (loopi = 0; loopi < TASKS_COUNT; loopi++)
+   {
+      name = PostBuildName(TasksConst[loopi].EntryPoint);
+      if (NULL != name)
+      {
+         strncpy(PostBuildImage.Tasks[loopi].EntryPoint, name, POST_BUILD_NAME_SIZE - 1);
+      }
+      PostBuildImage.Tasks[loopi].Priority = TasksConst[loopi].StaticPriority;
+      PostBuildImage.Tasks[loopi].MaxActivations = TasksConst[loopi].MaxActivations;
+      PostBuildImage.Tasks[loopi].Extended = TasksConst[loopi].ConstFlags.Extended;
+      PostBuildImage.Tasks[loopi].Preemtive = TasksConst[loopi].ConstFlags.Preemtive;
+      PostBuildImage.Tasks[loopi].EventsMask = TasksConst[loopi].EventsMask;
+      PostBuildImage.Tasks[loopi].ResourcesMask = TasksConst[loopi].ResourcesMask;
+   }
+
+#if (RESOURCES_COUNT != 0)
+   for (loopi = 0; loopi < RESOURCES_COUNT; loopi++)
+   {
+      PostBuildImage.Resources[loopi].Priority = ResourcesPriority[loopi];
+   }
+#endif /* #if (RESOURCES_COUNT != 0) */
+
+#if (ALARMS_COUNT != 0)
+   for (loopi = 0; loopi < ALARMS_COUNT; loopi++)
+   {
+      if (ALARMCALLBACK == AlarmsConst[loopi].AlarmAction)
+      {
+         name = PostBuildName(AlarmsConst[loopi].AlarmActionInfo.CallbackFunction);
+         if (NULL != name)
+         {
+            strncpy(PostBuildImage.Alarms[loopi].Callback, name, POST_BUILD_NAME_SIZE - 1);
+         }
+      }
+      PostBuildImage.Alarms[loopi].Action = AlarmsConst[loopi].AlarmAction;
+      PostBuildImage.Alarms[loopi].TaskID = AlarmsConst[loopi].AlarmActionInfo.TaskID;
+      PostBuildImage.Alarms[loopi].Event = AlarmsConst[loopi].AlarmActionInfo.Event;
+      PostBuildImage.Alarms[loopi].Counter = AlarmsConst[loopi].AlarmActionInfo.Counter;
+   }
+#endif /* #if (ALARMS_COUNT != 0) */
+
+#if (COUNTERS_COUNT != 0)
+   for (loopi = 0; loopi < COUNTERS_COUNT; loopi++)
+   {
+      PostBuildImage.Counters[loopi].MaxAllowedValue = CountersConst[loopi].MaxAllowedValue;
+      PostBuildImage.Counters[loopi].MinCycle = CountersConst[loopi].MinCycle;
+      PostBuildImage.Counters[loopi].TicksPerBase = CountersConst[loopi].TicksPerBase;
+   }
+#endif /* #if (COUNTERS_COUNT != 0) */
+
+#if (ALARM_AUTOSTART_COUNT != 0)
+   for (loopi = 0; loopi < ALARM_AUTOSTART_COUNT; loopi++)
+   {
+      PostBuildImage.AutoStartAlarms[loopi].Mode = AutoStartAlarm[loopi].Mode;
+      PostBuildImage.AutoStartAlarms[loopi].Alarm = AutoStartAlarm[loopi].Alarm;
+      PostBuildImage.AutoStartAlarms[loopi].AlarmTime = AutoStartAlarm[loopi].AlarmTime;
+      PostBuildImage.AutoStartAlarms[loopi].AlarmCycleTime = AutoStartAlarm[loopi].AlarmCycleTime;
+   }
+#endif /* #if (ALARM_AUTOSTART_COUNT != 0) */
+
+   file = fopen(FileName, "wb");
+   if (NULL == file)
+   {
+      ret = E_OS_ACCESS;
+   }
+   else
+   {
+      if (1 != fwrite(&PostBuildImage, sizeof(PostBuildImage), 1, file))
+      {
+         ret = E_OS_ACCESS;
+      }
+      if (0 != fclose(file))
+      {
+         ret = E_OS_ACCESS;
+      }
+   }
+
+   return ret;
+}
+#endif /* #if (OSEK_POST_BUILD == OSEK_ENABLE) */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -84,6 +84,13 @@ pthread_t Os_Thread_Timer;
 void StartOs_Arch(void)
 {
    uint8f loopi;
+   sigset_t signals;
+
+#if (OSEK_POST_BUILD == OSEK_ENABLE)
+   /* load the post build image, is done at every start to allow another
+    * image to be used after RestartOS */
+   PostBuildLoad_Arch();
+#endif /* #if (OSEK_POST_BUILD == OSEK_ENABLE) */
 
    /* init every task */
    for( loopi = 0; loopi < TASKS_COUNT; loopi++)
@@ -94,25 +101,45 @@ void StartOs_Arch(void)
         SetEntryPoint(loopi);
    }
 
-   /* initialize singals handler */
-   signal(SIGALRM,OsInterruptHandler);
-   signal(SIGUSR1,OsInterruptHandler);
-   signal(SIGTERM,OsInterruptHandler);
-
-   /* shared memory for interrupts */
-   OSEK_InterruptFlags = mmap(NULL,
-         sizeof(8),
-         PROT_READ | PROT_WRITE,
-         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
-
-   /* init Thread Terminate flag */
-   Os_Terminate_Flag = false;
+   /* save the Os stack */
+   SaveOsStack();
 
-    if(0 != pthread_create(&Os_Thread_Timer, NULL, HWTimerThread, (void*)0))
+   /* the signal handlers, the shared memory and the timer thread are kept
+    * when the os is restarted with RestartOS */
+   if (0 == OsRestartStack)
    {
-      printf("Error creating OS Thread timer!\n");
-      exit(-1);
+      OsRestartStack = OsStack;
+
+      /* initialize singals handler */
+      signal(SIGALRM,OsInterruptHandler);
+      signal(SIGUSR1,OsInterruptHandler);
+      signal(SIGTERM,OsInterruptHandler);
+
+      /* shared memory for interrupts */
+      OSEK_InterruptFlags = mmap(NULL,
+            sizeof(8),
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+      /* init Thread Terminate flag */
+      Os_Terminate_Flag = false;
+
+      if(0 != pthread_create(&Os_Thread_Timer, NULL, HWTimerThread, (void*)0))
+      {
+         printf("Error creating OS Thread timer!\n");
+         exit(-1);
+      }
    }
+   else
+   {
+      /* the os may be restarted from a task dispatched in a signal handler,
+       * unblock the interrupt signals again */
+      sigemptyset(&signals);
+      sigaddset(&signals, SIGALRM);
+      sigaddset(&signals, SIGUSR1);
+      sigprocmask(SIG_UNBLOCK, &signals, NULL);
+   }
+
 #if 0
    printf("Process ID: %d\n", getpid());
 #endif
@@ -130,8 +157,6 @@ void StartOs_Arch(void)
    InterruptMask &= ~(1 << 5);
 #endif
 #endif
-
-   SaveOsStack();
 }
 
 /** @} doxygen end group definition */
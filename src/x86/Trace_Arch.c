@@ -0,0 +1,127 @@
+/* Copyright 2008, 2009, 2014 Mariano Cerdeiro
+ * Copyright 2014, Juan Cecconi
+ * Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Trace Architecture Dependece Implementation File
+ **
+ ** This file implements the time source of the trace and the saving of the
+ ** trace to a file of the host.
+ **
+ ** \file x86/Trace_Arch.c
+ ** \arch x86
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_Internal
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Os_Internal.h"
+
+#if ( (OSEK_TRACE == OSEK_ENABLE) || \
+      (OSEK_ISR_MONITOR == OSEK_ENABLE) || \
+      (OSEK_LOG == OSEK_ENABLE) || \
+      (PIPELINES_COUNT != 0) )
+#include <stdio.h>
+#include <time.h>
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+#if (OSEK_TRACE == OSEK_ENABLE)
+/** \brief Copy of the trace written by TraceSave_Arch */
+static TraceType TraceImage;
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+uint32 TraceTime_Arch(void)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+
+   /* the time overflows after 71 minutes, only the difference between two
+    * records is stored */
+   return (uint32)now.tv_sec * 1000000U + (uint32)(now.tv_nsec / 1000);
+}
+
+#if (OSEK_TRACE == OSEK_ENABLE)
+StatusType TraceSave_Arch(const char * FileName)
+{
+   StatusType ret = E_OK;
+   FILE * file;
+
+   /* take a consistent copy, the simulated interrupts may add records */
+   IntSecure_Start();
+   TraceImage = Osek_Trace;
+   IntSecure_End();
+
+   file = fopen(FileName, "wb");
+   if (NULL == file)
+   {
+      ret = E_OS_ACCESS;
+   }
+   else
+   {
+      if (1 != fwrite(&TraceImage, sizeof(TraceImage), 1, file))
+      {
+         ret = E_OS_ACCESS;
+      }
+      if (0 != fclose(file))
+      {
+         ret = E_OS_ACCESS;
+      }
+   }
+
+   return ret;
+}
+#endif /* #if (OSEK_TRACE == OSEK_ENABLE) */
+#endif /* #if ( (OSEK_TRACE == OSEK_ENABLE) || ... */
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,172 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Event Loop Benchmark
+ **
+ ** Measures the throughput of the canonical extended task loop. The task
+ ** Producer sets the event EvData to the higher priority task Consumer,
+ ** each SetEvent switches to Consumer which takes the event and waits
+ ** again. The consumer loop is measured implemented with WaitEvent, GetEvent
+ ** and ClearEvent and with WaitGetClearEvent.
+ **
+ ** \file FreeOSEK/Os/tst/bench/evloop/src/evloop.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_EVLOOP Event loop
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "evloop.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Measure one consumer loop implementation
+ **
+ ** \param[in] mode EVLOOP_MODE_CLASSIC or EVLOOP_MODE_COMBINED
+ ** \param[in] name name used to report the result
+ **/
+static void Evloop_Measure(uint8 mode, const char * name);
+
+/*==================[internal data definition]===============================*/
+/** \brief loop implementation used by the consumer */
+static volatile uint8 Evloop_Mode = EVLOOP_MODE_CLASSIC;
+
+/** \brief count of events taken by the consumer */
+static volatile uint32 Evloop_Count;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void Evloop_Measure(uint8 mode, const char * name)
+{
+   uint32 loopi;
+   BenchTimeType start;
+   BenchTimeType end;
+
+   Evloop_Mode = mode;
+
+   /* the consumer is waiting with the last mode, this event lets it wait
+    * again with the new one */
+   (void)SetEvent(Consumer, EvData);
+
+   Evloop_Count = 0;
+   start = Bench_GetTime();
+
+   for (loopi = 0; loopi < EVLOOP_ITERATIONS; loopi++)
+   {
+      /* the consumer has a higher priority, it is executed before SetEvent
+       * returns */
+      (void)SetEvent(Consumer, EvData);
+   }
+
+   end = Bench_GetTime();
+
+   if (Evloop_Count == EVLOOP_ITERATIONS)
+   {
+      Bench_Report(name, EVLOOP_ITERATIONS, end - start);
+   }
+   else
+   {
+      /* report the failure with 0 iterations */
+      Bench_Report(name, 0, end - start);
+   }
+}
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Producer)
+{
+   uint8 loopi;
+
+   (void)ActivateTask(Consumer);
+
+   for (loopi = 0; loopi < BENCH_REPEAT; loopi++)
+   {
+      Evloop_Measure(EVLOOP_MODE_CLASSIC, "evloop_classic");
+      Evloop_Measure(EVLOOP_MODE_COMBINED, "evloop_combined");
+   }
+
+   Bench_Finish();
+}
+
+TASK(Consumer)
+{
+   EventMaskType Events;
+
+   while(1)
+   {
+      if (EVLOOP_MODE_CLASSIC == Evloop_Mode)
+      {
+         (void)WaitEvent(EvData);
+         (void)GetEvent(Consumer, &Events);
+         (void)ClearEvent(Events);
+      }
+      else
+      {
+         (void)WaitGetClearEvent(EvData, &Events);
+      }
+
+      Evloop_Count++;
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,151 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Hot Sections Benchmark
+ **
+ ** Measures on cortexM4 the cycles of the kernel paths placed in RAM with
+ ** HOTSECTIONS: the activation of the higher priority task Worker switches
+ ** to it over Schedule, AddReady, GetNextTask and PendSV_Handler, the alarm
+ ** services use the counter and alarm tables. The benchmark is built once
+ ** with HOTSECTIONS = TRUE and once with FALSE in etc/hot.oil, on a MCU
+ ** with flash wait states the difference is the cost of executing the
+ ** kernel from flash. The cycles are taken from the DWT cycle counter.
+ **
+ ** \file FreeOSEK/Os/tst/bench/hot/src/hot.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_HOT Hot sections
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "hot.h"
+
+/*==================[macros and definitions]=================================*/
+/** \brief DEMCR register, TRCENA enables the DWT */
+#define HOT_DEMCR          (*(volatile uint32 *)0xE000EDFCU)
+
+/** \brief DWT control register, CYCCNTENA enables the cycle counter */
+#define HOT_DWT_CTRL       (*(volatile uint32 *)0xE0001000U)
+
+/** \brief DWT cycle counter */
+#define HOT_DWT_CYCCNT     (*(volatile uint32 *)0xE0001004U)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Worker */
+static volatile uint32 Hot_WorkerCount;
+
+/*==================[external data definition]===============================*/
+HotResultsType Hot_Results;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Measure)
+{
+   uint32 loopi;
+   uint32 loopj;
+   uint32 start;
+
+   HOT_DEMCR |= 0x01000000U;
+   HOT_DWT_CTRL |= 0x00000001U;
+
+   for (loopi = 0; loopi < HOT_REPEAT; loopi++)
+   {
+      Hot_WorkerCount = 0;
+      start = HOT_DWT_CYCCNT;
+      for (loopj = 0; loopj < HOT_ITERATIONS; loopj++)
+      {
+         /* Worker has a higher priority, it is executed before ActivateTask
+          * returns */
+         (void)ActivateTask(Worker);
+      }
+      Hot_Results.Switch[loopi] = (HOT_DWT_CYCCNT - start) / HOT_ITERATIONS;
+
+      start = HOT_DWT_CYCCNT;
+      for (loopj = 0; loopj < HOT_ITERATIONS; loopj++)
+      {
+         (void)SetRelAlarm(WakeWorker, 500, 0);
+         (void)CancelAlarm(WakeWorker);
+      }
+      Hot_Results.Alarm[loopi] = (HOT_DWT_CYCCNT - start) / HOT_ITERATIONS;
+
+      if (Hot_WorkerCount != HOT_ITERATIONS)
+      {
+         /* report the failure with 0 cycles */
+         Hot_Results.Switch[loopi] = 0;
+      }
+      Hot_Results.Done++;
+   }
+
+   TerminateTask();
+}
+
+TASK(Worker)
+{
+   Hot_WorkerCount++;
+
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,165 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+/** \brief FreeOSEK Os Benchmark Header File
+ **
+ ** Common time measurement and report interface of the benchmarks in
+ ** FreeOSEK/Os/tst/bench. The benchmarks run on the x86 port only.
+ **
+ ** \file FreeOSEK/Os/tst/bench/inc/bench.h
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Types.h"
+
+/*==================[macros]=================================================*/
+/** \brief Count of times each benchmark is repeated
+ **
+ ** Each repetition is reported in its own line, this allows the evaluation
+ ** of the dispersion of the results.
+ **/
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT 5
+#endif
+
+/** \brief Count of samples of each counted measurement
+ **
+ ** A counted measurement reports the sample with the lowest count of
+ ** instructions, the samples interrupted by the timer of the port are
+ ** discarded this way.
+ **/
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES 20
+#endif
+
+/** \brief Counters read from the performance monitoring of the host */
+#define BENCH_SOURCE_PERF     1
+
+/** \brief Only the time stamp counter, no instructions are counted */
+#define BENCH_SOURCE_RDTSC    2
+
+/*==================[typedef]================================================*/
+/** \brief Benchmark time type in nanoseconds */
+typedef unsigned long long BenchTimeType;
+
+/** \brief Counters of a measured region */
+typedef struct {
+   BenchTimeType Time;                 /**< time in nanoseconds */
+   unsigned long long Instructions;    /**< retired user instructions, 0 if
+                                            they can not be counted */
+   unsigned long long Cycles;          /**< user cycles, or time stamp
+                                            counter ticks with rdtsc */
+} BenchCountersType;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/** \brief Get the actual time
+ **
+ ** \return monotonic time in nanoseconds
+ **/
+extern BenchTimeType Bench_GetTime(void);
+
+/** \brief Report a benchmark result
+ **
+ ** Prints one line with the format:
+ **    BENCH:<name>:<iterations>:<total ns>:<ns per iteration>
+ ** this format is used by the tools evaluating the benchmarks.
+ **
+ ** \param[in] name name of the measured item
+ ** \param[in] iterations count of measured iterations
+ ** \param[in] time total time used for all iterations in nanoseconds
+ **/
+extern void Bench_Report(const char * name, uint32 iterations, BenchTimeType time);
+
+/** \brief Start a counted region
+ **
+ ** The instructions and cycles are read with perf_event_open, if the host
+ ** does not allow it the cycles are taken from rdtsc. The first call
+ ** reports the source of the counters with the line:
+ **    BENCH_SOURCE:<perf|rdtsc>
+ **
+ ** \param[out] counters counters at the start of the region
+ **/
+extern void Bench_Start(BenchCountersType * counters);
+
+/** \brief Stop a counted region
+ **
+ ** \param[inout] counters counters at the start of the region, returns the
+ **                        counters used by the region
+ **/
+extern void Bench_Stop(BenchCountersType * counters);
+
+/** \brief Keep the sample with the lowest count
+ **
+ ** \param[inout] min lowest sample, Instructions set to ~0 before the first
+ ** \param[in] sample new sample
+ **/
+extern void Bench_Min(BenchCountersType * min, const BenchCountersType * sample);
+
+/** \brief Report a counted benchmark result
+ **
+ ** Prints one line with the format:
+ **    BENCH:<name>:<iterations>:<total ns>:<ns per iteration>:<instructions
+ **       per iteration>:<cycles per iteration>
+ ** the first fields are the ones of Bench_Report.
+ **
+ ** \param[in] name name of the measured item
+ ** \param[in] iterations count of measured iterations
+ ** \param[in] counters counters used by all iterations
+ **/
+extern void Bench_ReportCounters(const char * name, uint32 iterations,
+      const BenchCountersType * counters);
+
+/** \brief Finish the benchmark
+ **
+ ** Flushes the output and terminates the process.
+ **/
+extern void Bench_Finish(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+#endif /* #ifndef _BENCH_H_ */
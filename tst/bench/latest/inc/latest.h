@@ -0,0 +1,89 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef _LATEST_H_
+#define _LATEST_H_
+/** \brief FreeOSEK Os Latest Value Channel Benchmark Header File
+ **
+ ** \file FreeOSEK/Os/tst/bench/latest/inc/latest.h
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_LATEST Latest value channels
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "bench.h"
+
+/*==================[macros]=================================================*/
+/** \brief Count of writes or reads in each measurement */
+#ifndef LATEST_ITERATIONS
+#define LATEST_ITERATIONS 1000000
+#endif
+
+/** \brief Size of the sample in 32 bit words, SIZE of the DATA in the OIL
+ **        file is 4 times this value */
+#define LATEST_WORDS 8
+
+/** \brief Sample protected with the resource SampleRes */
+#define LATEST_MODE_RESOURCE  0
+
+/** \brief Sample stored in the SEQLOCK data SampleSeq */
+#define LATEST_MODE_SEQLOCK   1
+
+/** \brief Sample stored in the TRIPLEBUFFER data SampleTriple */
+#define LATEST_MODE_TRIPLE    2
+
+/*==================[typedef]================================================*/
+/** \brief Sample exchanged between writer and reader */
+typedef struct {
+   uint32 Value[LATEST_WORDS];
+} LatestSampleType;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+#endif /* #ifndef _LATEST_H_ */
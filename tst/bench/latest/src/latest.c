@@ -0,0 +1,211 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Latest Value Channel Benchmark
+ **
+ ** Compares the cost of publishing and reading the latest value of a sample
+ ** with the DATA channels against a copy protected with a resource. The
+ ** writes and reads are measured without contention in the task Bench, the
+ ** resource SampleRes is also used by the task Reader to give it a real
+ ** ceiling.
+ **
+ ** \file FreeOSEK/Os/tst/bench/latest/src/latest.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_LATEST Latest value channels
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "latest.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Measure the writes of one implementation
+ **
+ ** \param[in] mode LATEST_MODE_RESOURCE, LATEST_MODE_SEQLOCK or
+ **                 LATEST_MODE_TRIPLE
+ ** \param[in] name name used to report the result
+ **/
+static void Latest_MeasureWrite(uint8 mode, const char * name);
+
+/** \brief Measure the reads of one implementation
+ **
+ ** \param[in] mode LATEST_MODE_RESOURCE, LATEST_MODE_SEQLOCK or
+ **                 LATEST_MODE_TRIPLE
+ ** \param[in] name name used to report the result
+ **/
+static void Latest_MeasureRead(uint8 mode, const char * name);
+
+/*==================[internal data definition]===============================*/
+/** \brief sample protected with the resource SampleRes */
+static LatestSampleType Latest_Shared;
+
+/** \brief sample of the writer */
+static LatestSampleType Latest_Write;
+
+/** \brief sample of the reader */
+static volatile LatestSampleType Latest_Read;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void Latest_MeasureWrite(uint8 mode, const char * name)
+{
+   uint32 loopi;
+   BenchTimeType start;
+   BenchTimeType end;
+
+   start = Bench_GetTime();
+
+   for (loopi = 0; loopi < LATEST_ITERATIONS; loopi++)
+   {
+      Latest_Write.Value[0] = loopi;
+
+      if (LATEST_MODE_RESOURCE == mode)
+      {
+         (void)GetResource(SampleRes);
+         Latest_Shared = Latest_Write;
+         (void)ReleaseResource(SampleRes);
+      }
+      else if (LATEST_MODE_SEQLOCK == mode)
+      {
+         (void)WriteData(SampleSeq, &Latest_Write);
+      }
+      else
+      {
+         (void)WriteData(SampleTriple, &Latest_Write);
+      }
+   }
+
+   end = Bench_GetTime();
+
+   Bench_Report(name, LATEST_ITERATIONS, end - start);
+}
+
+static void Latest_MeasureRead(uint8 mode, const char * name)
+{
+   uint32 loopi;
+   LatestSampleType sample;
+   BenchTimeType start;
+   BenchTimeType end;
+
+   start = Bench_GetTime();
+
+   for (loopi = 0; loopi < LATEST_ITERATIONS; loopi++)
+   {
+      if (LATEST_MODE_RESOURCE == mode)
+      {
+         (void)GetResource(SampleRes);
+         sample = Latest_Shared;
+         (void)ReleaseResource(SampleRes);
+      }
+      else if (LATEST_MODE_SEQLOCK == mode)
+      {
+         (void)ReadData(SampleSeq, &sample);
+      }
+      else
+      {
+         (void)ReadData(SampleTriple, &sample);
+      }
+
+      Latest_Read.Value[0] = sample.Value[0];
+   }
+
+   end = Bench_GetTime();
+
+   Bench_Report(name, LATEST_ITERATIONS, end - start);
+}
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Bench)
+{
+   uint8 loopi;
+
+   for (loopi = 0; loopi < BENCH_REPEAT; loopi++)
+   {
+      Latest_MeasureWrite(LATEST_MODE_RESOURCE, "latest_resource_write");
+      Latest_MeasureWrite(LATEST_MODE_SEQLOCK, "latest_seqlock_write");
+      Latest_MeasureWrite(LATEST_MODE_TRIPLE, "latest_triple_write");
+      Latest_MeasureRead(LATEST_MODE_RESOURCE, "latest_resource_read");
+      Latest_MeasureRead(LATEST_MODE_SEQLOCK, "latest_seqlock_read");
+      Latest_MeasureRead(LATEST_MODE_TRIPLE, "latest_triple_read");
+   }
+
+   Bench_Finish();
+}
+
+TASK(Reader)
+{
+   LatestSampleType sample;
+
+   /* never activated, uses the resource to raise its ceiling */
+   (void)GetResource(SampleRes);
+   sample = Latest_Shared;
+   (void)ReleaseResource(SampleRes);
+
+   Latest_Read.Value[0] = sample.Value[0];
+
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
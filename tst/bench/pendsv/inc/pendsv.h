@@ -0,0 +1,100 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef _PENDSV_H_
+#define _PENDSV_H_
+/** \brief FreeOSEK Os PendSV Benchmark Header File
+ **
+ ** \file FreeOSEK/Os/tst/bench/pendsv/inc/pendsv.h
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_PENDSV PendSV
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Types.h"
+
+/*==================[macros]=================================================*/
+/** \brief Count of task switches in each measurement */
+#ifndef PENDSV_ITERATIONS
+#define PENDSV_ITERATIONS 10000
+#endif
+
+/** \brief Count of times each measurement is repeated */
+#ifndef PENDSV_REPEAT
+#define PENDSV_REPEAT 5
+#endif
+
+/*==================[typedef]================================================*/
+/** \brief Results of the benchmark
+ **
+ ** The target has no output, the results are read with the debugger, for
+ ** example with gdb:
+ **    print PendSV_Results
+ **
+ ** The switch in and switch out values are the lowest of each measurement,
+ ** the other values are the average of all iterations.
+ **/
+typedef struct {
+   uint32 Done;                     /**< count of finished measurements */
+   uint32 SwitchIn[PENDSV_REPEAT];  /**< cycles from the call of ActivateTask
+                                         to the first instruction of Worker */
+   uint32 SwitchOut[PENDSV_REPEAT]; /**< cycles from the call of
+                                         TerminateTask in Worker to the
+                                         return of ActivateTask */
+   uint32 Activate[PENDSV_REPEAT];  /**< cycles of an ActivateTask with
+                                         switch to Worker and back */
+   uint32 Event[PENDSV_REPEAT];     /**< cycles of a SetEvent with switch to
+                                         Pong and back over WaitEvent */
+} PendSVResultsType;
+
+/*==================[external data declaration]==============================*/
+/** \brief Results of the benchmark */
+extern PendSVResultsType PendSV_Results;
+
+/*==================[external functions declaration]=========================*/
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+#endif /* #ifndef _PENDSV_H_ */
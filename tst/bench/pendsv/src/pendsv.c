@@ -0,0 +1,194 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os PendSV Benchmark
+ **
+ ** Measures on cortexM4 the cycles of a task switch over the PendSV handler.
+ ** The switch in is measured from the call of ActivateTask of the higher
+ ** priority task Worker to its first instruction, the switch out from the
+ ** call of TerminateTask in Worker to the return of ActivateTask. The
+ ** switches between the extended tasks Measure and Pong over SetEvent and
+ ** WaitEvent do not terminate a task. The cycles are taken from the DWT
+ ** cycle counter.
+ **
+ ** \file FreeOSEK/Os/tst/bench/pendsv/src/pendsv.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_PENDSV PendSV
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "pendsv.h"
+
+/*==================[macros and definitions]=================================*/
+/** \brief DEMCR register, TRCENA enables the DWT */
+#define PENDSV_DEMCR       (*(volatile uint32 *)0xE000EDFCU)
+
+/** \brief DWT control register, CYCCNTENA enables the cycle counter */
+#define PENDSV_DWT_CTRL    (*(volatile uint32 *)0xE0001000U)
+
+/** \brief DWT cycle counter */
+#define PENDSV_DWT_CYCCNT  (*(volatile uint32 *)0xE0001004U)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief cycle counter read by Worker at its start */
+static volatile uint32 PendSV_WorkerStart;
+
+/** \brief cycle counter read by Worker before TerminateTask */
+static volatile uint32 PendSV_WorkerEnd;
+
+/** \brief count of executions of Pong */
+static volatile uint32 PendSV_PongCount;
+
+/*==================[external data definition]===============================*/
+PendSVResultsType PendSV_Results;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Measure)
+{
+   uint32 loopi;
+   uint32 loopj;
+   uint32 start;
+   uint32 end;
+   uint32 in;
+   uint32 out;
+
+   PENDSV_DEMCR |= 0x01000000U;
+   PENDSV_DWT_CTRL |= 0x00000001U;
+
+   /* Pong has the highest priority, it runs until it waits for Ping */
+   (void)ActivateTask(Pong);
+
+   for (loopi = 0; loopi < PENDSV_REPEAT; loopi++)
+   {
+      PendSV_Results.SwitchIn[loopi] = 0xFFFFFFFFU;
+      PendSV_Results.SwitchOut[loopi] = 0xFFFFFFFFU;
+      for (loopj = 0; loopj < PENDSV_ITERATIONS; loopj++)
+      {
+         start = PENDSV_DWT_CYCCNT;
+         /* Worker has a higher priority, it is executed before ActivateTask
+          * returns */
+         (void)ActivateTask(Worker);
+         end = PENDSV_DWT_CYCCNT;
+
+         in = PendSV_WorkerStart - start;
+         out = end - PendSV_WorkerEnd;
+         if (in < PendSV_Results.SwitchIn[loopi])
+         {
+            PendSV_Results.SwitchIn[loopi] = in;
+         }
+         if (out < PendSV_Results.SwitchOut[loopi])
+         {
+            PendSV_Results.SwitchOut[loopi] = out;
+         }
+      }
+
+      start = PENDSV_DWT_CYCCNT;
+      for (loopj = 0; loopj < PENDSV_ITERATIONS; loopj++)
+      {
+         (void)ActivateTask(Worker);
+      }
+      PendSV_Results.Activate[loopi] = (PENDSV_DWT_CYCCNT - start) / PENDSV_ITERATIONS;
+
+      PendSV_PongCount = 0;
+      start = PENDSV_DWT_CYCCNT;
+      for (loopj = 0; loopj < PENDSV_ITERATIONS; loopj++)
+      {
+         /* Pong waits again before SetEvent returns */
+         (void)SetEvent(Pong, Ping);
+      }
+      PendSV_Results.Event[loopi] = (PENDSV_DWT_CYCCNT - start) / PENDSV_ITERATIONS;
+
+      if (PendSV_PongCount != PENDSV_ITERATIONS)
+      {
+         /* report the failure with 0 cycles */
+         PendSV_Results.Event[loopi] = 0;
+      }
+      PendSV_Results.Done++;
+   }
+
+   TerminateTask();
+}
+
+TASK(Worker)
+{
+   PendSV_WorkerStart = PENDSV_DWT_CYCCNT;
+
+   PendSV_WorkerEnd = PENDSV_DWT_CYCCNT;
+   TerminateTask();
+}
+
+TASK(Pong)
+{
+   while(1)
+   {
+      (void)WaitEvent(Ping);
+      (void)ClearEvent(Ping);
+      PendSV_PongCount++;
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
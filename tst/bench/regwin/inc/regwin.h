@@ -0,0 +1,103 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef _REGWIN_H_
+#define _REGWIN_H_
+/** \brief FreeOSEK Os Register Window Benchmark Header File
+ **
+ ** \file FreeOSEK/Os/tst/bench/regwin/inc/regwin.h
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_REGWIN Register windows
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Types.h"
+
+/*==================[macros]=================================================*/
+/** \brief Ticks of HardwareCounter of each measurement
+ **
+ ** HWCOUNTER0 ticks every 10 ms.
+ **/
+#ifndef REGWIN_TICKS
+#define REGWIN_TICKS 100
+#endif
+
+/** \brief Count of call depths measured */
+#define REGWIN_DEPTHS 4
+
+/** \brief Count of times each measurement is repeated */
+#ifndef REGWIN_REPEAT
+#define REGWIN_REPEAT 5
+#endif
+
+/*==================[typedef]================================================*/
+/** \brief Results of the benchmark
+ **
+ ** The target has no output, the results are read with the debugger, for
+ ** example with gdb:
+ **    print RegWin_Results
+ **/
+typedef struct {
+   uint32 Done;                     /**< count of finished measurements */
+   uint32 Depth[REGWIN_DEPTHS];    /**< count of nested calls of Measure
+                                         before each switch */
+   uint32 Switches[REGWIN_REPEAT][REGWIN_DEPTHS];
+                                    /**< count of ActivateTask with switch
+                                         to Worker and back in
+                                         REGWIN_TICKS ticks */
+   uint32 Idle[REGWIN_REPEAT];     /**< count of loops without any service
+                                         call in REGWIN_TICKS ticks, the
+                                         tick interrupt does not switch */
+} RegWinResultsType;
+
+/*==================[external data declaration]==============================*/
+/** \brief Results of the benchmark */
+extern RegWinResultsType RegWin_Results;
+
+/*==================[external functions declaration]=========================*/
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+#endif /* #ifndef _REGWIN_H_ */
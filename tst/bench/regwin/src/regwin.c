@@ -0,0 +1,166 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Register Window Benchmark
+ **
+ ** Measures on sparcV8 the cost of the register windows in the trap
+ ** handler. Measure calls itself Depth times before each activation of the
+ ** higher priority task Worker, the windows of the calls are in use when the
+ ** switch to Worker flushes them. The count of switches done in a fixed
+ ** count of ticks of HardwareCounter is reported for each depth, more
+ ** switches mean a cheaper switch. The count of loops without service calls
+ ** shows the cost of the tick interrupt, which returns to the interrupted
+ ** task without flushing its windows.
+ **
+ ** \file FreeOSEK/Os/tst/bench/regwin/src/regwin.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_REGWIN Register windows
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "regwin.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Activate Worker after Depth nested calls
+ **
+ ** \param[in] Depth count of nested calls
+ **/
+static void RegWin_Call(uint32 Depth);
+
+/*==================[internal data definition]===============================*/
+/** \brief Count of nested calls of each measurement, the leon3 has 8
+ **        windows */
+static const uint32 RegWin_Depths[REGWIN_DEPTHS] = { 0, 2, 4, 6 };
+
+/** \brief Set by the alarm at the end of a measurement */
+static volatile uint32 RegWin_Stop;
+
+/*==================[external data definition]===============================*/
+RegWinResultsType RegWin_Results;
+
+/*==================[internal functions definition]==========================*/
+static void RegWin_Call(uint32 Depth)
+{
+   if (Depth > 0)
+   {
+      RegWin_Call(Depth - 1);
+   }
+   else
+   {
+      /* Worker has a higher priority, it is executed before ActivateTask
+       * returns */
+      (void)ActivateTask(Worker);
+   }
+}
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Measure)
+{
+   uint32 loopi;
+   uint32 loopj;
+   uint32 count;
+
+   for (loopi = 0; loopi < REGWIN_REPEAT; loopi++)
+   {
+      for (loopj = 0; loopj < REGWIN_DEPTHS; loopj++)
+      {
+         RegWin_Results.Depth[loopj] = RegWin_Depths[loopj];
+         count = 0;
+         RegWin_Stop = 0;
+         (void)SetRelAlarm(StopMeasure, REGWIN_TICKS, 0);
+         while (0 == RegWin_Stop)
+         {
+            RegWin_Call(RegWin_Depths[loopj]);
+            count++;
+         }
+         RegWin_Results.Switches[loopi][loopj] = count;
+      }
+
+      count = 0;
+      RegWin_Stop = 0;
+      (void)SetRelAlarm(StopMeasure, REGWIN_TICKS, 0);
+      while (0 == RegWin_Stop)
+      {
+         count++;
+      }
+      RegWin_Results.Idle[loopi] = count;
+
+      RegWin_Results.Done++;
+   }
+
+   TerminateTask();
+}
+
+TASK(Worker)
+{
+   TerminateTask();
+}
+
+ALARMCALLBACK(StopMeasure)
+{
+   RegWin_Stop = 1;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,226 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Services Benchmark
+ **
+ ** Counts the instructions and cycles used by the kernel services on the
+ ** x86 port. The count of instructions does not depend on the load of the
+ ** host, it can be compared between two builds to gate a change of the
+ ** kernel. Each service is measured in BENCH_SAMPLES samples of
+ ** SERVICES_ITERATIONS calls and the sample with the lowest count is
+ ** reported, the samples interrupted by the timer of the port have more
+ ** instructions.
+ **
+ ** The measured items are:
+ **    activatetask_switch: ActivateTask of the higher priority task Worker,
+ **                  includes the switch to Worker, its TerminateTask and
+ **                  the switch back
+ **    schedule: Schedule without a higher priority task ready
+ **    setevent: SetEvent and ClearEvent of an own event
+ **    setevent_switch: SetEvent to the higher priority task Waiter waiting
+ **                  for it, includes the switch, its ClearEvent and its
+ **                  WaitEvent with the switch back
+ **    waitevent: WaitEvent of an own event which is already set, with the
+ **                  SetEvent and ClearEvent of the event
+ **    waitevent_block: WaitEvent of an own event which is not set, includes
+ **                  the switch to the lower priority task Setter, its
+ **                  SetEvent with the switch back and the ClearEvent
+ **    resource: GetResource and ReleaseResource
+ **    incrementcounter: IncrementCounter of a counter with the alarm
+ **                  AlarmBench running but not expiring
+ **    incrementcounter_expire: IncrementCounter of the same counter which
+ **                  also expires the cyclic alarm AlarmExpire, its action
+ **                  sets EvSelf of the running task, with the ClearEvent
+ **
+ ** \file FreeOSEK/Os/tst/bench/services/src/services.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH_SERVICES Services
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "Os_Internal.h"
+#include "services.h"
+
+/*==================[macros and definitions]=================================*/
+/** \brief Measure a region
+ **
+ ** Executes the region SERVICES_ITERATIONS times in each sample and reports
+ ** the sample with the lowest count.
+ **
+ ** \param[in] name name used to report the result
+ ** \param[in] region statement to be measured
+ **/
+#define Services_Measure(name, region)                                        \
+{                                                                             \
+   BenchCountersType counters;                                                \
+   BenchCountersType min;                                                     \
+   uint32 sample;                                                             \
+   uint32 loopi;                                                              \
+                                                                              \
+   min.Instructions = ~0ULL;                                                  \
+   min.Cycles = ~0ULL;                                                        \
+   for (sample = 0; sample < BENCH_SAMPLES; sample++)                         \
+   {                                                                          \
+      Bench_Start(&counters);                                                 \
+      for (loopi = 0; loopi < SERVICES_ITERATIONS; loopi++)                   \
+      {                                                                       \
+         region;                                                              \
+      }                                                                       \
+      Bench_Stop(&counters);                                                  \
+      Bench_Min(&min, &counters);                                             \
+   }                                                                          \
+   Bench_ReportCounters((name), SERVICES_ITERATIONS, &min);                   \
+}
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Worker */
+static volatile uint32 Services_WorkerCount;
+
+/** \brief count of wake ups of Waiter */
+static volatile uint32 Services_WaiterCount;
+
+/** \brief count of events set by Setter */
+static volatile uint32 Services_SetterCount;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Bench)
+{
+   uint8 loopi;
+
+   /* Waiter waits for its event, Setter runs only while Bench waits */
+   (void)ActivateTask(Waiter);
+   (void)ActivateTask(Setter);
+
+   for (loopi = 0; loopi < BENCH_REPEAT; loopi++)
+   {
+      Services_Measure("activatetask_switch", (void)ActivateTask(Worker));
+      Services_Measure("schedule", (void)Schedule());
+      Services_Measure("setevent",
+            (void)SetEvent(Bench, EvSelf); (void)ClearEvent(EvSelf));
+      Services_Measure("setevent_switch", (void)SetEvent(Waiter, EvWake));
+      Services_Measure("waitevent",
+            (void)SetEvent(Bench, EvSelf); (void)WaitEvent(EvSelf);
+            (void)ClearEvent(EvSelf));
+      Services_Measure("waitevent_block",
+            (void)WaitEvent(EvSelf); (void)ClearEvent(EvSelf));
+      Services_Measure("resource",
+            (void)GetResource(ResBench); (void)ReleaseResource(ResBench));
+
+      /* AlarmBench does not expire within the samples, the counter has an
+       * alarm to be checked on each increment */
+      (void)SetRelAlarm(AlarmBench, SERVICES_ALARM_OFFSET, 0);
+      Services_Measure("incrementcounter",
+            (void)IncrementCounter(BenchCounter, 1));
+
+      /* AlarmExpire expires on each increment */
+      (void)SetRelAlarm(AlarmExpire, 1, 1);
+      Services_Measure("incrementcounter_expire",
+            (void)IncrementCounter(BenchCounter, 1); (void)ClearEvent(EvSelf));
+      (void)CancelAlarm(AlarmExpire);
+      (void)CancelAlarm(AlarmBench);
+   }
+
+   if ( (Services_WorkerCount == 0) || (Services_WaiterCount == 0) ||
+        (Services_SetterCount == 0) )
+   {
+      /* report the failure with 0 iterations */
+      Bench_Report("services", 0, 0);
+   }
+
+   Bench_Finish();
+}
+
+TASK(Worker)
+{
+   Services_WorkerCount++;
+
+   TerminateTask();
+}
+
+TASK(Waiter)
+{
+   while(1)
+   {
+      (void)WaitEvent(EvWake);
+      (void)ClearEvent(EvWake);
+      Services_WaiterCount++;
+   }
+}
+
+TASK(Setter)
+{
+   while(1)
+   {
+      /* Bench preempts Setter as soon as its event is set */
+      Services_SetterCount++;
+      (void)SetEvent(Bench, EvSelf);
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
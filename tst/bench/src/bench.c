@@ -0,0 +1,267 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/** \brief FreeOSEK Os Benchmark Common Implementation File
+ **
+ ** \file FreeOSEK/Os/tst/bench/src/bench.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_BENCH Benchmarks
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "bench.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "time.h"
+#include "string.h"
+#include "unistd.h"
+#include "sys/ioctl.h"
+#include "sys/syscall.h"
+#include "linux/perf_event.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+/** \brief Values read from the perf event group */
+typedef struct {
+   unsigned long long Count;        /**< count of events of the group */
+   unsigned long long Values[2];    /**< instructions and cycles */
+} BenchPerfReadType;
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Open the counters
+ **
+ ** Selects the source of the counters and measures the overhead of an empty
+ ** region, it is subtracted of each measured region.
+ **/
+static void Bench_Open(void);
+
+/** \brief Open a hardware counter of the calling thread
+ **
+ ** \param[in] config PERF_COUNT_HW_* event
+ ** \param[in] group file descriptor of the group leader, -1 for the leader
+ ** \return file descriptor of the counter, -1 if not available
+ **/
+static int Bench_PerfOpen(unsigned long long config, int group);
+
+/** \brief Read the counters
+ **
+ ** \param[out] counters actual counters
+ **/
+static void Bench_Read(BenchCountersType * counters);
+
+/*==================[internal data definition]===============================*/
+/** \brief Source of the counters, 0 before they are opened */
+static uint8 Bench_Source = 0;
+
+/** \brief Group leader counting the instructions */
+static int Bench_InstructionsFd = -1;
+
+/** \brief Counter of the cycles */
+static int Bench_CyclesFd = -1;
+
+/** \brief Counters used by an empty region */
+static BenchCountersType Bench_Overhead;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static int Bench_PerfOpen(unsigned long long config, int group)
+{
+   struct perf_event_attr attr;
+
+   (void)memset(&attr, 0, sizeof(attr));
+   attr.type = PERF_TYPE_HARDWARE;
+   attr.size = sizeof(attr);
+   attr.config = config;
+   /* the leader starts disabled and enables the whole group */
+   attr.disabled = (group == -1) ? 1 : 0;
+   /* the kernel of the host is not part of the measured services */
+   attr.exclude_kernel = 1;
+   attr.exclude_hv = 1;
+   attr.read_format = PERF_FORMAT_GROUP;
+
+   /* the tasks of the port are executed on the stack of the main thread,
+    * counting the calling thread counts all of them */
+   return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void Bench_Open(void)
+{
+   BenchCountersType counters;
+   BenchCountersType min;
+   uint32 loopi;
+
+   Bench_InstructionsFd = Bench_PerfOpen(PERF_COUNT_HW_INSTRUCTIONS, -1);
+   if (Bench_InstructionsFd >= 0)
+   {
+      Bench_CyclesFd = Bench_PerfOpen(PERF_COUNT_HW_CPU_CYCLES, Bench_InstructionsFd);
+   }
+
+   if ( (Bench_InstructionsFd >= 0) && (Bench_CyclesFd >= 0) )
+   {
+      (void)ioctl(Bench_InstructionsFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      (void)ioctl(Bench_InstructionsFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+      Bench_Source = BENCH_SOURCE_PERF;
+      printf("BENCH_SOURCE:perf\n");
+   }
+   else
+   {
+      if (Bench_InstructionsFd >= 0)
+      {
+         (void)close(Bench_InstructionsFd);
+      }
+      Bench_Source = BENCH_SOURCE_RDTSC;
+      printf("BENCH_SOURCE:rdtsc\n");
+   }
+
+   /* lowest overhead of an empty region, nothing is subtracted while it is
+    * measured */
+   (void)memset(&Bench_Overhead, 0, sizeof(Bench_Overhead));
+   min.Instructions = ~0ULL;
+   min.Cycles = ~0ULL;
+   for (loopi = 0; loopi < BENCH_SAMPLES; loopi++)
+   {
+      Bench_Read(&counters);
+      Bench_Stop(&counters);
+      Bench_Min(&min, &counters);
+   }
+   Bench_Overhead.Instructions = min.Instructions;
+   Bench_Overhead.Cycles = min.Cycles;
+}
+
+static void Bench_Read(BenchCountersType * counters)
+{
+   BenchPerfReadType values;
+   unsigned int low;
+   unsigned int high;
+
+   counters->Time = Bench_GetTime();
+
+   if (BENCH_SOURCE_PERF == Bench_Source)
+   {
+      if (sizeof(values) == read(Bench_InstructionsFd, &values, sizeof(values)))
+      {
+         counters->Instructions = values.Values[0];
+         counters->Cycles = values.Values[1];
+      }
+   }
+   else
+   {
+      __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+      counters->Instructions = 0;
+      counters->Cycles = ((unsigned long long)high << 32) | low;
+   }
+}
+
+/*==================[external functions definition]==========================*/
+BenchTimeType Bench_GetTime(void)
+{
+   struct timespec ts;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return ((BenchTimeType)ts.tv_sec * 1000000000ULL) + (BenchTimeType)ts.tv_nsec;
+}
+
+void Bench_Report(const char * name, uint32 iterations, BenchTimeType time)
+{
+   printf("BENCH:%s:%u:%llu:%llu\n", name, (unsigned int)iterations, time,
+         time / ( (iterations > 0) ? iterations : 1 ) );
+}
+
+void Bench_Start(BenchCountersType * counters)
+{
+   if (0 == Bench_Source)
+   {
+      Bench_Open();
+   }
+
+   Bench_Read(counters);
+}
+
+void Bench_Stop(BenchCountersType * counters)
+{
+   BenchCountersType end;
+
+   Bench_Read(&end);
+
+   counters->Time = end.Time - counters->Time;
+   counters->Instructions = end.Instructions - counters->Instructions;
+   counters->Cycles = end.Cycles - counters->Cycles;
+
+   counters->Instructions -= (counters->Instructions > Bench_Overhead.Instructions) ?
+         Bench_Overhead.Instructions : counters->Instructions;
+   counters->Cycles -= (counters->Cycles > Bench_Overhead.Cycles) ?
+         Bench_Overhead.Cycles : counters->Cycles;
+}
+
+void Bench_Min(BenchCountersType * min, const BenchCountersType * sample)
+{
+   /* without instructions the lowest cycles are taken */
+   if ( (sample->Instructions < min->Instructions) ||
+        ( (sample->Instructions == min->Instructions) &&
+          (sample->Cycles < min->Cycles) ) )
+   {
+      *min = *sample;
+   }
+}
+
+void Bench_ReportCounters(const char * name, uint32 iterations,
+      const BenchCountersType * counters)
+{
+   unsigned long long div = (iterations > 0) ? iterations : 1;
+
+   printf("BENCH:%s:%u:%llu:%llu:%llu:%llu\n", name, (unsigned int)iterations,
+         counters->Time, counters->Time / div,
+         (counters->Instructions + (div / 2)) / div,
+         (counters->Cycles + (div / 2)) / div);
+}
+
+void Bench_Finish(void)
+{
+   (void)fflush(stdout);
+   exit(0);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
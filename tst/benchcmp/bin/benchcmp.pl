@@ -0,0 +1,603 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Benchmark comparator
+#
+# Stores the results of the benchmarks (tst/bench) in a JSON file per run
+# and compares two runs. Each BENCH line of the output is a sample, the
+# benchmarks repeat each measurement BENCH_REPEAT times. The results can be
+# stored from several outputs of the same target, for example the x86 build
+# and an output captured from a simulator.
+#
+# For each benchmark the medians of both runs are compared. A change is
+# reported when the Mann-Whitney test rejects that both runs have the same
+# distribution and the change of the median is larger than the threshold.
+# The confidence interval of the change is estimated by bootstrap. The
+# instructions are compared when both runs have them (perf counters),
+# otherwise the time.
+#
+# The tool exits with an error if a benchmark has regressed, so it can be
+# used to gate a change of the kernel. The HTML report has no external
+# dependencies.
+#
+# Usage:
+#    store the results of a run:
+#    perl modules/rtos/tst/benchcmp/bin/benchcmp.pl -s <run json> [-t <target>]
+#         <benchmark output>...
+#
+#    compare two runs:
+#    perl modules/rtos/tst/benchcmp/bin/benchcmp.pl [-m <ns|instructions|cycles>]
+#         [-a <alpha>] [-d <threshold %>] [-b <resamples>] [-h <html report>]
+#         <base run json> <new run json>
+#
+
+use JSON::PP;
+
+$errors = 0;
+$warnings = 0;
+
+# results of the compare, one entry for each benchmark
+@Results = ();
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+sub warning
+{
+   print "WARNING " . @_[0] . "\n";
+   $warnings++;
+}
+
+#** \brief Read a stored run
+#
+# \param[in] file json file of the run
+# \return reference to the run
+#*
+sub ReadRun
+{
+   my $file = shift;
+   my $text;
+
+   open RUN, "<$file" or die "Run $file can not be opened: $!";
+   local $/;
+   $text = <RUN>;
+   close RUN;
+
+   return decode_json($text);
+}
+
+#** \brief Store the samples of benchmark outputs in a run
+#
+# The samples are added to the run if it already exists.
+#
+# \param[in] file json file of the run
+# \param[in] target target of the outputs
+# \param[in] outputs list of benchmark outputs
+#*
+sub Store
+{
+   my ($file, $target, @outputs) = @_;
+   my $run = { "target" => $target, "source" => "", "benchmarks" => {} };
+   my $count = 0;
+
+   if (-e $file)
+   {
+      $run = ReadRun($file);
+      if ($run->{"target"} ne $target)
+      {
+         error("run $file is of target $run->{target}, not $target");
+         return;
+      }
+   }
+
+   foreach $output (@outputs)
+   {
+      open OUT, "<$output" or die "Output $output can not be opened: $!";
+      while (my $line = <OUT>)
+      {
+         if ($line =~ /BENCH_SOURCE:(\w+)/)
+         {
+            if ( ($run->{"source"} ne "") && ($run->{"source"} ne $1) )
+            {
+               warning("$output: counters of $1, the run has counters of $run->{source}");
+            }
+            $run->{"source"} = $1;
+         }
+         elsif ($line =~ /BENCH:([^:]+):(\d+):(\d+):(\d+)(?::(\d+):(\d+))?\s*$/)
+         {
+            my ($name, $iterations, $total) = ($1, $2, $3);
+            my $bench;
+
+            if ($iterations == 0)
+            {
+               error("$output: benchmark $name failed");
+               next;
+            }
+
+            if (!exists($run->{"benchmarks"}->{$name}))
+            {
+               $run->{"benchmarks"}->{$name} =
+                  { "iterations" => $iterations + 0, "ns" => [], "instructions" => [], "cycles" => [] };
+            }
+            $bench = $run->{"benchmarks"}->{$name};
+            push(@{$bench->{"ns"}}, $total / $iterations);
+            if (defined($5))
+            {
+               push(@{$bench->{"instructions"}}, $5 + 0);
+               push(@{$bench->{"cycles"}}, $6 + 0);
+            }
+            $count++;
+         }
+      }
+      close OUT;
+   }
+
+   open RUN, ">$file" or die "Run $file can not be created: $!";
+   print RUN JSON::PP->new->canonical->pretty->encode($run);
+   close RUN;
+
+   print "$count samples stored in $file\n";
+}
+
+#** \brief Median of a list
+#
+# \param[in] values reference to the values
+# \return median
+#*
+sub Median
+{
+   my @sorted = sort { $a <=> $b } @{$_[0]};
+   my $n = $#sorted + 1;
+
+   return ($n % 2) ? $sorted[($n - 1) / 2] : ($sorted[$n / 2 - 1] + $sorted[$n / 2]) / 2;
+}
+
+#** \brief Probability of the exact distribution of U
+#
+# Counts the orderings of two samples without ties with a statistic of u.
+#
+# \param[in] m size of the first sample
+# \param[in] n size of the second sample
+# \return reference to the probabilities of each u
+#*
+sub DistributionU
+{
+   my ($m, $n) = @_;
+   my @count = ();
+   my $total = 0;
+   my @p = ();
+
+   # count[i][j][u] = count[i - 1][j][u - j] + count[i][j - 1][u]
+   for ($i = 0; $i <= $m; $i++)
+   {
+      for ($j = 0; $j <= $n; $j++)
+      {
+         for ($u = 0; $u <= $i * $j; $u++)
+         {
+            if ( ($i == 0) || ($j == 0) )
+            {
+               $count[$i][$j][$u] = 1;
+            }
+            else
+            {
+               $count[$i][$j][$u] = (($u >= $j) ? $count[$i - 1][$j][$u - $j] : 0) +
+                  (($u <= ($i * ($j - 1))) ? $count[$i][$j - 1][$u] : 0);
+            }
+         }
+      }
+   }
+
+   for ($u = 0; $u <= $m * $n; $u++)
+   {
+      $total += $count[$m][$n][$u];
+   }
+   for ($u = 0; $u <= $m * $n; $u++)
+   {
+      $p[$u] = $count[$m][$n][$u] / $total;
+   }
+
+   return \@p;
+}
+
+#** \brief Two sided Mann-Whitney U test
+#
+# Without ties and for small samples the exact distribution is used,
+# otherwise the normal approximation with correction of the ties.
+#
+# \param[in] x reference to the first sample
+# \param[in] y reference to the second sample
+# \return p value
+#*
+sub MannWhitney
+{
+   my ($x, $y) = @_;
+   my $m = $#$x + 1;
+   my $n = $#$y + 1;
+   my @all = sort { $a->[0] <=> $b->[0] } ( (map { [ $_, 0 ] } @$x), (map { [ $_, 1 ] } @$y) );
+   my $ranksum = 0;
+   my $ties = 0;
+   my $i = 0;
+   my ($u, $mean, $var, $z, $p);
+
+   # average ranks of the ties
+   while ($i <= $#all)
+   {
+      my $j = $i;
+      my $t;
+
+      while ( ($j < $#all) && ($all[$j + 1]->[0] == $all[$i]->[0]) )
+      {
+         $j++;
+      }
+      $t = $j - $i + 1;
+      $ties += $t * $t * $t - $t;
+      for ($k = $i; $k <= $j; $k++)
+      {
+         if ($all[$k]->[1] == 0)
+         {
+            $ranksum += ($i + $j) / 2 + 1;
+         }
+      }
+      $i = $j + 1;
+   }
+
+   $u = $ranksum - $m * ($m + 1) / 2;
+   $mean = $m * $n / 2;
+
+   if ( ($ties == 0) && ($m <= 20) && ($n <= 20) )
+   {
+      my $dist = DistributionU($m, $n);
+      my $low = 0;
+      my $high = 0;
+
+      for ($i = 0; $i <= $m * $n; $i++)
+      {
+         $low += $dist->[$i] if ($i <= $u);
+         $high += $dist->[$i] if ($i >= $u);
+      }
+      $p = 2 * (($low < $high) ? $low : $high);
+   }
+   else
+   {
+      $var = $m * $n / 12 * ( ($m + $n + 1) - $ties / (($m + $n) * ($m + $n - 1)) );
+      if ($var <= 0)
+      {
+         # all the samples are equal
+         return 1;
+      }
+      $z = (abs($u - $mean) - 0.5) / sqrt($var);
+      $z = 0 if ($z < 0);
+      $p = 2 * (1 - Phi($z));
+   }
+
+   return ($p > 1) ? 1 : $p;
+}
+
+#** \brief Cumulative standard normal distribution
+#
+# \param[in] z value
+# \return probability of a value lower than z
+#*
+sub Phi
+{
+   my $z = shift;
+   # Abramowitz and Stegun 26.2.17
+   my $t = 1 / (1 + 0.2316419 * abs($z));
+   my $d = 0.3989422804014327 * exp(-$z * $z / 2);
+   my $q = $d * $t * (0.319381530 + $t * (-0.356563782 + $t * (1.781477937 +
+           $t * (-1.821255978 + $t * 1.330274429))));
+
+   return ($z >= 0) ? 1 - $q : $q;
+}
+
+#** \brief Bootstrap confidence interval of the change of the median
+#
+# \param[in] x reference to the base sample
+# \param[in] y reference to the new sample
+# \param[in] resamples count of resamples
+# \param[in] level confidence level
+# \return lower and upper bound of the change in percent
+#*
+sub Bootstrap
+{
+   my ($x, $y, $resamples, $level) = @_;
+   my @changes = ();
+   my ($low, $high);
+
+   for ($r = 0; $r < $resamples; $r++)
+   {
+      my @bx = map { $x->[int(rand($#$x + 1))] } @$x;
+      my @by = map { $y->[int(rand($#$y + 1))] } @$y;
+      my $mx = Median(\@bx);
+
+      push(@changes, ($mx != 0) ? (Median(\@by) - $mx) / $mx * 100 : 0);
+   }
+   @changes = sort { $a <=> $b } @changes;
+
+   $low = $changes[int($resamples * (1 - $level) / 2)];
+   $high = $changes[int($resamples * (1 + $level) / 2) - 1];
+
+   return ($low, $high);
+}
+
+#** \brief Escape a text for HTML
+#
+# \param[in] text text
+# \return escaped text
+#*
+sub Html
+{
+   my $text = shift;
+
+   $text =~ s/&/&amp;/g;
+   $text =~ s/</&lt;/g;
+   $text =~ s/>/&gt;/g;
+
+   return $text;
+}
+
+#** \brief Write the HTML report of the compare
+#
+# \param[in] file html file
+# \param[in] base name of the base run
+# \param[in] new name of the new run
+#*
+sub WriteHtml
+{
+   my ($file, $base, $new) = @_;
+   my %colors = ( "regression" => "#f4c7c3", "improvement" => "#c8e6c9",
+                  "same" => "#ffffff", "added" => "#eeeeee", "removed" => "#eeeeee" );
+   my $scale = $threshold;
+
+   # the bars of all the benchmarks have the same scale
+   foreach $result (@Results)
+   {
+      foreach $value ($result->{"low"}, $result->{"high"}, $result->{"change"})
+      {
+         $scale = abs($value) if ( (defined($value)) && (abs($value) > $scale) );
+      }
+   }
+
+   open HTML, ">$file" or die "$file can not be created: $!";
+   print HTML "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n";
+   print HTML "<title>Benchmark compare</title>\n<style>\n";
+   print HTML "body { font-family: sans-serif; }\n";
+   print HTML "table { border-collapse: collapse; }\n";
+   print HTML "th, td { border: 1px solid #999999; padding: 2px 8px; text-align: right; }\n";
+   print HTML "td.name, td.verdict { text-align: left; }\n";
+   print HTML "</style>\n</head>\n<body>\n";
+   print HTML "<h1>Benchmark compare</h1>\n";
+   print HTML "<p>base: " . Html($base) . "<br>\nnew: " . Html($new) . "<br>\n";
+   print HTML "alpha $alpha, threshold $threshold %, $resamples resamples</p>\n";
+   print HTML "<table>\n<tr><th>benchmark</th><th>metric</th><th>base</th><th>new</th>" .
+              "<th>change %</th><th>interval %</th><th>p</th><th>verdict</th><th></th></tr>\n";
+
+   foreach $result (@Results)
+   {
+      my $svg = "";
+
+      if (defined($result->{"change"}))
+      {
+         # bar of the confidence interval and mark of the change, 0 in the middle
+         my $x0 = 100 + 90 * $result->{"low"} / $scale;
+         my $x1 = 100 + 90 * $result->{"high"} / $scale;
+         my $xc = 100 + 90 * $result->{"change"} / $scale;
+
+         $svg = sprintf("<svg width=\"200\" height=\"16\">" .
+                        "<line x1=\"100\" y1=\"0\" x2=\"100\" y2=\"16\" stroke=\"#999999\"/>" .
+                        "<rect x=\"%.1f\" y=\"5\" width=\"%.1f\" height=\"6\" fill=\"#5c85d6\"/>" .
+                        "<rect x=\"%.1f\" y=\"2\" width=\"2\" height=\"12\" fill=\"#000000\"/></svg>",
+                        $x0, ($x1 - $x0 > 1) ? $x1 - $x0 : 1, $xc - 1);
+      }
+
+      printf HTML "<tr style=\"background-color: %s\"><td class=\"name\">%s</td><td>%s</td>" .
+                  "<td>%s</td><td>%s</td><td>%s</td><td>%s</td><td>%s</td><td class=\"verdict\">%s</td><td>%s</td></tr>\n",
+                  $colors{$result->{"verdict"}}, Html($result->{"name"}), $result->{"metric"},
+                  Format($result->{"base"}), Format($result->{"new"}),
+                  defined($result->{"change"}) ? sprintf("%+.2f", $result->{"change"}) : "",
+                  defined($result->{"change"}) ? sprintf("%+.2f .. %+.2f", $result->{"low"}, $result->{"high"}) : "",
+                  defined($result->{"p"}) ? sprintf("%.4f", $result->{"p"}) : "",
+                  $result->{"verdict"}, $svg;
+   }
+
+   print HTML "</table>\n</body>\n</html>\n";
+   close HTML;
+}
+
+#** \brief Format a median for the reports
+#
+# \param[in] value median, undef if not available
+# \return formatted value
+#*
+sub Format
+{
+   my $value = shift;
+
+   return defined($value) ? sprintf("%.1f", $value) : "-";
+}
+
+$runfile = "";
+$target = "x86";
+$metric = "";
+$alpha = 0.05;
+$threshold = 1;
+$resamples = 2000;
+$htmlfile = "";
+while ( ($#ARGV >= 0) && ($ARGV[0] =~ /^-/) )
+{
+   $opt = shift(@ARGV);
+   if ($opt eq "-s")
+   {
+      $runfile = shift(@ARGV);
+   }
+   elsif ($opt eq "-t")
+   {
+      $target = shift(@ARGV);
+   }
+   elsif ($opt eq "-m")
+   {
+      $metric = shift(@ARGV);
+   }
+   elsif ($opt eq "-a")
+   {
+      $alpha = shift(@ARGV);
+   }
+   elsif ($opt eq "-d")
+   {
+      $threshold = shift(@ARGV);
+   }
+   elsif ($opt eq "-b")
+   {
+      $resamples = shift(@ARGV);
+   }
+   elsif ($opt eq "-h")
+   {
+      $htmlfile = shift(@ARGV);
+   }
+}
+
+if ($runfile ne "")
+{
+   if ($#ARGV < 0)
+   {
+      print "benchcmp.pl -s <run json> [-t <target>] <benchmark output>...\n";
+      exit(1);
+   }
+   Store($runfile, $target, @ARGV);
+   exit($errors > 0 ? 1 : 0);
+}
+
+if ( ($#ARGV != 1) || ( ($metric ne "") && ($metric !~ /^(ns|instructions|cycles)$/) ) )
+{
+   print "benchcmp.pl [-m <ns|instructions|cycles>] [-a <alpha>] [-d <threshold %>] [-b <resamples>] [-h <html report>] <base run json> <new run json>\n";
+   exit(1);
+}
+
+$base = ReadRun($ARGV[0]);
+$new = ReadRun($ARGV[1]);
+if ($base->{"target"} ne $new->{"target"})
+{
+   warning("the runs are of the targets $base->{target} and $new->{target}");
+}
+if ($base->{"source"} ne $new->{"source"})
+{
+   warning("the runs have counters of $base->{source} and $new->{source}");
+}
+
+# the resamples are the same in each compare
+srand(1);
+
+%names = map { $_ => 1 } (keys(%{$base->{"benchmarks"}}), keys(%{$new->{"benchmarks"}}));
+foreach $name (sort(keys(%names)))
+{
+   my $bb = $base->{"benchmarks"}->{$name};
+   my $nb = $new->{"benchmarks"}->{$name};
+   my $result = { "name" => $name, "metric" => "" };
+   my $m = $metric;
+
+   if (!defined($bb) || !defined($nb))
+   {
+      $result->{"verdict"} = defined($bb) ? "removed" : "added";
+      push(@Results, $result);
+      next;
+   }
+
+   if ($m eq "")
+   {
+      # the instructions do not depend on the load of the host
+      $m = ( ($#{$bb->{"instructions"}} >= 0) && ($#{$nb->{"instructions"}} >= 0) &&
+             (Median($bb->{"instructions"}) > 0) && (Median($nb->{"instructions"}) > 0) ) ?
+           "instructions" : "ns";
+   }
+   $result->{"metric"} = $m;
+
+   if ( ($#{$bb->{$m}} < 0) || ($#{$nb->{$m}} < 0) )
+   {
+      warning("benchmark $name has no samples of $m");
+      $result->{"verdict"} = "same";
+      push(@Results, $result);
+      next;
+   }
+
+   $result->{"base"} = Median($bb->{$m});
+   $result->{"new"} = Median($nb->{$m});
+   $result->{"change"} = ($result->{"base"} != 0) ?
+      ($result->{"new"} - $result->{"base"}) / $result->{"base"} * 100 : 0;
+   ($result->{"low"}, $result->{"high"}) = Bootstrap($bb->{$m}, $nb->{$m}, $resamples, 1 - $alpha);
+   $result->{"p"} = MannWhitney($bb->{$m}, $nb->{$m});
+
+   if ( ($result->{"p"} < $alpha) && ($result->{"change"} > $threshold) )
+   {
+      $result->{"verdict"} = "regression";
+   }
+   elsif ( ($result->{"p"} < $alpha) && ($result->{"change"} < -$threshold) )
+   {
+      $result->{"verdict"} = "improvement";
+   }
+   else
+   {
+      $result->{"verdict"} = "same";
+   }
+   push(@Results, $result);
+}
+
+printf("%-20s %-12s %12s %12s %9s %19s %8s  %s\n", "benchmark", "metric", "base",
+       "new", "change %", "interval %", "p", "verdict");
+foreach $result (@Results)
+{
+   if (defined($result->{"change"}))
+   {
+      printf("%-20s %-12s %12s %12s %+9.2f %+9.2f..%+8.2f %8.4f  %s\n",
+             $result->{"name"}, $result->{"metric"}, Format($result->{"base"}),
+             Format($result->{"new"}), $result->{"change"}, $result->{"low"},
+             $result->{"high"}, $result->{"p"}, $result->{"verdict"});
+   }
+   else
+   {
+      printf("%-20s %-12s %12s %12s %9s %19s %8s  %s\n", $result->{"name"},
+             $result->{"metric"}, "-", "-", "", "", "", $result->{"verdict"});
+   }
+   if ($result->{"verdict"} eq "regression")
+   {
+      error("benchmark $result->{name} has regressed " . sprintf("%+.2f", $result->{"change"}) . " %");
+   }
+}
+
+if ($htmlfile ne "")
+{
+   WriteHtml($htmlfile, $ARGV[0], $ARGV[1]);
+}
+
+exit($errors > 0 ? 1 : 0);
@@ -0,0 +1,264 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Benchmark comparator test
+#
+# Writes synthetic benchmark outputs with known samples and compares them with
+# benchcmp.pl. The new run has one benchmark shifted up by 20 % (regression),
+# one shifted down by 20 % (improvement, more than 20 samples so the normal
+# approximation is used) and one without a shift. A second new run has no
+# shift at all. The verdicts, the range of the p values, the exit status and
+# the HTML report are checked.
+#
+# Usage:
+#    perl modules/rtos/tst/benchcmp/bin/benchcmptest.pl
+#
+
+use File::Basename;
+use File::Temp qw(tempdir);
+
+$errors = 0;
+
+# exact p value of 10 against 10 samples without overlap: 2 / (20 over 10)
+$ExactP = 2 / 184756;
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Write a file
+#
+# \param[in] file file name
+# \param[in] text content of the file
+#*
+sub WriteFile
+{
+   my ($file, $text) = @_;
+
+   open FILE, ">$file" or die "$file can not be opened: $!";
+   print FILE $text;
+   close FILE;
+}
+
+#** \brief Read a file
+#
+# \param[in] file file name
+# \return content of the file
+#*
+sub ReadFile
+{
+   my $file = shift;
+   my $text = "";
+
+   if (open FILE, "<$file")
+   {
+      local $/;
+      $text = <FILE>;
+      close FILE;
+   }
+   else
+   {
+      error("$file has not been written");
+   }
+
+   return $text;
+}
+
+#** \brief Benchmark output with counters
+#
+# Each sample is reported with 1000 iterations, the time per iteration is
+# twice the instructions.
+#
+# \param[in] benchmarks reference to a hash of the instructions of the
+#            samples of each benchmark
+# \return text of the output
+#*
+sub Output
+{
+   my $benchmarks = shift;
+   my $text = "BENCH_SOURCE:perf\n";
+
+   foreach $name (sort(keys(%$benchmarks)))
+   {
+      foreach $instructions (@{$benchmarks->{$name}})
+      {
+         $text .= sprintf("BENCH:%s:1000:%u:%u:%u:%u\n", $name,
+                          $instructions * 2000, $instructions * 2,
+                          $instructions, $instructions * 3);
+      }
+   }
+
+   return $text;
+}
+
+#** \brief Run benchcmp.pl
+#
+# \param[in] args arguments
+# \return exit status and the lines of the output
+#*
+sub Run
+{
+   my $args = shift;
+   my @output;
+
+   @output = `perl "@{[dirname(__FILE__)]}/benchcmp.pl" $args`;
+   chomp(@output);
+
+   return ($? >> 8, @output);
+}
+
+#** \brief Check the result of a benchmark in the compare
+#
+# \param[in] output reference to the lines of the compare
+# \param[in] name name of the benchmark
+# \param[in] verdict expected verdict
+# \param[in] low lowest expected p value
+# \param[in] high highest expected p value
+#*
+sub CheckResult
+{
+   my ($output, $name, $verdict, $low, $high) = @_;
+   my @lines = grep { /^\Q$name\E\s/ } @$output;
+
+   if (@lines != 1)
+   {
+      error("benchmark $name is reported " . scalar(@lines) . " times");
+   }
+   elsif ($lines[0] !~ /^\S+\s+instructions\s.*\s(\d+\.\d{4})\s+(\w+)$/)
+   {
+      error("benchmark $name: \"$lines[0]\" is not a result of the instructions");
+   }
+   else
+   {
+      my ($p, $v) = ($1, $2);
+
+      if ($v ne $verdict)
+      {
+         error("benchmark $name is $v instead of $verdict");
+      }
+      # p is reported with 4 decimals
+      if ( ($p < sprintf("%.4f", $low)) || ($p > sprintf("%.4f", $high)) )
+      {
+         error("benchmark $name has p $p, expected $low .. $high");
+      }
+   }
+}
+
+$dir = tempdir(CLEANUP => 1);
+
+# base run: samples without ties, the improvement has more than 20 samples
+%base = ( "activate" => [ 100 .. 109 ], "schedule" => [ 200 .. 209 ],
+          "setevent" => [ 300 .. 324 ] );
+# shifted run: +20 %, none and -20 %
+%shift = ( "activate" => [ 120 .. 129 ], "schedule" => [ reverse(200 .. 209) ],
+           "setevent" => [ 240 .. 264 ] );
+
+# the base is stored from two outputs
+WriteFile("$dir/base1.txt", Output({ map { $_ => [ @{$base{$_}}[0 .. 4] ] } keys(%base) }));
+WriteFile("$dir/base2.txt", Output({ map { $_ => [ @{$base{$_}}[5 .. $#{$base{$_}}] ] } keys(%base) }));
+WriteFile("$dir/shift.txt", Output(\%shift));
+WriteFile("$dir/same.txt", Output(\%base));
+
+($status, @output) = Run("-s \"$dir/base.json\" -t x86 \"$dir/base1.txt\" \"$dir/base2.txt\"");
+if ( ($status != 0) || ($output[0] ne "45 samples stored in $dir/base.json") )
+{
+   error("the base run has not been stored: @output");
+}
+($status, @output) = Run("-s \"$dir/shift.json\" -t x86 \"$dir/shift.txt\"");
+if ($status != 0)
+{
+   error("the shifted run has not been stored: @output");
+}
+($status, @output) = Run("-s \"$dir/same.json\" -t x86 \"$dir/same.txt\"");
+if ($status != 0)
+{
+   error("the run without shift has not been stored: @output");
+}
+
+# known shift
+($status, @output) = Run("-b 500 -h \"$dir/shift.html\" \"$dir/base.json\" \"$dir/shift.json\"");
+if ($status != 1)
+{
+   error("benchcmp.pl exits with $status instead of 1 with a regression");
+}
+CheckResult(\@output, "activate", "regression", 0, $ExactP);
+CheckResult(\@output, "schedule", "same", 0.05, 1);
+CheckResult(\@output, "setevent", "improvement", 0, 0.001);
+if (!grep { $_ eq "ERROR benchmark activate has regressed +19.14 %" } @output)
+{
+   error("the regression of activate is not reported");
+}
+if (grep { /^ERROR benchmark (schedule|setevent)/ } @output)
+{
+   error("a benchmark without regression is reported as regressed");
+}
+
+# no shift
+($status, @output) = Run("-b 500 -h \"$dir/same.html\" \"$dir/base.json\" \"$dir/same.json\"");
+if ($status != 0)
+{
+   error("benchcmp.pl exits with $status instead of 0 without a shift");
+}
+CheckResult(\@output, "activate", "same", 0.05, 1);
+CheckResult(\@output, "schedule", "same", 0.05, 1);
+CheckResult(\@output, "setevent", "same", 0.05, 1);
+
+# the HTML report shall not depend on other files
+foreach $html ("$dir/shift.html", "$dir/same.html")
+{
+   my $text = ReadFile($html);
+
+   if ($text !~ /^<!DOCTYPE html>\n/ || $text !~ /<\/html>\n$/)
+   {
+      error("$html is not a complete HTML document");
+   }
+   if ($text =~ /(src=|href=|<link|<script|url\(|\@import)/i)
+   {
+      error("$html references $1");
+   }
+   foreach $name (sort(keys(%base)))
+   {
+      if ($text !~ /<td class="name">$name<\/td>/)
+      {
+         error("$html has no row of $name");
+      }
+   }
+}
+if (ReadFile("$dir/shift.html") !~ /<td class="name">activate<\/td>.*<td class="verdict">regression<\/td>/)
+{
+   error("the HTML report has not the regression of activate");
+}
+
+print (($errors > 0) ? "benchcmptest: $errors errors\n" : "benchcmptest: OK\n");
+exit($errors > 0 ? 1 : 0);
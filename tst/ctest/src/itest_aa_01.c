@@ -0,0 +1,188 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the activation arguments, Test
+ **        Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_aa_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_AA Activation Argument
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_AA_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_aa_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task2 */
+static uint8 Task2Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   ActivationArgType arg;
+
+   Sequence(0);
+   /* Task1 has no argument queue */
+   ret = GetActivationArg(&arg);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+
+   /* Task2 has a lower priority, the activations are queued */
+   ret = ActivateTaskWithArg(Task2, 10);
+   ASSERT(OTHER, ret != E_OK);
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+   ret = ActivateTaskWithArg(Task2, 30);
+   ASSERT(OTHER, ret != E_OK);
+   ret = ActivateTaskWithArg(Task2, 40);
+   ASSERT(OTHER, ret != E_OS_LIMIT);
+
+   ret = ActivateTaskWithArg(Task3, 1);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   ret = ActivateTaskWithArg((TaskType)3, 1);
+   ASSERT(OTHER, ret != E_OS_ID);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+
+   Sequence(1);
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+   ActivationArgType arg;
+
+   Task2Runs++;
+   ret = GetActivationArg(&arg);
+   ASSERT(OTHER, ret != E_OK);
+
+   switch (Task2Runs)
+   {
+      case 1:
+         Sequence(2);
+         ASSERT(OTHER, arg != 10);
+         break;
+      case 2:
+         /* activated with ActivateTask */
+         Sequence(3);
+         ASSERT(OTHER, arg != 0);
+         break;
+      case 3:
+         Sequence(4);
+         ASSERT(OTHER, arg != 30);
+         /* the argument queue wraps around */
+         ret = ActivateTaskWithArg(Task2, 50);
+         ASSERT(OTHER, ret != E_OK);
+         /* the argument remains until the task terminates */
+         ret = GetActivationArg(&arg);
+         ASSERT(OTHER, arg != 30);
+         break;
+      case 4:
+         Sequence(5);
+         ASSERT(OTHER, arg != 50);
+         ret = ChainTask(Task2);
+         ASSERT(OTHER, 1);
+         break;
+      default:
+         /* activated with ChainTask */
+         Sequence(6);
+         ASSERT(OTHER, arg != 0);
+         break;
+   }
+
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+   ActivationArgType arg;
+
+   Sequence(7);
+   ASSERT(OTHER, Task2Runs != 5);
+
+   ret = GetActivationArg(&arg);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
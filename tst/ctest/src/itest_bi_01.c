@@ -0,0 +1,154 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the boot image, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_bi_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_BI Boot image
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_BI_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_bi_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1, the test is executed with and without boot
+    * image and shall pass in both cases */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+   TickType ticks;
+
+   Sequence(0);
+   /* Task1 and Task2 are auto start tasks, Task3 is suspended */
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != SUSPENDED);
+
+   /* the auto start activation of Task1 is counted */
+   ret = ActivateTask(Task1);
+   ASSERT(OTHER, ret != E_OS_LIMIT);
+
+   /* Alarm1 is an auto start alarm, Alarm2 is not running */
+   ret = GetAlarm(Alarm1, &ticks);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, ticks != 2);
+
+   ret = GetAlarm(Alarm2, &ticks);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+   /* Alarm1 expires 2 ticks after the start and activates Task3 */
+   IncAlarmCounter();
+
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != SUSPENDED);
+
+   IncAlarmCounter();
+
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   /* Alarm1 is cyclic */
+   ret = GetAlarm(Alarm1, &ticks);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, ticks != 3);
+
+   Sequence(1);
+   /* Task2 has the same priority as Task1 and is executed before Task3 */
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sequence(2);
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   Sequence(3);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,190 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the cascaded counters, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_cc_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_CC Cascaded counters
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_CC_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "Os_Internal.h"   /* include os internal header file */
+#include "itest_cc_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief Count of calls to the callback of NestIncrement */
+static uint8 NestCount = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+ALARMCALLBACK(NestIncrement)
+{
+   NestCount++;
+
+   /* increment the counter of the cascade which executes this callback */
+   (void)IncrementCounter(SwCounter, 2);
+}
+
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+   CounterIncrementType next;
+   TickType tick;
+
+   Sequence(0);
+   /* Counter1 is incremented each 2 ticks of SwCounter, Counter2 each 3
+    * ticks of Counter1, Task2 is activated after 2 ticks of Counter2 */
+   ret = SetRelAlarm(IncrementCounter1, 2, 2);
+   ASSERT(OTHER, ret != E_OK);
+   ret = SetRelAlarm(IncrementCounter2, 3, 3);
+   ASSERT(OTHER, ret != E_OK);
+   ret = SetRelAlarm(ActivateTask2, 2, 0);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* the next expiration is Task2 after 12 ticks of SwCounter */
+   SuspendAllInterrupts();
+   next = IncrementCounter(SwCounter, 1);
+   ResumeAllInterrupts();
+   ASSERT(OTHER, next != 11);
+
+   Sequence(1);
+   /* Counter1 is incremented 5 times at once and Counter2 1 time */
+   SuspendAllInterrupts();
+   next = IncrementCounter(SwCounter, 10);
+   ResumeAllInterrupts();
+   ASSERT(OTHER, next != 1);
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != SUSPENDED);
+
+   Sequence(2);
+   /* Task2 is activated, no alarm expires any more */
+   SuspendAllInterrupts();
+   next = IncrementCounter(SwCounter, 1);
+   ResumeAllInterrupts();
+   ASSERT(OTHER, next != (CounterIncrementType)-1);
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   Sequence(3);
+   (void)CancelAlarm(IncrementCounter1);
+   (void)CancelAlarm(IncrementCounter2);
+
+   /* Counter1 and Counter2 are incremented each 2 ticks, NestIncrement
+    * expires together with IncrementCounter1 and increments SwCounter again
+    * from its callback */
+   ret = SetRelAlarm(IncrementCounter1, 2, 2);
+   ASSERT(OTHER, ret != E_OK);
+   ret = SetRelAlarm(IncrementCounter2, 2, 2);
+   ASSERT(OTHER, ret != E_OK);
+   ret = SetRelAlarm(ActivateTask2, 50, 0);
+   ASSERT(OTHER, ret != E_OK);
+   ret = SetRelAlarm(NestIncrement, 2, 0);
+   ASSERT(OTHER, ret != E_OK);
+
+   SuspendAllInterrupts();
+   next = IncrementCounter(SwCounter, 2);
+   ResumeAllInterrupts();
+
+   Sequence(4);
+   /* both increments of Counter1 are processed, Counter2 is incremented
+    * once and the next expiration includes the nested increment */
+   ASSERT(OTHER, NestCount != 1);
+   ret = GetAlarm(IncrementCounter2, &tick);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, tick != 2);
+   ret = GetAlarm(ActivateTask2, &tick);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, tick != 49);
+   ASSERT(OTHER, next != 196);
+
+   (void)CancelAlarm(IncrementCounter1);
+   (void)CancelAlarm(IncrementCounter2);
+   (void)CancelAlarm(ActivateTask2);
+
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sequence(5);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
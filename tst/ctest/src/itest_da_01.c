@@ -0,0 +1,196 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the data, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_da_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_DA Data
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_DA_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_da_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   uint32 seqvalue[3];
+   uint8 triplevalue[5];
+
+   Sequence(0);
+   ret = ReadData(SeqData, seqvalue);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+   ret = ReadData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+   Sequence(1);
+   seqvalue[0] = 1;
+   seqvalue[1] = 2;
+   seqvalue[2] = 3;
+   ret = WriteData(SeqData, seqvalue);
+   ASSERT(OTHER, ret != E_OK);
+
+   seqvalue[0] = 0;
+   seqvalue[1] = 0;
+   seqvalue[2] = 0;
+   ret = ReadData(SeqData, seqvalue);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, seqvalue[0] != 1);
+   ASSERT(OTHER, seqvalue[1] != 2);
+   ASSERT(OTHER, seqvalue[2] != 3);
+
+   Sequence(2);
+   /* two writes without read, the reader gets only the last one */
+   triplevalue[0] = 1;
+   triplevalue[4] = 1;
+   ret = WriteData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+   triplevalue[0] = 2;
+   triplevalue[4] = 2;
+   ret = WriteData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+
+   triplevalue[0] = 0;
+   triplevalue[4] = 0;
+   ret = ReadData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, triplevalue[0] != 2);
+   ASSERT(OTHER, triplevalue[4] != 2);
+
+   /* without a new write the last value is read again */
+   triplevalue[0] = 0;
+   triplevalue[4] = 0;
+   ret = ReadData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, triplevalue[0] != 2);
+   ASSERT(OTHER, triplevalue[4] != 2);
+
+   triplevalue[0] = 3;
+   triplevalue[4] = 3;
+   ret = WriteData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+   ret = ReadData(TripleData, triplevalue);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, triplevalue[0] != 3);
+   ASSERT(OTHER, triplevalue[4] != 3);
+
+   Sequence(3);
+   /* the isr becomes the writer of SeqData */
+   TriggerISR2();
+
+   Sequence(5);
+   ret = ReadData(SeqData, seqvalue);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, seqvalue[0] != 4);
+   ASSERT(OTHER, seqvalue[1] != 5);
+   ASSERT(OTHER, seqvalue[2] != 6);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   ret = ReadData((DataType)2, seqvalue);
+   ASSERT(OTHER, ret != E_OS_ID);
+   ret = WriteData((DataType)2, seqvalue);
+   ASSERT(OTHER, ret != E_OS_ID);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sequence(6);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+ISR(ISR2)
+{
+   StatusType ret;
+   uint32 seqvalue[3];
+
+   Sequence(4);
+   seqvalue[0] = 4;
+   seqvalue[1] = 5;
+   seqvalue[2] = 6;
+   ret = WriteData(SeqData, seqvalue);
+   ASSERT(OTHER, ret != E_OK);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
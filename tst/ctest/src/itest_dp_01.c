@@ -0,0 +1,219 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the dynamic task priorities, Test Sequence 1
+ **
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_dp_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_DP Dynamic priorities
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_DP_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_dp_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task3 */
+static uint8 Task3Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+
+   Sequence(0);
+   /* the priority of a suspended task is changed */
+   ret = SetTaskPriority(Task2, 2);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* Task2 has now priority 2 and preempts Task1 */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(6);
+   /* Task3 has priority 0 and does not preempt Task1 */
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(7);
+   /* both activations of Task3 are moved and executed */
+   ret = SetTaskPriority(Task3, 2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(10);
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* the priority of Res1 is kept until it is released */
+   ret = SetTaskPriority(Task1, 0);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(11);
+   /* Task3 is executed */
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(13);
+   /* Task1 was the first task with priority 0, Task2 continues */
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Sequence(1);
+   /* the running task is placed before Task1 and continues */
+   ret = SetTaskPriority(Task2, 0);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(2);
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   /* the ready Task1 gets a higher priority and preempts Task2 */
+   ret = SetTaskPriority(Task1, 1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(14);
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(18);
+   /* Task2 was preempted and continues before Task1 */
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+
+   Task3Runs++;
+
+   switch(Task3Runs)
+   {
+      case 1:
+         Sequence(3);
+         /* lowering the priority of the running task does not preempt it
+          * while no other task has a higher priority */
+         ret = SetTaskPriority(Task3, 0);
+         ASSERT(OTHER, ret != E_OK);
+
+         Sequence(4);
+         break;
+      case 2:
+         Sequence(8);
+         break;
+      case 3:
+         Sequence(9);
+         break;
+      case 4:
+         Sequence(12);
+         break;
+      default:
+         Sequence(15);
+         ret = SetTaskPriority(Task1, 1);
+         ASSERT(OTHER, ret != E_OK);
+
+         ret = ActivateTask(Task1);
+         ASSERT(OTHER, ret != E_OK);
+
+         Sequence(16);
+         /* the preempted Task2 is placed before the ready Task1 */
+         ret = SetTaskPriority(Task2, 1);
+         ASSERT(OTHER, ret != E_OK);
+
+         /* the internal resource Res2 keeps the priority of Task3 while it
+          * is running, Task2 does not preempt it */
+         ret = SetTaskPriority(Task3, 0);
+         ASSERT(OTHER, ret != E_OK);
+
+         Sequence(17);
+         break;
+   }
+
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
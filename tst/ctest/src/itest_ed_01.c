@@ -0,0 +1,247 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the Earliest deadline first scheduling, Test Sequence 1
+ **
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_ed_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_ED Earliest deadline first
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_ED_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_ed_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+/** \brief Increments the EDF_COUNTER
+ **
+ ** \param[in] ticks count of ticks to be incremented
+ **/
+#define AdvanceTime(ticks)                      \
+   do {                                         \
+      uint32f loopi;                            \
+      for (loopi = 0; loopi < (ticks); loopi++) \
+      {                                         \
+         IncAlarmCounter();                     \
+      }                                         \
+   } while(0)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task1 */
+static uint8 Task1Runs = 0;
+
+/** \brief count of executions of Task2 */
+static uint8 Task2Runs = 0;
+
+/** \brief count of executions of Task3 */
+static uint8 Task3Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+
+   Task1Runs++;
+
+   if (1 == Task1Runs)
+   {
+      /* Task1 deadline 100 */
+      Sequence(0);
+      AdvanceTime(90);
+
+      /* Task2 deadline 140, Task1 has an earlier deadline and continues */
+      ret = ActivateTask(Task2);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(1);
+      /* Task3 deadline 110, also later than the deadline of Task1 */
+      ret = ActivateTask(Task3);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(2);
+      /* Task3 is executed before Task2 */
+      TerminateTask();
+   }
+
+   /* Task1 deadline 200 */
+   Sequence(8);
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* Task2 deadline 150 and Task3 deadline 120 have earlier deadlines but
+    * their preemption levels are not higher than the ceiling of Res1 */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(9);
+   /* Task3 and then Task2 are executed */
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(12);
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* Task3 deadline 120, blocked by the ceiling of Res1 */
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   AdvanceTime(100);
+   /* Task2 deadline 250 */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   AdvanceTime(60);
+   /* the second activation of Task3 is queued with its own deadline 280,
+    * later than the deadlines of Task1 and Task2 */
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(13);
+   /* only the first activation of Task3 preempts Task1 */
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(15);
+   /* Task2 and then the queued activation of Task3 are executed */
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Task2Runs++;
+
+   if (1 == Task2Runs)
+   {
+      /* Task2 deadline 140 */
+      Sequence(4);
+      AdvanceTime(10);
+
+      /* Task3 deadline 120 preempts Task2 */
+      ret = ActivateTask(Task3);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(6);
+      /* Task1 deadline 200 */
+      ret = ActivateTask(Task1);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(7);
+   }
+   else if (2 == Task2Runs)
+   {
+      Sequence(11);
+   }
+   else
+   {
+      Sequence(16);
+   }
+
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   Task3Runs++;
+
+   switch(Task3Runs)
+   {
+      case 1:
+         Sequence(3);
+         break;
+      case 2:
+         Sequence(5);
+         break;
+      case 3:
+         Sequence(10);
+         break;
+      case 4:
+         Sequence(14);
+         break;
+      default:
+         Sequence(17);
+
+         /* evaluate conformance tests */
+         ConfTestEvaluation();
+
+         /* finish the conformance test */
+         ConfTestFinish();
+         break;
+   }
+
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,149 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the Event mechanism, Test Sequence 1
+ **
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_em_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_EM Event mechanism
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_EM_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_em_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+
+   Sequence(0);
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(2);
+   ret = SetEvent(Task2, Event2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(3);
+   ret = SetEvent(Task2, Event1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* Task1 is non preemptive, give the cpu to Task2 */
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(6);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+   EventMaskType EventMask;
+
+   Sequence(1);
+   /* no event is set, the task waits */
+   ret = WaitGetClearEvent(Event1, &EventMask);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, EventMask != Event1);
+
+   Sequence(4);
+   /* only the returned events have been cleared */
+   ret = GetEvent(Task2, &EventMask);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, EventMask != Event2);
+
+   /* the event is already set, the task does not wait */
+   ret = WaitGetClearEvent(Event1 | Event2, &EventMask);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, EventMask != Event2);
+
+   ret = GetEvent(Task2, &EventMask);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, EventMask != 0);
+
+   Sequence(5);
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
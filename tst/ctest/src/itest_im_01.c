@@ -0,0 +1,157 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the isr monitor, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_im_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_IM Isr Monitor
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_IM_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_im_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of ISR2 */
+static volatile uint8 Isr2Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   IsrMonitorType monitor;
+
+   Sequence(0);
+   /* a burst of 4 arrivals, MAXBURST is 2 so the third one masks the
+    * source and the fourth one stays pending */
+   TriggerISR2();
+   TriggerISR2();
+   TriggerISR2();
+   TriggerISR2();
+
+   Sequence(2);
+   ASSERT(OTHER, Isr2Runs != 3);
+
+   ret = GetIsrMonitor(ISRID_ISR2, &monitor);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, monitor.Arrivals != 3);
+   ASSERT(OTHER, monitor.MaxBurst != 3);
+   ASSERT(OTHER, monitor.Throttles != 1);
+   ASSERT(OTHER, monitor.MaxExecTime < monitor.ExecTime);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   ret = GetIsrMonitor((ISRType)1, &monitor);
+   ASSERT(OTHER, ret != E_OS_ID);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+
+   /* the pending arrival is executed after the back off time */
+   while (Isr2Runs != 4)
+   {
+      SuspendAllInterrupts();
+      ResumeAllInterrupts();
+   }
+
+   Sequence(3);
+   ret = GetIsrMonitor(ISRID_ISR2, &monitor);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, monitor.Arrivals != 4);
+   ASSERT(OTHER, monitor.Throttles != 1);
+
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sequence(4);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+ISR(ISR2)
+{
+   Isr2Runs++;
+}
+
+void IsrStormHook(ISRType IsrID)
+{
+   Sequence(1);
+   ASSERT(OTHER, IsrID != ISRID_ISR2);
+   ASSERT(OTHER, Isr2Runs != 2);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,202 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the resources shared with isrs, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_ir_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_IR Isr Resources
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_IR_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_ir_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of ISR1 */
+static volatile uint8 Isr1Runs = 0;
+
+/** \brief count of executions of ISR2 */
+static volatile uint8 Isr2Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+
+   Sequence(0);
+   /* Res1 is used by ISR2, taking it masks ISR2 */
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* the ceiling of Res1 is above all tasks, Task2 does not preempt */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   TriggerISR2();
+
+   Sequence(1);
+   /* ISR2 is pending and Task2 is ready */
+   ASSERT(OTHER, Isr2Runs != 0);
+
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   /* ISR1 does not use Res1 and has a higher priority than ISR2, it is not
+    * masked by Res1 */
+   TriggerISR1();
+
+   Sequence(3);
+   ASSERT(OTHER, Isr1Runs != 1);
+   ASSERT(OTHER, Isr2Runs != 0);
+
+   /* resuming the os interrupts does not unmask ISR2 while Res1 is held */
+   SuspendOSInterrupts();
+   ResumeOSInterrupts();
+   ASSERT(OTHER, Isr2Runs != 0);
+
+   /* ISR2 and then Task2 run when Res1 is released */
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(6);
+   ASSERT(OTHER, Isr1Runs != 1);
+   ASSERT(OTHER, Isr2Runs != 1);
+
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Sequence(5);
+   ret = GetResource(Res2);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ReleaseResource(Res2);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   Sequence(7);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+ISR(ISR1)
+{
+   Isr1Runs++;
+
+   Sequence(2);
+}
+
+ISR(ISR2)
+{
+   StatusType ret;
+
+   Isr2Runs++;
+
+   Sequence(4);
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   /* Res1 is already taken by this isr */
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+
+   /* Res2 is only used by tasks */
+   ret = GetResource(Res2);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
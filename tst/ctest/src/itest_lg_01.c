@@ -0,0 +1,159 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the log, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_lg_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_LG Log
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_LG_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_lg_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   LogEntryType entry;
+   uint32 loopi;
+
+   Sequence(0);
+   /* the log is empty */
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+   LogMessage(LogStart, 0, 0, 0);
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(2);
+   /* the messages are read in the order in which they have been logged */
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, entry.Format != LogStart);
+   ASSERT(OTHER, entry.Task != Task1);
+   ASSERT(OTHER, entry.Isr != FALSE);
+   ASSERT(OTHER, entry.Text == NULL);
+   ASSERT(OTHER, entry.Lost != 0);
+
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, entry.Format != LogValues);
+   ASSERT(OTHER, entry.Task != Task2);
+   ASSERT(OTHER, entry.Args[0] != 1);
+   ASSERT(OTHER, entry.Args[1] != 2);
+   ASSERT(OTHER, entry.Args[2] != 3);
+
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+   Sequence(3);
+   /* the log has 8 messages, the 2 oldest are overwritten */
+   for (loopi = 0; loopi < 10; loopi++)
+   {
+      LogMessage(LogValues, loopi, 0, 0);
+   }
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, entry.Args[0] != 2);
+   ASSERT(OTHER, entry.Lost != 2);
+   for (loopi = 3; loopi < 10; loopi++)
+   {
+      ret = ReadLog(&entry);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, entry.Args[0] != loopi);
+      ASSERT(OTHER, entry.Lost != 0);
+   }
+
+   Sequence(4);
+   ret = ReadLog(&entry);
+   ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task2)
+{
+   Sequence(1);
+   LogMessage(LogValues, 1, 2, 3);
+
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
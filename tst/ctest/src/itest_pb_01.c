@@ -0,0 +1,172 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the post build image, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_pb_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PB Post build
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PB_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_pb_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+#include <stdio.h>
+#include <stdlib.h>
+
+/*==================[macros and definitions]=================================*/
+/** \brief File name of the post build image used by this test */
+#define ITEST_PB_01_IMAGE  "itest_pb_01.img"
+
+/*==================[internal data declaration]==============================*/
+/** \brief Header and tasks of the post build image */
+typedef struct {
+   PostBuildHeaderType Header;
+   PostBuildTaskType Tasks[TASKS_COUNT];
+} ImageTasksType;
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task1, it is not reset by RestartOS */
+static uint8 Task1Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   ImageTasksType image;
+   FILE * file;
+   size_t size = 0;
+
+   Task1Runs++;
+
+   if (1 == Task1Runs)
+   {
+      Sequence(0);
+      /* the generated configuration is used, Task2 preempts Task1 */
+      ret = ActivateTask(Task2);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(2);
+      ret = PostBuildSave_Arch(ITEST_PB_01_IMAGE);
+      ASSERT(OTHER, ret != E_OK);
+
+      /* lower the priority of Task2 below the priority of Task1 in the
+       * image */
+      file = fopen(ITEST_PB_01_IMAGE, "r+b");
+      ASSERT(OTHER, file == NULL);
+      if (NULL != file)
+      {
+         size = fread(&image, 1, sizeof(image), file);
+         image.Tasks[Task2].Priority = 0;
+         (void)fseek(file, 0, SEEK_SET);
+         size += fwrite(&image, 1, sizeof(image), file);
+         (void)fclose(file);
+      }
+      ASSERT(OTHER, size != (2 * sizeof(image)));
+
+      /* the image is loaded at the next start of the os */
+      (void)setenv(POST_BUILD_IMAGE_ENV, ITEST_PB_01_IMAGE, 1);
+      RestartOS(AppMode1);
+
+      /* RestartOS shall never return */
+      ASSERT(OTHER, 1);
+   }
+   else
+   {
+      Sequence(3);
+      /* Task2 has a lower priority and does not preempt Task1 */
+      ret = ActivateTask(Task2);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(4);
+      TerminateTask();
+   }
+}
+
+TASK(Task2)
+{
+   if (1 == Task1Runs)
+   {
+      Sequence(1);
+      TerminateTask();
+   }
+   else
+   {
+      Sequence(5);
+      (void)unsetenv(POST_BUILD_IMAGE_ENV);
+      (void)remove(ITEST_PB_01_IMAGE);
+
+      Sequence(6);
+      /* evaluate conformance tests */
+      ConfTestEvaluation();
+
+      /* finish the conformance test */
+      ConfTestFinish();
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
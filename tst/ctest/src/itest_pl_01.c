@@ -0,0 +1,271 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the pipelines, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_pl_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PL Pipeline
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PL_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "Os_Internal.h"   /* include os internal header file */
+#include "itest_pl_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief output buffer of the first frame of Task1 */
+static uint32 * FirstOutput = NULL;
+
+/** \brief count of executions of Task1 */
+static uint8 Task1Runs = 0;
+
+/** \brief count of executions of Task2 */
+static uint8 Task2Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   void * input;
+   void * output;
+   PipelineStatsType stats;
+
+   Task1Runs++;
+   if (Task1Runs == 1)
+   {
+      Sequence(0);
+      ret = GetStageBuffers(Pipeline1, &input, &output);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, input != NULL);
+      ASSERT(OTHER, output == NULL);
+
+      FirstOutput = (uint32 *)output;
+      FirstOutput[0] = 1;
+      FirstOutput[1] = 2;
+
+      Sequence(1);
+      /* Task2 is executed after Task1 has been terminated */
+      ret = ChainStage(Pipeline1);
+      ASSERT(OTHER, 1);
+   }
+   else if (Task1Runs == 2)
+   {
+      /* second frame while Task2 still processes the first one */
+      Sequence(3);
+      ret = GetStageBuffers(Pipeline1, &input, &output);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, output == NULL);
+      ASSERT(OTHER, output == (void *)FirstOutput);
+      ((uint32 *)output)[0] = 3;
+      ((uint32 *)output)[1] = 4;
+
+      Sequence(4);
+      ret = ChainStage(Pipeline1);
+      ASSERT(OTHER, ret != E_OS_LIMIT);
+
+      TerminateTask();
+   }
+   else
+   {
+      /* third frame, an alarm activates Task2 before the hand over */
+      Sequence(8);
+      ret = SetRelAlarm(ActivateStage2, 1, 0);
+      ASSERT(OTHER, ret != E_OK);
+      SuspendAllInterrupts();
+      (void)IncrementCounter(SwCounter, 1);
+      ResumeAllInterrupts();
+
+      /* the frame is dropped, the buffers and the frames are not advanced */
+      ret = ChainStage(Pipeline1);
+      ASSERT(OTHER, ret != E_OS_LIMIT);
+      ret = GetPipelineStats(Pipeline1, Task1, &stats);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, stats.Frames != 1);
+      ASSERT(OTHER, stats.Overruns != 2);
+
+      TerminateTask();
+   }
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+   void * input;
+   void * output;
+   PipelineStatsType stats;
+
+   Task2Runs++;
+   if (Task2Runs != 1)
+   {
+      /* activated by the alarm, the dropped frame has not been handed
+       * over */
+      Sequence(9);
+      ret = GetStageBuffers(Pipeline1, &input, &output);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, input != (void *)FirstOutput);
+
+      TerminateTask();
+   }
+
+   Sequence(2);
+   ret = GetStageBuffers(Pipeline1, &input, &output);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, input != (void *)FirstOutput);
+   ASSERT(OTHER, output == NULL);
+
+   ret = ActivateTask(Task1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   /* the second frame has been written to the other buffer */
+   ASSERT(OTHER, ((uint32 *)input)[0] != 1);
+   ASSERT(OTHER, ((uint32 *)input)[1] != 2);
+
+   ret = GetPipelineStats(Pipeline1, Task1, &stats);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, stats.Frames != 1);
+   ASSERT(OTHER, stats.Overruns != 1);
+   ASSERT(OTHER, stats.MaxLatency < stats.Latency);
+
+   ((uint32 *)output)[0] = ((uint32 *)input)[0] + ((uint32 *)input)[1];
+
+   ret = ChainStage(Pipeline1);
+   ASSERT(OTHER, 1);
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+   void * input;
+   void * output;
+   PipelineStatsType stats;
+
+   Sequence(6);
+   ret = GetStageBuffers(Pipeline1, &input, &output);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, input == NULL);
+   ASSERT(OTHER, output != NULL);
+   ASSERT(OTHER, ((uint32 *)input)[0] != 3);
+
+   ret = GetPipelineStats(Pipeline1, Task2, &stats);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, stats.Frames != 1);
+   ASSERT(OTHER, stats.Overruns != 0);
+   ASSERT(OTHER, stats.FrameLatency < stats.Latency);
+
+   ret = GetPipelineStats(Pipeline1, Task4, &stats);
+   ASSERT(OTHER, ret != E_OS_ID);
+
+   ret = ActivateTask(Task4);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* the last stage is terminated */
+   ret = ChainStage(Pipeline1);
+   ASSERT(OTHER, 1);
+}
+
+TASK(Task4)
+{
+   StatusType ret;
+   void * input;
+   void * output;
+   PipelineStatsType stats;
+
+   Sequence(7);
+   ret = GetPipelineStats(Pipeline1, Task3, &stats);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, stats.Frames != 1);
+
+   /* Task4 is no stage of the pipeline */
+   ret = GetStageBuffers(Pipeline1, &input, &output);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+   ret = ChainStage(Pipeline1);
+   ASSERT(OTHER, ret != E_OS_ACCESS);
+
+#if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED)
+   ret = ChainStage((PipelineType)1);
+   ASSERT(OTHER, ret != E_OS_ID);
+#endif /* #if (CT_ERROR_CHECKING_TYPE == CT_ERROR_CHECKING_EXTENDED) */
+
+   ret = ActivateTask(Task1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(10);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,200 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the ISR1 pending activations and events, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_pn_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PN ISR1 pending
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PN_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_pn_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief action of the next execution of ISR1
+ **
+ ** 0 posts an activation of Task2, 1 posts Event1 to Task3
+ **/
+static volatile uint8 Isr1Action;
+
+/** \brief count of executions of Task2 */
+static volatile uint8 Task2Count;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+
+   Sequence(0);
+   /* the activation posted by ISR1 is not performed in the ISR1 */
+   Isr1Action = 0;
+   TriggerISR1();
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != SUSPENDED);
+   ASSERT(OTHER, Task2Count != 0);
+
+   Sequence(1);
+   /* the activation is performed at the scheduling point */
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(3);
+   ASSERT(OTHER, Task2Count != 1);
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   /* the event posted by ISR1 is set at the scheduling point */
+   Isr1Action = 1;
+   TriggerISR1();
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != WAITING);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(7);
+   /* two activations posted before the scheduling point are merged, no
+    * E_OS_LIMIT is reported for a task with ACTIVATION = 1 */
+   Isr1Action = 0;
+   TriggerISR1();
+   TriggerISR1();
+
+   Sequence(8);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(10);
+   ASSERT(OTHER, Task2Count != 2);
+
+   Sequence(11);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task2)
+{
+   static uint8 Task2_Execution_Number = 0;
+
+   switch(Task2_Execution_Number)
+   {
+      case 0:
+         Sequence(2);
+         break;
+      case 1:
+         Sequence(9);
+         break;
+      default:
+         /* throw an ASSERT */
+         ASSERT(OTHER, 1);
+         break;
+   }
+   Task2_Execution_Number++;
+   Task2Count++;
+
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+
+   Sequence(4);
+   ret = WaitEvent(Event1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(6);
+   ret = ClearEvent(Event1);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+ISR(ISR1)
+{
+   if (0 == Isr1Action)
+   {
+      ActivateTaskFromISR1(Task2);
+   }
+   else
+   {
+      SetEventFromISR1(Task3, Event1);
+   }
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,182 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the ISR1 pending activations and events, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_pn_01.c
+
+/** \brief FreeOSEK Os Implementation Test for the partition windows, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_pt_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PT Partitions
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_PT_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_pt_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+/** \brief Advances the partition windows by one tick and reschedules
+ **
+ ** HWCOUNTER1 is not incremented by any timer interrupt of the test, so
+ ** the window switches are sequenced by the test.
+ **/
+#define AdvanceWindow()                         \
+   do {                                         \
+      SuspendAllInterrupts();                   \
+      (void)IncrementCounter(HWCOUNTER1, 1);    \
+      ResumeAllInterrupts();                    \
+      (void)Schedule();                         \
+   } while(0)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+/* The major frame of 4 ticks of HWCOUNTER1 has the windows:
+ *  - 0 .. 1 PartA (Task2)
+ *  - 2      PartB (Task3)
+ *  - 3      background (Task1) */
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+
+   Sequence(0);
+   /* Task3 has a higher priority but its partition is not active */
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   Sequence(1);
+   /* Task2 of the active partition PartA preempts the background task */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   /* the background window preempted Task3 out of its window */
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+   ret = GetTaskState(Task3, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   /* the major frame starts again with the window of PartA */
+   AdvanceWindow();
+
+   Sequence(7);
+   /* the background task runs in the idle time of PartA */
+   AdvanceWindow();
+
+   Sequence(8);
+   /* the window of PartB starts and Task3 continues */
+   AdvanceWindow();
+
+   Sequence(10);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task2)
+{
+   Sequence(2);
+   /* first tick of the window of PartA, no switch */
+   AdvanceWindow();
+
+   Sequence(3);
+   /* the window of PartB starts, Task3 preempts Task2 */
+   AdvanceWindow();
+
+   Sequence(6);
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+   TaskStateType state;
+
+   Sequence(4);
+   ret = GetTaskState(Task2, &state);
+   ASSERT(OTHER, ret != E_OK);
+   ASSERT(OTHER, state != READY);
+
+   /* the background window starts, Task1 preempts Task3 */
+   AdvanceWindow();
+
+   Sequence(9);
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,183 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the Round robin time slices, Test Sequence 1
+ **
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_rr_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_RR Round robin
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_RR_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_rr_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+/** \brief Increments the ROUND_ROBIN_COUNTER
+ **
+ ** \param[in] ticks count of ticks to be incremented
+ **/
+#define AdvanceTime(ticks)                      \
+   do {                                         \
+      uint32f loopi;                            \
+      for (loopi = 0; loopi < (ticks); loopi++) \
+      {                                         \
+         IncAlarmCounter();                     \
+      }                                         \
+   } while(0)
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task1 */
+static uint8 Task1Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   RoundRobinStatsType stats;
+
+   Task1Runs++;
+
+   if (2 == Task1Runs)
+   {
+      Sequence(8);
+      /* 6 time slices ended, 2 of them with another ready task */
+      ret = GetRoundRobinStats(Task1, &stats);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, stats.Slices != 6);
+      ASSERT(OTHER, stats.Rotations != 2);
+
+      Sequence(9);
+      /* evaluate conformance tests */
+      ConfTestEvaluation();
+
+      /* finish the conformance test */
+      ConfTestFinish();
+   }
+
+   Sequence(0);
+   /* Task2 has the same priority and does not preempt Task1 */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(1);
+   /* 2 of the 3 ticks of the time slice */
+   AdvanceTime(2);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(2);
+   /* the time slice is not consumed while a resource is taken */
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   AdvanceTime(5);
+
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(3);
+   /* the time slice is over, Task1 is moved to the end of the ready list */
+   AdvanceTime(1);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Sequence(4);
+   /* the time slice of Task2 is over */
+   AdvanceTime(3);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(6);
+   /* Task2 is the only ready task with its priority and is not rotated */
+   AdvanceTime(10);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(7);
+   /* Task1 has the same priority and does not preempt Task2 */
+   ret = ActivateTask(Task1);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* the time slice of Task2 is over but no scheduling point follows, Task2
+    * is not rotated and terminates as the first task of its ready list */
+   AdvanceTime(2);
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
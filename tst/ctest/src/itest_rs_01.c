@@ -0,0 +1,182 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the restart of the os, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_rs_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_RS Restart
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_RS_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_rs_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/** \brief count of executions of Task1, it is not reset by RestartOS */
+static uint8 Task1Runs = 0;
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   TaskStateType state;
+   TickType ticks;
+
+   Task1Runs++;
+
+   if (1 == Task1Runs)
+   {
+      Sequence(0);
+      /* leave a ready task, a running alarm, an occupied resource and
+       * suspended interrupts behind */
+      ret = ActivateTask(Task3);
+      ASSERT(OTHER, ret != E_OK);
+
+      ret = SetRelAlarm(Alarm1, 2, 0);
+      ASSERT(OTHER, ret != E_OK);
+
+      IncAlarmCounter();
+
+      ret = GetResource(Res1);
+      ASSERT(OTHER, ret != E_OK);
+
+      SuspendAllInterrupts();
+
+      Sequence(1);
+      RestartOS(AppMode1);
+
+      /* RestartOS shall never return */
+      ASSERT(OTHER, 1);
+   }
+   else
+   {
+      Sequence(2);
+      /* Task3 has not been activated after the restart */
+      ret = GetTaskState(Task3, &state);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, state != SUSPENDED);
+
+      /* Alarm1 is not running after the restart */
+      ret = GetAlarm(Alarm1, &ticks);
+      ASSERT(OTHER, ret != E_OS_NOFUNC);
+
+      /* Res1 is free, Task2 preempts Task1 */
+      ret = ActivateTask(Task2);
+      ASSERT(OTHER, ret != E_OK);
+
+      Sequence(4);
+      /* Alarm1 expires 2 ticks after it has been set */
+      ret = SetRelAlarm(Alarm1, 2, 0);
+      ASSERT(OTHER, ret != E_OK);
+
+      IncAlarmCounter();
+
+      ret = GetTaskState(Task3, &state);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, state != SUSPENDED);
+
+      IncAlarmCounter();
+
+      ret = GetTaskState(Task3, &state);
+      ASSERT(OTHER, ret != E_OK);
+      ASSERT(OTHER, state != READY);
+
+      Sequence(5);
+      TerminateTask();
+   }
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Sequence(3);
+   ret = GetResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ReleaseResource(Res1);
+   ASSERT(OTHER, ret != E_OK);
+
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   Sequence(6);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,169 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the Semaphores, Test Sequence 1
+ **
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_sm_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_SM Semaphores
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_SM_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "itest_sm_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+
+   Sequence(0);
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = ActivateTask(Task3);
+   ASSERT(OTHER, ret != E_OK);
+
+   /* Task1 is non preemptive, Task3 and Task2 wait for the semaphore */
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(3);
+   /* the semaphore is given to the higher priority waiting task */
+   ret = PostSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(5);
+   /* trigger isr 2 */
+   TriggerISR2();
+
+   Sequence(8);
+   ret = Schedule();
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(10);
+   /* no task is waiting, the count is incremented up to MAXVALUE */
+   ret = PostSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OK);
+
+   ret = PostSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OS_LIMIT);
+
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+TASK(Task2)
+{
+   StatusType ret;
+
+   Sequence(2);
+   ret = WaitSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(9);
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   StatusType ret;
+
+   Sequence(1);
+   ret = WaitSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(4);
+   TerminateTask();
+}
+
+ISR(ISR2)
+{
+   StatusType ret;
+
+   Sequence(6);
+   /* Task2 is set to ready, the scheduler is called at the end of the ISR */
+   ret = PostSemaphore(Sem1);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(7);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
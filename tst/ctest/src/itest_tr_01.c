@@ -0,0 +1,286 @@
+/* Copyright 2014 Mariano Cerdeiro
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Implementation Test for the trace, Test Sequence 1
+ ** \file FreeOSEK/Os/tst/ctest/src/itest_tr_01.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT Implementation Test
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_TR Trace
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_IT_TR_01 Test Sequence 1
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"            /* include os header file */
+#include "Os_Internal.h"   /* include os internal header file */
+#include "itest_tr_01.h"   /* include test header file */
+#include "ctest.h"         /* include ctest header file */
+
+/*==================[macros and definitions]=================================*/
+/** \brief Count of user events written to overwrite the ring buffer */
+#define TRACE_FILL_EVENTS  60U
+
+/** \brief Maximal size of a user event, header, time and value */
+#define TRACE_USER_MAX_SIZE   11U
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Get a byte written before the head of the trace
+ **
+ ** \param[in] Back count of bytes before the head, 1 for the last byte
+ ** \return byte of the trace buffer
+ **/
+static uint8 TraceLastByte(uint32 Back);
+
+/** \brief Decode a variable length integer of the trace buffer
+ **
+ ** \param[inout] Position position of the value, returns the position after
+ **                        the value
+ ** \return decoded value
+ **/
+static uint32 TraceValue(uint32 * Position);
+
+/** \brief Check the records between the tail and the head of the trace
+ **
+ ** The records are decoded as trace.pl does. The decoded bytes shall be the
+ ** used bytes and the times of the records shall add up from the time before
+ ** the first record to the time of the last one.
+ **
+ ** \param[out] LastValue value of the last user event
+ ** \return count of records, 0 if the records can not be decoded
+ **/
+static uint32 TraceCheckRecords(uint32 * LastValue);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+const uint32f SequenceCounterOk = MAX_SEQUENCE;
+
+/*==================[internal functions definition]==========================*/
+static uint8 TraceLastByte(uint32 Back)
+{
+   return Osek_Trace.Buffer[(Osek_Trace.Head + OSEK_TRACE_SIZE - Back) % OSEK_TRACE_SIZE];
+}
+
+static uint32 TraceValue(uint32 * Position)
+{
+   uint32 value = 0;
+   uint32 shift = 0;
+   uint8 byte;
+
+   do
+   {
+      byte = Osek_Trace.Buffer[*Position];
+      value |= (uint32)(byte & 0x7FU) << shift;
+      shift += 7;
+      *Position = (*Position + 1) % OSEK_TRACE_SIZE;
+   } while ( (byte & 0x80U) != 0 );
+
+   return value;
+}
+
+static uint32 TraceCheckRecords(uint32 * LastValue)
+{
+   uint32 position = Osek_Trace.Tail;
+   uint32 time = Osek_Trace.TailTime;
+   uint32 count = 0;
+   uint32 bytes = 0;
+   uint32 start;
+   uint32 ids;
+   uint8 type;
+
+   while (bytes < Osek_Trace.Used)
+   {
+      start = position;
+      type = Osek_Trace.Buffer[position] >> 4;
+      position = (position + 1) % OSEK_TRACE_SIZE;
+      time += TraceValue(&position);
+
+      if ( (TRACE_REC_SETEVENT == type) || (TRACE_REC_ERROR == type) )
+      {
+         ids = 2;
+      }
+      else if (TRACE_REC_TRIGGER == type)
+      {
+         ids = 0;
+      }
+      else
+      {
+         ids = 1;
+      }
+      while (ids > 0)
+      {
+         *LastValue = TraceValue(&position);
+         ids--;
+      }
+
+      bytes += (position + OSEK_TRACE_SIZE - start) % OSEK_TRACE_SIZE;
+      count++;
+   }
+
+   if ( (bytes != Osek_Trace.Used) || (position != Osek_Trace.Head) ||
+        (time != Osek_Trace.LastTime) )
+   {
+      count = 0;
+   }
+
+   return count;
+}
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+void ErrorHook(void)
+{
+   Sequence(5);
+   ASSERT(OTHER, OSErrorGetServiceId() != OSServiceId_ActivateTask);
+   /* the error is recorded and triggers the trace before the hook is
+    * called */
+   ASSERT(OTHER, GetTraceState() != TRACE_TRIGGERED);
+}
+
+TASK(Task1)
+{
+   StatusType ret;
+   uint32 events = 0;
+   uint32 value = 0;
+
+   Sequence(0);
+   ASSERT(OTHER, GetTraceState() != TRACE_RECORDING);
+   TraceUserEvent(0, 1);
+
+   Sequence(1);
+   /* the values are stored with 7 bits per byte, the least significant
+    * group first and the most significant bit set if another byte follows */
+   TraceUserEvent(0, 0x7FU);
+   ASSERT(OTHER, TraceLastByte(1) != 0x7FU);
+   ASSERT(OTHER, (TraceLastByte(2) & 0x80U) != 0);
+   TraceUserEvent(0, 0x80U);
+   ASSERT(OTHER, TraceLastByte(2) != 0x80U);
+   ASSERT(OTHER, TraceLastByte(1) != 0x01U);
+   TraceUserEvent(0, 0x4000U);
+   ASSERT(OTHER, TraceLastByte(3) != 0x80U);
+   ASSERT(OTHER, TraceLastByte(2) != 0x80U);
+   ASSERT(OTHER, TraceLastByte(1) != 0x01U);
+   TraceUserEvent(0, 0xFFFFFFFFU);
+   ASSERT(OTHER, TraceLastByte(5) != 0xFFU);
+   ASSERT(OTHER, TraceLastByte(4) != 0xFFU);
+   ASSERT(OTHER, TraceLastByte(3) != 0xFFU);
+   ASSERT(OTHER, TraceLastByte(2) != 0xFFU);
+   ASSERT(OTHER, TraceLastByte(1) != 0x0FU);
+   ASSERT(OTHER, TraceCheckRecords(&value) == 0);
+   ASSERT(OTHER, value != 0xFFFFFFFFU);
+
+   Sequence(2);
+   /* the ring overwrites the oldest records, each user event needs at
+    * least 3 bytes */
+   for (events = 0; events < TRACE_FILL_EVENTS; events++)
+   {
+      TraceUserEvent(2, events);
+   }
+   ASSERT(OTHER, GetTraceState() != TRACE_RECORDING);
+   ASSERT(OTHER, Osek_Trace.Used > OSEK_TRACE_SIZE);
+   ASSERT(OTHER, (Osek_Trace.Used + TRACE_USER_MAX_SIZE) <= OSEK_TRACE_SIZE);
+   /* the dropped records are removed as a whole, the time and the running
+    * task before the first record left are kept */
+   ASSERT(OTHER, TraceCheckRecords(&value) == 0);
+   ASSERT(OTHER, value != (TRACE_FILL_EVENTS - 1U));
+   ASSERT(OTHER, Osek_Trace.Buffer[Osek_Trace.Tail] != ((TRACE_REC_USER << 4) | 2U));
+   ASSERT(OTHER, Osek_Trace.TailTask != Task1);
+   events = 0;
+
+   Sequence(3);
+   /* Task2 has a lower priority and is only activated */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OK);
+
+   Sequence(4);
+   /* a second activation is not allowed and calls the ErrorHook */
+   ret = ActivateTask(Task2);
+   ASSERT(OTHER, ret != E_OS_LIMIT);
+
+   Sequence(6);
+   ASSERT(OTHER, GetTraceState() != TRACE_TRIGGERED);
+
+   /* the trace stops after TRACEPOSTTRIGGER bytes, each user event needs
+    * between 3 and 16 bytes */
+   while ( (TRACE_STOPPED != GetTraceState()) && (events < 100) )
+   {
+      TraceUserEvent(1, events);
+      events++;
+   }
+   ASSERT(OTHER, (events < 2) || (events > 11));
+
+   Sequence(7);
+   /* a stopped trace is not triggered again */
+   TraceTrigger();
+   ASSERT(OTHER, GetTraceState() != TRACE_STOPPED);
+
+   Sequence(8);
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sequence(9);
+   /* evaluate conformance tests */
+   ConfTestEvaluation();
+
+   /* finish the conformance test */
+   ConfTestFinish();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
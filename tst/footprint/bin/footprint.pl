@@ -0,0 +1,353 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Footprint report
+#
+# Reports the RAM and ROM used by each kernel object of the configuration
+# and the code of the kernel, and checks them against the budgets of the
+# configuration. The symbols of each object are taken from the map
+# generated with the configuration (Os_Footprint.csv), their sizes from the
+# linked image. The data with initial values counts in RAM and in ROM.
+#
+# If the objects or the library of the kernel are given the code of the
+# kernel is the code of these objects which has been linked in the image,
+# and the kernel data not generated for an object is reported apart.
+#
+# The tool exits with an error if a budget is exceeded, so it can be called
+# after the link to fail the build. For a cross build the nm of the
+# toolchain has to be given.
+#
+# Usage:
+#    make footprint PROJECT_PATH=<project>
+# or
+#    perl modules/rtos/tst/footprint/bin/footprint.pl -m <gen dir>/etc/Os_Footprint.csv
+#         [-k <kernel library or objects>] [-n <nm>] [-c <csv file>]
+#         [-j <json file>] image.elf
+#
+
+$errors = 0;
+
+# entries of the map: type, object, symbol and share
+@Map = ();
+%Budgets = ();
+# size and type of the symbols of the image
+%Symbols = ();
+# footprint of each object, in order of the map
+@Objects = ();
+%Footprint = ();
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Read the footprint map of the configuration
+#
+# \param[in] file footprint map
+#*
+sub ReadMap
+{
+   my $file = shift;
+
+   open MAP, "<$file" or die "Map $file can not be opened: $!";
+   while (my $line = <MAP>)
+   {
+      $line =~ tr/\r\n//d;
+      if ( ($line ne "") && ($line !~ /^#/) )
+      {
+         my @fields = split(/,/, $line);
+         if ($fields[0] eq "BUDGET")
+         {
+            $Budgets{$fields[1]} = $fields[2];
+         }
+         else
+         {
+            push(@Map, [ $fields[0], $fields[1], $fields[2], ($fields[3] ne "") ? $fields[3] : 1 ]);
+         }
+      }
+   }
+   close MAP;
+}
+
+#** \brief Read the defined symbols of a file with nm
+#
+# \param[in] file image, object or library
+# \return reference to a hash with the size and the type of each symbol
+#*
+sub ReadSymbols
+{
+   my $file = shift;
+   my %ret = ();
+
+   open NM, "$nm -S --defined-only $file |" or die "$nm can not be executed: $!";
+   while (my $line = <NM>)
+   {
+      if ($line =~ /^[0-9a-fA-F]+ ([0-9a-fA-F]+) (\w) (\S+)$/)
+      {
+         $ret{$3} = [ hex($1), $2 ];
+      }
+   }
+   close NM;
+   if ($? != 0)
+   {
+      error("$nm failed for $file");
+   }
+
+   return \%ret;
+}
+
+#** \brief Get the memory used by a symbol
+#
+# \param[in] type nm type of the symbol
+# \return RAM and ROM used by each byte of the symbol
+#*
+sub Memory
+{
+   my $type = uc(shift);
+
+   if ($type =~ /^[BSC]$/)
+   {
+      return (1, 0);
+   }
+   elsif ($type =~ /^[DGV]$/)
+   {
+      # initialized data is copied from ROM at startup
+      return (1, 1);
+   }
+   elsif ($type =~ /^[RTW]$/)
+   {
+      return (0, 1);
+   }
+
+   return (0, 0);
+}
+
+#** \brief Add memory to the footprint of an object
+#*
+sub Add
+{
+   my ($type, $object, $ram, $rom) = @_;
+   my $key = "$type,$object";
+
+   if (!exists($Footprint{$key}))
+   {
+      $Footprint{$key} = [ 0, 0 ];
+      push(@Objects, [ $type, $object ]);
+   }
+   $Footprint{$key}->[0] += $ram;
+   $Footprint{$key}->[1] += $rom;
+}
+
+$mapfile = "";
+$nm = "nm";
+$csvfile = "";
+$jsonfile = "";
+@kernel = ();
+while ( ($#ARGV >= 0) && ($ARGV[0] =~ /^-/) )
+{
+   $opt = shift(@ARGV);
+   if ($opt eq "-m")
+   {
+      $mapfile = shift(@ARGV);
+   }
+   elsif ($opt eq "-k")
+   {
+      push(@kernel, shift(@ARGV));
+   }
+   elsif ($opt eq "-n")
+   {
+      $nm = shift(@ARGV);
+   }
+   elsif ($opt eq "-c")
+   {
+      $csvfile = shift(@ARGV);
+   }
+   elsif ($opt eq "-j")
+   {
+      $jsonfile = shift(@ARGV);
+   }
+}
+
+if ( ($#ARGV != 0) || ($mapfile eq "") )
+{
+   print "footprint.pl -m <footprint map> [-k <kernel library or objects>] [-n <nm>] [-c <csv file>] [-j <json file>] image.elf\n";
+   exit(1);
+}
+
+ReadMap($mapfile);
+%Symbols = %{ReadSymbols($ARGV[0])};
+
+# resolve the symbols of the map, the * at the end matches all the symbols
+# starting with it
+@entries = ();
+%shares = ();
+%assigned = ();
+foreach $entry (@Map)
+{
+   my ($type, $object, $symbol, $share) = @$entry;
+   my @names = ();
+
+   if ($symbol =~ /^(.*)\*$/)
+   {
+      my $prefix = $1;
+      @names = sort(grep { index($_, $prefix) == 0 } keys(%Symbols));
+   }
+   elsif (exists($Symbols{$symbol}))
+   {
+      @names = ( $symbol );
+   }
+
+   foreach $name (@names)
+   {
+      push(@entries, [ $type, ($object eq "*") ? $name : $object, $name, $share ]);
+      $shares{$name} += $share;
+      $assigned{$name} = 1;
+   }
+}
+
+foreach $entry (@entries)
+{
+   my ($type, $object, $name, $share) = @$entry;
+   my ($size, $symtype) = @{$Symbols{$name}};
+   my ($ram, $rom) = Memory($symtype);
+
+   $size = $size * $share / $shares{$name};
+   Add($type, $object, $ram * $size, $rom * $size);
+}
+
+# code and remaining data of the kernel linked in the image
+$code = -1;
+if ($#kernel >= 0)
+{
+   my %done = ();
+
+   $code = 0;
+   foreach $file (@kernel)
+   {
+      my %kernelsymbols = %{ReadSymbols($file)};
+      foreach $name (keys(%kernelsymbols))
+      {
+         if ( (exists($Symbols{$name})) && (!exists($done{$name})) &&
+              (!exists($assigned{$name})) )
+         {
+            my ($size, $symtype) = @{$Symbols{$name}};
+            my ($ram, $rom) = Memory($symtype);
+
+            $done{$name} = 1;
+            if ($symtype =~ /^[TtWw]$/)
+            {
+               $code += $size;
+            }
+            else
+            {
+               Add("KERNEL", "other", $ram * $size, $rom * $size);
+            }
+         }
+      }
+   }
+}
+
+$ramtotal = 0;
+$romtotal = 0;
+printf("%-12s %-24s %10s %10s\n", "type", "object", "RAM", "ROM");
+foreach $object (@Objects)
+{
+   my ($ram, $rom) = @{$Footprint{$object->[0] . "," . $object->[1]}};
+
+   $ram = int($ram + 0.5);
+   $rom = int($rom + 0.5);
+   $Footprint{$object->[0] . "," . $object->[1]} = [ $ram, $rom ];
+   $ramtotal += $ram;
+   $romtotal += $rom;
+   printf("%-12s %-24s %10u %10u\n", $object->[0], $object->[1], $ram, $rom);
+}
+printf("%-37s %10u %10u\n", "total", $ramtotal, $romtotal);
+if ($code >= 0)
+{
+   printf("%-37s %10s %10u\n", "kernel code", "", $code);
+}
+
+%totals = ( "RAM" => $ramtotal, "ROM" => $romtotal, "CODE" => $code );
+foreach $memory (sort(keys(%Budgets)))
+{
+   if ($totals{$memory} < 0)
+   {
+      error("the budget of $memory can not be checked without the kernel objects");
+   }
+   elsif ($totals{$memory} > $Budgets{$memory})
+   {
+      error("$memory of the kernel is $totals{$memory} bytes, the budget is $Budgets{$memory} bytes");
+   }
+   else
+   {
+      print "$memory $totals{$memory} of $Budgets{$memory} bytes\n";
+   }
+}
+
+if ($csvfile ne "")
+{
+   open CSV, ">$csvfile" or die "$csvfile can not be opened: $!";
+   print CSV "type,object,ram,rom\n";
+   foreach $object (@Objects)
+   {
+      my ($ram, $rom) = @{$Footprint{$object->[0] . "," . $object->[1]}};
+      print CSV "$object->[0],$object->[1],$ram,$rom\n";
+   }
+   print CSV "TOTAL,data,$ramtotal,$romtotal\n";
+   if ($code >= 0)
+   {
+      print CSV "TOTAL,code,0,$code\n";
+   }
+   close CSV;
+}
+
+if ($jsonfile ne "")
+{
+   my @items = ();
+
+   foreach $object (@Objects)
+   {
+      my ($ram, $rom) = @{$Footprint{$object->[0] . "," . $object->[1]}};
+      push(@items, "    { \"type\": \"$object->[0]\", \"object\": \"$object->[1]\", \"ram\": $ram, \"rom\": $rom }");
+   }
+   open JSON, ">$jsonfile" or die "$jsonfile can not be opened: $!";
+   print JSON "{\n  \"objects\": [\n" . join(",\n", @items) . "\n  ],\n";
+   print JSON "  \"total\": { \"ram\": $ramtotal, \"rom\": $romtotal" .
+              (($code >= 0) ? ", \"code\": $code" : "") . " },\n";
+   print JSON "  \"budget\": { " .
+              join(", ", map { "\"" . lc($_) . "\": $Budgets{$_}" } sort(keys(%Budgets))) .
+              " }\n}\n";
+   close JSON;
+}
+
+exit($errors > 0 ? 1 : 0);
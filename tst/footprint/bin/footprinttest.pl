@@ -0,0 +1,261 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Footprint report test
+#
+# Builds a small image with known symbol sizes and a kernel library with one
+# linked and one unused object, evaluates it with footprint.pl and compares
+# the report, the CSV and the JSON with the expected ones. The budgets are
+# checked once with the exact totals and once with a RAM budget one byte
+# too small, which shall fail.
+#
+# The image is built with the gcc of the host when the test is run.
+#
+# Usage:
+#    perl modules/rtos/tst/footprint/bin/footprinttest.pl [-g <gcc>]
+#
+
+use File::Basename;
+use File::Temp qw(tempdir);
+
+$errors = 0;
+
+# symbols of the configuration: TaskA has 100 bytes of bss, 16 bytes of
+# initialized data and 2/3 of the 24 bytes of TasksConst, TaskB gets the
+# other 1/3. Each Alarm_ symbol is an object on its own.
+$Image = <<'END';
+unsigned char TaskA_Stack[100];
+unsigned int TaskA_Data[4] = { 1, 2, 3, 4 };
+const unsigned char TasksConst[24] = { 1 };
+unsigned char Alarm_X[8];
+extern void KernelCode(void);
+int main(int argc, char ** argv)
+{
+   if (argc > 100)
+   {
+      KernelCode();
+   }
+   return 0;
+}
+END
+
+# kernel object which is linked: 40 bytes of code, 20 bytes of data not
+# owned by an object and Alarm_Y, which is owned by its object only
+$KernelUsed = <<'END';
+unsigned int KernelVar[5];
+unsigned char Alarm_Y[12];
+__asm__ (".text\n"
+         ".globl KernelCode\n"
+         ".type KernelCode, %function\n"
+         "KernelCode:\n"
+         ".fill 40, 1, 0\n"
+         ".size KernelCode, 40\n");
+END
+
+# kernel object which is not referenced and therefore not linked
+$KernelUnused = <<'END';
+unsigned int KernelUnusedVar[7];
+void KernelUnused(void)
+{
+   KernelUnusedVar[0]++;
+}
+END
+
+$Map = <<'END';
+# <type>,<object>,<symbol>,<share>
+TASK,TaskA,TaskA_Stack,
+TASK,TaskA,TaskA_Data,
+TASK,TaskA,TasksConst,2
+TASK,TaskB,TasksConst,1
+TASK,TaskB,TaskB_Missing,
+ALARM,*,Alarm_*,
+END
+
+# expected footprint: type, object, RAM and ROM
+@Expected = (
+   [ "TASK", "TaskA", 116, 32 ],
+   [ "TASK", "TaskB", 0, 8 ],
+   [ "ALARM", "Alarm_X", 8, 0 ],
+   [ "ALARM", "Alarm_Y", 12, 0 ],
+   [ "KERNEL", "other", 20, 0 ]
+);
+$RAM = 156;
+$ROM = 40;
+$CODE = 40;
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Write a file
+#
+# \param[in] file file name
+# \param[in] text content of the file
+#*
+sub WriteFile
+{
+   my ($file, $text) = @_;
+
+   open FILE, ">$file" or die "$file can not be opened: $!";
+   print FILE $text;
+   close FILE;
+}
+
+#** \brief Read a file
+#
+# \param[in] file file name
+# \return list of the lines of the file
+#*
+sub ReadFile
+{
+   my $file = shift;
+   my @lines = ();
+
+   if (open FILE, "<$file")
+   {
+      @lines = <FILE>;
+      close FILE;
+      chomp(@lines);
+   }
+   else
+   {
+      error("$file has not been written");
+   }
+
+   return @lines;
+}
+
+#** \brief Compare two lists of lines
+#
+# \param[in] name name of the output
+# \param[in] output reference to the lines of the output
+# \param[in] expected reference to the expected lines
+#*
+sub Compare
+{
+   my ($name, $output, $expected) = @_;
+
+   for (my $loopi = 0; $loopi < @$expected; $loopi++)
+   {
+      if ($output->[$loopi] ne $expected->[$loopi])
+      {
+         error("$name: line $loopi is \"$output->[$loopi]\" instead of \"$expected->[$loopi]\"");
+      }
+   }
+   if (@$output != @$expected)
+   {
+      error("$name: " . scalar(@$output) . " lines instead of " . scalar(@$expected));
+   }
+}
+
+#** \brief Run footprint.pl with the budgets
+#
+# \param[in] dir directory of the image
+# \param[in] ram RAM budget
+# \return exit status and the lines of the output
+#*
+sub Run
+{
+   my ($dir, $ram) = @_;
+   my @output;
+
+   WriteFile("$dir/Os_Footprint.csv",
+      $Map . "BUDGET,RAM,$ram\nBUDGET,ROM,$ROM\nBUDGET,CODE,$CODE\n");
+   @output = `perl "@{[dirname(__FILE__)]}/footprint.pl" -m "$dir/Os_Footprint.csv" -k "$dir/kernel.a" -c "$dir/footprint.csv" -j "$dir/footprint.json" "$dir/image.elf"`;
+   chomp(@output);
+
+   return ($? >> 8, @output);
+}
+
+$gcc = "gcc";
+while ( ($#ARGV >= 0) && ($ARGV[0] =~ /^-/) )
+{
+   $opt = shift(@ARGV);
+   if ($opt eq "-g")
+   {
+      $gcc = shift(@ARGV);
+   }
+}
+
+$dir = tempdir(CLEANUP => 1);
+WriteFile("$dir/image.c", $Image);
+WriteFile("$dir/used.c", $KernelUsed);
+WriteFile("$dir/unused.c", $KernelUnused);
+system("$gcc -O0 -fno-common -c \"$dir/used.c\" -o \"$dir/used.o\"") == 0 or die "$gcc failed";
+system("$gcc -O0 -fno-common -c \"$dir/unused.c\" -o \"$dir/unused.o\"") == 0 or die "$gcc failed";
+system("ar rcs \"$dir/kernel.a\" \"$dir/used.o\" \"$dir/unused.o\"") == 0 or die "ar failed";
+system("$gcc -O0 -fno-common \"$dir/image.c\" \"$dir/kernel.a\" -o \"$dir/image.elf\"") == 0 or die "$gcc failed";
+
+# budgets equal to the totals
+@expected = ( sprintf("%-12s %-24s %10s %10s", "type", "object", "RAM", "ROM") );
+@csv = ( "type,object,ram,rom" );
+@json = ( "{", "  \"objects\": [" );
+foreach $object (@Expected)
+{
+   push(@expected, sprintf("%-12s %-24s %10u %10u", @$object));
+   push(@csv, join(",", @$object));
+   push(@json, "    { \"type\": \"$object->[0]\", \"object\": \"$object->[1]\", \"ram\": $object->[2], \"rom\": $object->[3] }" .
+      (($object == $Expected[-1]) ? "" : ","));
+}
+push(@expected, sprintf("%-37s %10u %10u", "total", $RAM, $ROM));
+push(@expected, sprintf("%-37s %10s %10u", "kernel code", "", $CODE));
+push(@expected, "CODE $CODE of $CODE bytes", "RAM $RAM of $RAM bytes", "ROM $ROM of $ROM bytes");
+push(@csv, "TOTAL,data,$RAM,$ROM", "TOTAL,code,0,$CODE");
+push(@json, "  ],", "  \"total\": { \"ram\": $RAM, \"rom\": $ROM, \"code\": $CODE },",
+   "  \"budget\": { \"code\": $CODE, \"ram\": $RAM, \"rom\": $ROM }", "}");
+
+($status, @output) = Run($dir, $RAM);
+if ($status != 0)
+{
+   error("footprint.pl failed within the budgets");
+}
+Compare("report", \@output, \@expected);
+@output = ReadFile("$dir/footprint.csv");
+Compare("csv", \@output, \@csv);
+@output = ReadFile("$dir/footprint.json");
+Compare("json", \@output, \@json);
+
+# RAM budget exceeded by one byte
+($status, @output) = Run($dir, $RAM - 1);
+if ($status == 0)
+{
+   error("footprint.pl did not fail with the RAM budget exceeded");
+}
+if (!grep { $_ eq "ERROR RAM of the kernel is $RAM bytes, the budget is " . ($RAM - 1) . " bytes" } @output)
+{
+   error("the exceeded RAM budget is not reported");
+}
+
+print (($errors > 0) ? "footprinttest: $errors errors\n" : "footprinttest: OK\n");
+exit($errors > 0 ? 1 : 0);
@@ -0,0 +1,258 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Log decoder
+#
+# Decodes the messages of the log and prints them formatted in the order in
+# which they have been logged. The log is a memory dump of the variable
+# Osek_Log, on x86 it can be written with LogSave_Arch, on other targets it
+# can be dumped with the debugger, for example with gdb:
+#    dump binary value log.bin Osek_Log
+#
+# The format strings are taken from the LOGFORMATs of the OIL file, the ids
+# of the formats are given by their order in the file. If the generated
+# include directory is given the tasks are printed with the names of the
+# configuration.
+#
+# Usage:
+#    perl modules/rtos/tst/log/bin/log.pl -o <oil file> [-g <gen inc dir>] [-f <Hz>] log.bin
+#
+
+$errors = 0;
+
+# contexts, see CONTEXT_* in Os_Internal.h
+@Contexts = ( "", "", "isr1", "isr2", "sys", "dbg" );
+
+@Formats = ();
+%TaskNames = ();
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Read the formats of the OIL file
+#
+# \param[in] file OIL file
+#*
+sub ReadFormats
+{
+   my $file = shift;
+   my $oil;
+
+   if (open OIL, "<$file")
+   {
+      local $/;
+      $oil = <OIL>;
+      close OIL;
+
+      # remove the comments before looking for the objects
+      $oil =~ s/\/\*.*?\*\///gs;
+      $oil =~ s/\/\/[^\n]*//g;
+      while ($oil =~ /\bLOGFORMAT\s+(\w+)\s*\{(.*?)\}\s*;/gs)
+      {
+         my ($name, $body) = ($1, $2);
+         if ($body =~ /\bFORMAT\s*=\s*"((?:[^"\\]|\\.)*)"/s)
+         {
+            my $format = $1;
+            $format =~ s/\\n/\n/g;
+            $format =~ s/\\t/\t/g;
+            $format =~ s/\\"/"/g;
+            $format =~ s/\\\\/\\/g;
+            push(@Formats, $format);
+         }
+         else
+         {
+            error("LOGFORMAT $name has no FORMAT");
+            push(@Formats, "$name %u %u %u");
+         }
+      }
+   }
+   else
+   {
+      error("$file can not be opened: $!");
+   }
+}
+
+#** \brief Read the names of the tasks of the configuration
+#
+# \param[in] dir directory of the generated include files
+#*
+sub ReadNames
+{
+   my $dir = shift;
+   my $comment = "";
+
+   if (open CFG, "<$dir/Os_Cfg.h")
+   {
+      while (my $line = <CFG>)
+      {
+         if ( ($line =~ /^#define (\w+) (\d+)$/) &&
+              ($comment =~ /Task Definition/) )
+         {
+            $TaskNames{$2} = $1;
+         }
+         $comment = $line;
+      }
+      close CFG;
+   }
+   else
+   {
+      error("$dir/Os_Cfg.h can not be opened: $!");
+   }
+}
+
+sub TaskName
+{
+   my $task = shift;
+
+   if ($task == 255)
+   {
+      return "-";
+   }
+   return exists($TaskNames{$task}) ? $TaskNames{$task} : $task;
+}
+
+$oilfile = "";
+$gendir = "";
+$frequency = 0;
+while ( ($#ARGV >= 0) && ($ARGV[0] =~ /^-/) )
+{
+   $opt = shift(@ARGV);
+   if ($opt eq "-o")
+   {
+      $oilfile = shift(@ARGV);
+   }
+   elsif ($opt eq "-g")
+   {
+      $gendir = shift(@ARGV);
+   }
+   elsif ($opt eq "-f")
+   {
+      $frequency = shift(@ARGV);
+   }
+}
+
+if ( ($#ARGV != 0) || ($oilfile eq "") )
+{
+   print "log.pl -o <oil file> [-g <gen inc dir>] [-f <Hz>] log.bin\n";
+   exit(1);
+}
+
+ReadFormats($oilfile);
+if ($gendir ne "")
+{
+   ReadNames($gendir);
+}
+
+open LOG, "<$ARGV[0]" or die "Log $ARGV[0] can not be opened: $!";
+binmode LOG;
+local $/;
+$image = <LOG>;
+close LOG;
+
+# the magic is "OSLG" stored in the byte order of the target
+if (unpack("V", $image) == 0x474C534F)
+{
+   ($u32, $u16) = ("V", "v");
+}
+elsif (unpack("N", $image) == 0x474C534F)
+{
+   ($u32, $u16) = ("N", "n");
+}
+else
+{
+   die "$ARGV[0] is not a log";
+}
+
+# header, see LogType in Os_Internal.h
+($magic, $version, $logfrequency, $size, $head, $tail, $lost) =
+   unpack("${u32}Cx3${u32}5", $image);
+if ($version != 1)
+{
+   die "log version $version is not supported";
+}
+if ($frequency == 0)
+{
+   $frequency = $logfrequency;
+}
+
+# records of 24 bytes, see LogRecordType in Os_Internal.h
+@records = ();
+for ($loopi = 0; $loopi < $size; $loopi++)
+{
+   my %rec;
+   ($rec{seq}, $rec{time}, $rec{format}, $rec{task}, $rec{context}, @{$rec{args}}) =
+      unpack("${u32}2${u16}CC${u32}3", substr($image, 28 + $loopi * 24, 24));
+
+   # only the messages of the last lap are complete
+   my $age = ($head - $rec{seq}) & 0xFFFFFFFF;
+   if ( ($rec{seq} != 0) && ($age < $size) )
+   {
+      $rec{age} = $age;
+      push(@records, \%rec);
+   }
+}
+@records = sort { $b->{age} <=> $a->{age} } @records;
+
+printf("%u messages logged, %u read, %u in the log, %u lost before the last read\n",
+   $head, $tail, scalar(@records), $lost);
+
+$origin = @records ? $records[0]->{time} : 0;
+foreach $rec (@records)
+{
+   my $text;
+   my $pos = ($rec->{seq} - 1) & 0xFFFFFFFF;
+
+   if ($rec->{format} <= $#Formats)
+   {
+      $text = sprintf($Formats[$rec->{format}], @{$rec->{args}});
+   }
+   else
+   {
+      $text = "unknown format " . $rec->{format} . ": " . join(" ", @{$rec->{args}});
+   }
+
+   if ($frequency != 0)
+   {
+      printf("%14.3f", ((($rec->{time} - $origin) & 0xFFFFFFFF) * 1000000 / $frequency));
+   }
+   else
+   {
+      printf("%14s", "-");
+   }
+   printf(" %s %-12s %-4s %s\n", ( ( ($pos - $tail) & 0xFFFFFFFF) < $size) ? " " : "r",
+      TaskName($rec->{task}), $Contexts[$rec->{context}], $text);
+}
+
+exit($errors > 0 ? 1 : 0);
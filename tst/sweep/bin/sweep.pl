@@ -0,0 +1,587 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# Simulation sweep runner
+#
+# Builds the sweep model once for x86 with POSTBUILD = TRUE, runs it for
+# each combination of the parameters given in the configuration file in
+# parallel on all the cores of the host and reports the Pareto-best
+# variants.
+#
+# The model runs in virtual time, the results do not depend on the load of
+# the host. The priorities of the tasks are set by a post build image for
+# each variant, the other parameters are passed to the model as environment
+# variables.
+#
+# Usage (from the root of the firmware):
+#    perl modules/rtos/tst/sweep/bin/sweep.pl -f modules/rtos/tst/sweep/cfg/sweep.cfg [-o model.oil]
+#
+
+use feature "switch";
+use File::Copy;
+use File::Basename;
+use File::Path;
+
+$errors = 0;
+$warnings = 0;
+$JOBS = 0;
+$TIMEOUT = 60;
+$OUT = "out/rtos/sweep";
+$OIL = "";
+@params = ();
+%taskparams = ();
+
+#Hide experimental warning (given/when)
+no if $] >= 5.018, warnings => "experimental::smartmatch";
+
+sub readparam
+{
+   open CFG, "<@_[0]" or die "Config file @_[0] can not be opened: $!";
+   while (my $line = <CFG>)
+   {
+      chomp($line);
+      # removes carry return + line-feed
+      $line =~ tr/\r\n//d;
+      # Skips empty lines and starting with # (comments)
+      if ($line ne "" && substr($line, 0, 1) !~ /^\#/)
+      {
+         ($var,$val,$range) = split(/:/,$line);
+         given ($var)
+         {
+            when ("BINDIR") { $BINDIR = $val; }
+            when ("ARCH") { $ARCH = $val; }
+            when ("JOBS") { $JOBS = $val; }
+            when ("TIMEOUT") { $TIMEOUT = $val; }
+            when ("OUT") { $OUT = $val; }
+            when ("MODEL") { $MODEL = $val; }
+            when ("OIL") { $OIL = $val; }
+            when ("LOG") { $logfile = $val; }
+            when ("PARAM") { push(@params, [ $val, GetValues($range) ]); }
+            default { }
+         }
+      }
+   }
+   close CFG;
+}
+
+#** \brief Get the values of a parameter
+#
+# \param[in] range comma separated list of values, each one is a number or a
+#            range with the format <from>..<to> or <from>..<to>/<step>
+# \return list of values
+#*
+sub GetValues
+{
+   my @ret = ();
+
+   foreach my $item (split(/,/, @_[0]))
+   {
+      if ($item =~ /^(\d+)\.\.(\d+)(\/(\d+))?$/)
+      {
+         my $step = ($4 ne "") ? $4 : 1;
+         for (my $val = $1; $val <= $2; $val += $step)
+         {
+            push(@ret, $val);
+         }
+      }
+      else
+      {
+         push(@ret, $item);
+      }
+   }
+
+   return @ret;
+}
+
+#** \brief Get all combinations of the parameters
+#
+# \return list of variants, each variant is a reference to a hash with the
+#         value of each parameter
+#*
+sub GetVariants
+{
+   my @ret = ( {} );
+
+   foreach my $param (@params)
+   {
+      my ($name, @values) = @$param;
+      my @tmp = ();
+      foreach my $variant (@ret)
+      {
+         foreach my $val (@values)
+         {
+            my %new = %$variant;
+            $new{$name} = $val;
+            push(@tmp, \%new);
+         }
+      }
+      @ret = @tmp;
+   }
+
+   return @ret;
+}
+
+sub info
+{
+   print "INFO: " . @_[0] . "\n";
+   logf("INFO: " . @_[0]);
+}
+
+sub warning
+{
+   print "WARNING: " . @_[0] . "\n";
+   logf("WARNING: " . @_[0]);
+   $warnings++;
+}
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   logf("ERROR: " . @_[0]);
+   $errors++;
+}
+
+sub logf
+{
+   ($sec,$min,$hour,$mday,$mon,$year,$wday,$yday,$isdst)=localtime(time);
+   printf LOGFILE "%02d-%02d-%04d %02d:%02d:%02d ",$mday,$mon+1,$year+1900,$hour,$min,$sec;
+   printf LOGFILE "%s\n",@_[0];
+}
+
+sub finish
+{
+   info("Warnings: $warnings - Errors: $errors");
+   close(LOGFILE);
+   if ($errors > 0)
+   {
+      exit(1);
+   }
+   exit(0);
+}
+
+#** \brief Get the parameters used as task priorities
+#
+# Fills %taskparams with the name of the parameter used as PRIORITY of each
+# task of the OIL file. The other parameters shall not be used in the OIL
+# file, they would need a build for each variant.
+#*
+sub GetTaskParams
+{
+   my $task = "";
+
+   open ORG, "<$OIL" or die "$OIL can not be opened: $!";
+   while (my $line = <ORG>)
+   {
+      if ($line =~ /^\s*TASK\s+(\w+)/)
+      {
+         $task = $1;
+      }
+      foreach my $param (@params)
+      {
+         my $name = $param->[0];
+         if ( ($task ne "") && ($line =~ /^\s*PRIORITY\s*=\s*$name\s*;/) )
+         {
+            $taskparams{$task} = $name;
+         }
+         elsif ($line =~ /\b$name\b/)
+         {
+            error("parameter $name can only be used as PRIORITY of a task in $OIL");
+         }
+      }
+   }
+   close(ORG);
+}
+
+#** \brief Creates the project of the model
+#
+# The priority parameters are replaced by their highest value, the post
+# build images can only use priorities up to the highest one of the OIL
+# file.
+#*
+sub CreateProject
+{
+   my $base = "$OUT/build";
+   my %max = ();
+
+   `mkdir -p $base/etc`;
+   `mkdir -p $base/mak`;
+
+   foreach my $param (@params)
+   {
+      my ($name, @values) = @$param;
+      $max{$name} = (sort { $b <=> $a } @values)[0];
+   }
+
+   open ORG, "<$OIL" or die "$OIL can not be opened: $!";
+   open DST, ">$base/etc/sweep.oil" or die "$base/etc/sweep.oil can not be opened: $!";
+   while (my $line = <ORG>)
+   {
+      foreach my $name (values %taskparams)
+      {
+         $line =~ s/\b$name\b/$max{$name}/g;
+      }
+      print DST $line;
+   }
+   close(DST);
+   close(ORG);
+
+   # create makefile for this project
+   open FILE, "> $base/mak/Makefile" or die "can not open: $!";
+   print FILE "PROJECT_NAME = sweep\n\n";
+   print FILE "\$(PROJECT_NAME)_SRC_PATH += $MODEL\$(DS)src\$(DS)\n\n";
+   print FILE "INC_FILES += $MODEL\$(DS)inc\n\n";
+   print FILE "SRC_FILES += $MODEL\$(DS)src\$(DS)sweep.c\n\n";
+   print FILE "OIL_FILES += \$(PROJECT_PATH)\$(DS)etc\$(DS)\$(PROJECT_NAME).oil\n\n";
+   print FILE "MODS = modules\$(DS)drivers \\\n";
+   print FILE " modules\$(DS)libs \\\n";
+   print FILE " modules\$(DS)ciaak \\\n";
+   print FILE " modules\$(DS)rtos\n";
+   close FILE;
+}
+
+#** \brief Builds the executable of the model
+#
+# \return file name of the executable or an empty string if the build failed
+#*
+sub Build
+{
+   my $project = "$OUT/build";
+   my $exe = "$OUT/build/sweep.exe";
+
+   `make clean`;
+   $out = `make generate PROJECT_PATH=$project 2>&1`;
+   logf("make generate output:\n$out");
+   if ($? != 0)
+   {
+      error("make generate failed");
+      return "";
+   }
+   $out = `make PROJECT_PATH=$project MAKE_DEPENDENCIES=0 2>&1`;
+   logf("make output:\n$out");
+   if ($? != 0)
+   {
+      error("make failed");
+      return "";
+   }
+   copy("$BINDIR/sweep.exe", $exe) or die "$BINDIR/sweep.exe can not be copied: $!";
+   chmod(0755, $exe);
+
+   return $exe;
+}
+
+#** \brief Writes the post build image of a variant
+#
+# The image is the template written by the model with the priorities of
+# the variant. The ceiling of each resource is the highest priority of the
+# tasks using it. The layout is the one of PostBuildImageType of the x86
+# port: the header, the tasks and the resources.
+#
+# \param[in] index index of the variant
+# \param[in] variant reference to the hash with the values of the parameters
+# \param[in] template content of the template image
+#*
+sub WriteVariantImage
+{
+   my ($index, $variant, $template) = @_;
+   my $image = $template;
+   my ($magic, $version, $taskscount, $resourcescount) = unpack("L4", $image);
+   my $tasksize = 32 + 6 * 4;
+   my $resources = 7 * 4 + $taskscount * $tasksize;
+   my @ceilings = (0) x $resourcescount;
+
+   for (my $loopi = 0; $loopi < $taskscount; $loopi++)
+   {
+      my $offset = 7 * 4 + $loopi * $tasksize;
+      my ($name, $prio, $act, $ext, $pre, $events, $resmask) =
+         unpack("Z32 L6", substr($image, $offset, $tasksize));
+      if (exists($taskparams{$name}))
+      {
+         $prio = $variant->{$taskparams{$name}};
+         substr($image, $offset + 32, 4) = pack("L", $prio);
+      }
+      for (my $loopj = 0; $loopj < $resourcescount; $loopj++)
+      {
+         if ( ($resmask & (1 << $loopj)) && ($prio > $ceilings[$loopj]) )
+         {
+            $ceilings[$loopj] = $prio;
+         }
+      }
+   }
+   for (my $loopj = 0; $loopj < $resourcescount; $loopj++)
+   {
+      substr($image, $resources + $loopj * 4, 4) = pack("L", $ceilings[$loopj]);
+   }
+
+   `mkdir -p $OUT/$index`;
+   open IMG, ">$OUT/$index/sweep.img" or die "$OUT/$index/sweep.img can not be opened: $!";
+   binmode(IMG);
+   print IMG $image;
+   close(IMG);
+}
+
+#** \brief Runs the variants in parallel
+#
+# \param[in] exe executable of the model
+# \param[in] list of indexes of the variants to be run
+#*
+sub RunVariants
+{
+   my ($exe, @queue) = @_;
+   my %running = ();
+
+   while ( (@queue > 0) || (keys(%running) > 0) )
+   {
+      while ( (@queue > 0) && (keys(%running) < $JOBS) )
+      {
+         my $index = shift(@queue);
+         my $pid = fork();
+         die "fork failed: $!" unless defined($pid);
+         if ($pid == 0)
+         {
+            $ENV{OSEK_POST_BUILD_IMAGE} = "$OUT/$index/sweep.img";
+            foreach my $param (@params)
+            {
+               $ENV{$param->[0]} = @variants[$index]->{$param->[0]};
+            }
+            exec("timeout $TIMEOUT $exe > $OUT/$index/result.txt 2>&1");
+            exit(1);
+         }
+         $running{$pid} = $index;
+      }
+      my $pid = wait();
+      if ($pid > 0)
+      {
+         info("variant $running{$pid} finished with status $?");
+         delete $running{$pid};
+      }
+   }
+}
+
+#** \brief Evaluates the result of a variant
+#
+# \param[in] index index of the variant
+# \return reference to a hash with the missed and dropped jobs, the worst
+#         response time in ticks and the load in percent, undef if the
+#         simulation did not finish
+#*
+sub EvaluateVariant
+{
+   my $index = shift;
+   my %ret = ( misses => 0, response => 0, load => 0 );
+   my $end = 0;
+
+   open RES, "<$OUT/$index/result.txt" or return undef;
+   while (my $line = <RES>)
+   {
+      chomp($line);
+      my @val = split(/:/, $line);
+      if ($val[0] eq "SWEEP")
+      {
+         given ($val[1])
+         {
+            when ("TASK")
+            {
+               # each job is counted once, as miss or as drop
+               $ret{misses} += $val[4] + $val[5];
+               $ret{tasks} .= sprintf("%s=%d/%d ", $val[2], $val[6], $val[7]);
+               if ($val[6] > $ret{response})
+               {
+                  $ret{response} = $val[6];
+               }
+            }
+            when ("LOAD")
+            {
+               $ret{load} = ($val[3] > 0) ? int(($val[2] * 1000) / $val[3]) / 10 : 0;
+            }
+            when ("END") { $end = 1; }
+            default { }
+         }
+      }
+   }
+   close(RES);
+
+   return ($end == 1) ? \%ret : undef;
+}
+
+#** \brief Check if a result dominates another one
+#
+# A result dominates another one if it is not worse in the misses, the worst
+# response time and the load and is better in at least one of them.
+#*
+sub Dominates
+{
+   my ($a, $b) = @_;
+   my $better = 0;
+
+   foreach my $key ("misses", "response", "load")
+   {
+      if ($a->{$key} > $b->{$key})
+      {
+         return 0;
+      }
+      if ($a->{$key} < $b->{$key})
+      {
+         $better = 1;
+      }
+   }
+
+   return $better;
+}
+
+sub VariantString
+{
+   my $variant = shift;
+   return join(" ", map { "$_=$variant->{$_}" } sort keys %$variant);
+}
+
+if ( ($#ARGV + 1 < 2) || ($ARGV[0] ne "-f") ||
+     ( ($#ARGV + 1 > 2) && ( ($#ARGV + 1 != 4) || ($ARGV[2] ne "-o") ) ) )
+{
+   print "sweep.pl -f sweep.cfg [-o model.oil]\n";
+   exit(1);
+}
+
+$cfgfile = $ARGV[1];
+readparam($cfgfile);
+if ($#ARGV + 1 == 4)
+{
+   $OIL = $ARGV[3];
+}
+if ($OIL eq "")
+{
+   $OIL = "$MODEL/etc/sweep.oil";
+}
+
+if ($JOBS == 0)
+{
+   # use all cores of the host
+   $JOBS = `nproc`;
+   chomp($JOBS);
+   $JOBS = ($JOBS > 0) ? $JOBS : 1;
+}
+
+mkpath(dirname($logfile));
+open LOGFILE, "> $logfile" or die "can not open $logfile: $!";
+
+info("Configuration file: $cfgfile");
+info("OIL file: $OIL");
+if ($ARCH ne "x86")
+{
+   error("the sweep runs only on ARCH x86");
+   finish();
+}
+
+system("rm -rf $OUT");
+mkpath($OUT);
+
+GetTaskParams();
+if ($errors > 0)
+{
+   finish();
+}
+
+@variants = GetVariants();
+info("Variants: " . scalar(@variants) . " - Jobs: $JOBS");
+
+# build the model once, all variants use the same executable
+CreateProject();
+$exe = Build();
+if ($exe eq "")
+{
+   finish();
+}
+
+# the template image has the configuration of the OIL file
+$ENV{SWEEP_TEMPLATE} = "$OUT/build/sweep.img";
+system("$exe");
+delete $ENV{SWEEP_TEMPLATE};
+if ( ($? != 0) || !open(IMG, "<$OUT/build/sweep.img") )
+{
+   error("the template image could not be written, is POSTBUILD = TRUE set in $OIL?");
+   finish();
+}
+binmode(IMG);
+$template = do { local $/; <IMG> };
+close(IMG);
+
+for ($index = 0; $index < @variants; $index++)
+{
+   info("Variant $index: " . VariantString(@variants[$index]));
+   WriteVariantImage($index, @variants[$index], $template);
+}
+
+# run all variants
+RunVariants($exe, (0 .. $#variants));
+
+# collect the results
+%results = ();
+open CSV, ">$OUT/sweep.csv" or die "$OUT/sweep.csv can not be opened: $!";
+print CSV join(";", "variant", (map { $_->[0] } @params), "misses", "response", "load", "tasks") . "\n";
+for ($index = 0; $index < @variants; $index++)
+{
+   $result = EvaluateVariant($index);
+   if (defined($result))
+   {
+      $results{$index} = $result;
+      print CSV join(";", $index, (map { @variants[$index]->{$_->[0]} } @params),
+         $result->{misses}, $result->{response}, $result->{load}, $result->{tasks}) . "\n";
+   }
+   else
+   {
+      error("variant $index did not finish the simulation");
+   }
+}
+close(CSV);
+
+# report the variants which are not dominated by any other variant
+info("Pareto-best variants (misses, worst response time, load %):");
+foreach $index (sort { $a <=> $b } keys %results)
+{
+   $dominated = 0;
+   foreach $other (keys %results)
+   {
+      if (Dominates($results{$other}, $results{$index}))
+      {
+         $dominated = 1;
+      }
+   }
+   if ($dominated == 0)
+   {
+      info(sprintf("variant %d: %s - misses: %d - response: %d - load: %.1f",
+         $index, VariantString(@variants[$index]), $results{$index}->{misses},
+         $results{$index}->{response}, $results{$index}->{load}));
+   }
+}
+info("Results of all variants in $OUT/sweep.csv");
+
+finish();
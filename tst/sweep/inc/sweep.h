@@ -0,0 +1,137 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _SWEEP_H_
+#define _SWEEP_H_
+/** \brief FreeOSEK Os Simulation Sweep Model Header File
+ **
+ ** The sweep runner FreeOSEK/Os/tst/sweep/bin/sweep.pl passes the
+ ** parameters of the model in environment variables with the names of the
+ ** defines below, the defines are the defaults. The priorities of the tasks
+ ** are set by the post build image of each variant, all variants run with
+ ** the same executable. All times are given in ticks of the virtual time.
+ **
+ ** \file FreeOSEK/Os/tst/sweep/inc/sweep.h
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_SWEEP Simulation sweep
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "Types.h"
+
+/*==================[macros]=================================================*/
+/** \brief Count of virtual ticks simulated */
+#ifndef SWEEP_DURATION
+#define SWEEP_DURATION 100000
+#endif
+
+/** \brief Count of periodic tasks of the model */
+#define SWEEP_TASKS_COUNT 3
+
+/** \brief Environment variable with the name of the template image
+ **
+ ** If it is set the model saves its configuration as post build image to
+ ** this file and finishes without starting the os.
+ **/
+#define SWEEP_TEMPLATE_ENV "SWEEP_TEMPLATE"
+
+/** \brief Period of Task1, it is also the deadline of each job */
+#ifndef SWEEP_PERIOD_TASK1
+#define SWEEP_PERIOD_TASK1 10
+#endif
+
+/** \brief Period of Task2, it is also the deadline of each job */
+#ifndef SWEEP_PERIOD_TASK2
+#define SWEEP_PERIOD_TASK2 20
+#endif
+
+/** \brief Period of Task3, it is also the deadline of each job */
+#ifndef SWEEP_PERIOD_TASK3
+#define SWEEP_PERIOD_TASK3 50
+#endif
+
+/** \brief Execution time of each job of Task1 */
+#ifndef SWEEP_EXEC_TASK1
+#define SWEEP_EXEC_TASK1 2
+#endif
+
+/** \brief Execution time of each job of Task2 */
+#ifndef SWEEP_EXEC_TASK2
+#define SWEEP_EXEC_TASK2 4
+#endif
+
+/** \brief Execution time of each job of Task3 */
+#ifndef SWEEP_EXEC_TASK3
+#define SWEEP_EXEC_TASK3 10
+#endif
+
+/*==================[typedef]================================================*/
+/** \brief Statistics of a periodic task of the model
+ **
+ ** Each job is counted once, either as miss or as drop.
+ **
+ ** \param Jobs count of completed jobs
+ ** \param Misses count of jobs which have not been completed before their
+ **        deadline
+ ** \param Drops count of releases dropped because the previous job was not
+ **        completed
+ ** \param MaxResponse highest response time of a job
+ ** \param SumResponse sum of the response times of all jobs
+ ** \param Release release time of the actual job
+ ** \param Missed TRUE if the actual job has already been counted as miss
+ **/
+typedef struct {
+   uint32 Jobs;
+   uint32 Misses;
+   uint32 Drops;
+   uint32 MaxResponse;
+   uint32 SumResponse;
+   uint32 Release;
+   boolean Missed;
+} SweepTaskStatType;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
+#endif /* #ifndef _SWEEP_H_ */
@@ -0,0 +1,313 @@
+/* Copyright 2014, ACSE & CADIEEL
+ *      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+ *      CADIEEL: http://www.cadieel.org.ar
+ *
+ * This file is part of CIAA Firmware.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/** \brief FreeOSEK Os Simulation Sweep Model
+ **
+ ** Periodic task set simulated in virtual time. The virtual time is
+ ** advanced by the model itself, each tick of execution of a task and each
+ ** tick of the task Idle advances it by one. So the results do not depend
+ ** on the load of the host and many variants can run at the same time.
+ **
+ ** At each tick the periodic tasks are released with ActivateTask while
+ ** RES_SCHEDULER is taken, the release of RES_SCHEDULER preempts the
+ ** running task if a task with a higher priority has been released. At the
+ ** end of the simulation the statistics are printed with the format:
+ **    SWEEP:TASK:<name>:<jobs>:<misses>:<max response>:<mean response>
+ **    SWEEP:LOAD:<busy ticks>:<total ticks>
+ **    SWEEP:END
+ ** this format is used by the sweep runner.
+ **
+ ** \file FreeOSEK/Os/tst/sweep/src/sweep.c
+ **/
+
+/** \addtogroup FreeOSEK
+ ** @{ */
+/** \addtogroup FreeOSEK_Os
+ ** @{ */
+/** \addtogroup FreeOSEK_Os_SWEEP Simulation sweep
+ ** @{ */
+
+/*==================[inclusions]=============================================*/
+#include "os.h"
+#include "sweep.h"
+#include "stdio.h"
+#include "stdlib.h"
+
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/** \brief Advance the virtual time one tick
+ **
+ ** Releases the periodic tasks of the new tick and finishes the
+ ** simulation after SWEEP_DURATION ticks.
+ **
+ ** \param[in] busy TRUE if the tick has been used by a periodic task
+ **/
+static void Sweep_Tick(boolean busy);
+
+/** \brief Release the periodic tasks of the actual tick */
+static void Sweep_Release(void);
+
+/** \brief Execute a job of a periodic task
+ **
+ ** \param[in] index index of the task in the model
+ ** \param[in] exec execution time of the job in ticks
+ **/
+static void Sweep_Job(uint8 index, uint32 exec);
+
+/** \brief Print the statistics and finish the simulation */
+static void Sweep_Finish(void);
+
+/** \brief Get a parameter of the model
+ **
+ ** \param[in] name name of the environment variable of the parameter
+ ** \param[in] def value used if the variable is not set or not a positive
+ **            number
+ ** \return value of the parameter
+ **/
+static uint32 Sweep_Param(const char * name, uint32 def);
+
+/*==================[internal data definition]===============================*/
+/** \brief Tasks of the model */
+static const TaskType Sweep_Tasks[SWEEP_TASKS_COUNT] = {
+   Task1, Task2, Task3
+};
+
+/** \brief Names of the tasks of the model */
+static const char * const Sweep_Names[SWEEP_TASKS_COUNT] = {
+   "Task1", "Task2", "Task3"
+};
+
+/** \brief Periods of the tasks of the model */
+static uint32 Sweep_Periods[SWEEP_TASKS_COUNT];
+
+/** \brief Execution times of the jobs of the tasks of the model */
+static uint32 Sweep_Execs[SWEEP_TASKS_COUNT];
+
+/** \brief Count of virtual ticks simulated */
+static uint32 Sweep_Duration;
+
+/** \brief Statistics of the tasks of the model */
+static SweepTaskStatType Sweep_Stats[SWEEP_TASKS_COUNT];
+
+/** \brief Actual virtual time */
+static uint32 Sweep_Time = 0;
+
+/** \brief Count of ticks used by the periodic tasks */
+static uint32 Sweep_Busy = 0;
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void Sweep_Tick(boolean busy)
+{
+   (void)GetResource(RES_SCHEDULER);
+
+   if (TRUE == busy)
+   {
+      Sweep_Busy++;
+   }
+   Sweep_Time++;
+
+   if (Sweep_Time >= Sweep_Duration)
+   {
+      Sweep_Finish();
+   }
+
+   Sweep_Release();
+
+   /* a released task with a higher priority preempts the running task */
+   (void)ReleaseResource(RES_SCHEDULER);
+}
+
+static void Sweep_Release(void)
+{
+   uint8 loopi;
+
+   for (loopi = 0; loopi < SWEEP_TASKS_COUNT; loopi++)
+   {
+      if (0 == (Sweep_Time % Sweep_Periods[loopi]))
+      {
+         if (E_OK == ActivateTask(Sweep_Tasks[loopi]))
+         {
+            Sweep_Stats[loopi].Release = Sweep_Time;
+            Sweep_Stats[loopi].Missed = FALSE;
+         }
+         else
+         {
+            /* the previous job is not completed at its deadline, this
+             * release is dropped */
+            if (FALSE == Sweep_Stats[loopi].Missed)
+            {
+               Sweep_Stats[loopi].Misses++;
+               Sweep_Stats[loopi].Missed = TRUE;
+            }
+            Sweep_Stats[loopi].Drops++;
+         }
+      }
+   }
+}
+
+static void Sweep_Job(uint8 index, uint32 exec)
+{
+   uint32 response;
+
+   for (; exec > 0; exec--)
+   {
+      Sweep_Tick(TRUE);
+   }
+
+   response = Sweep_Time - Sweep_Stats[index].Release;
+
+   Sweep_Stats[index].Jobs++;
+   Sweep_Stats[index].SumResponse += response;
+   if (response > Sweep_Stats[index].MaxResponse)
+   {
+      Sweep_Stats[index].MaxResponse = response;
+   }
+   if ( (response > Sweep_Periods[index]) &&
+        (FALSE == Sweep_Stats[index].Missed) )
+   {
+      Sweep_Stats[index].Misses++;
+      Sweep_Stats[index].Missed = TRUE;
+   }
+}
+
+static void Sweep_Finish(void)
+{
+   uint8 loopi;
+
+   for (loopi = 0; loopi < SWEEP_TASKS_COUNT; loopi++)
+   {
+      printf("SWEEP:TASK:%s:%u:%u:%u:%u:%u\n", Sweep_Names[loopi],
+            (unsigned int)Sweep_Stats[loopi].Jobs,
+            (unsigned int)Sweep_Stats[loopi].Misses,
+            (unsigned int)Sweep_Stats[loopi].Drops,
+            (unsigned int)Sweep_Stats[loopi].MaxResponse,
+            (unsigned int)(Sweep_Stats[loopi].SumResponse /
+               ( (Sweep_Stats[loopi].Jobs > 0) ? Sweep_Stats[loopi].Jobs : 1 ) ) );
+   }
+   printf("SWEEP:LOAD:%u:%u\n", (unsigned int)Sweep_Busy, (unsigned int)Sweep_Time);
+   printf("SWEEP:END\n");
+
+   (void)fflush(stdout);
+   exit(0);
+}
+
+static uint32 Sweep_Param(const char * name, uint32 def)
+{
+   uint32 ret = def;
+   const char * value = getenv(name);
+   char * end;
+
+   if (NULL != value)
+   {
+      ret = (uint32)strtoul(value, &end, 0);
+      if ( (end == value) || ('\0' != *end) || (0 == ret) )
+      {
+         ret = def;
+      }
+   }
+
+   return ret;
+}
+
+/*==================[external functions definition]==========================*/
+int main
+(
+   void
+)
+{
+   const char * name = getenv(SWEEP_TEMPLATE_ENV);
+
+   if (NULL != name)
+   {
+      /* sweep.pl derives the images of the variants from this one */
+      exit( (E_OK == PostBuildSave_Arch(name)) ? 0 : 1 );
+   }
+
+   Sweep_Duration = Sweep_Param("SWEEP_DURATION", SWEEP_DURATION);
+   Sweep_Periods[0] = Sweep_Param("SWEEP_PERIOD_TASK1", SWEEP_PERIOD_TASK1);
+   Sweep_Periods[1] = Sweep_Param("SWEEP_PERIOD_TASK2", SWEEP_PERIOD_TASK2);
+   Sweep_Periods[2] = Sweep_Param("SWEEP_PERIOD_TASK3", SWEEP_PERIOD_TASK3);
+   Sweep_Execs[0] = Sweep_Param("SWEEP_EXEC_TASK1", SWEEP_EXEC_TASK1);
+   Sweep_Execs[1] = Sweep_Param("SWEEP_EXEC_TASK2", SWEEP_EXEC_TASK2);
+   Sweep_Execs[2] = Sweep_Param("SWEEP_EXEC_TASK3", SWEEP_EXEC_TASK3);
+
+   /* start OS in AppMode 1 */
+   StartOS(AppMode1);
+
+   /* shall never return */
+   while(1);
+
+   return 0;
+}
+
+TASK(Idle)
+{
+   /* release the tasks at the time 0 */
+   (void)GetResource(RES_SCHEDULER);
+   Sweep_Release();
+   (void)ReleaseResource(RES_SCHEDULER);
+
+   while(1)
+   {
+      Sweep_Tick(FALSE);
+   }
+}
+
+TASK(Task1)
+{
+   Sweep_Job(0, Sweep_Execs[0]);
+   TerminateTask();
+}
+
+TASK(Task2)
+{
+   Sweep_Job(1, Sweep_Execs[1]);
+   TerminateTask();
+}
+
+TASK(Task3)
+{
+   Sweep_Job(2, Sweep_Execs[2]);
+   TerminateTask();
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/*==================[end of file]============================================*/
@@ -0,0 +1,387 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Trace decoder
+#
+# Decodes a trace of the kernel and prints the timeline of the recorded
+# events and the execution time of each task. The trace is a memory dump of
+# the variable Osek_Trace, on x86 it can be written with TraceSave_Arch, on
+# other targets it can be dumped with the debugger, for example with gdb:
+#    dump binary value trace.bin Osek_Trace
+#
+# The byte order of the target is detected from the trace. If the generated
+# include directory is given the tasks, alarms and isrs are printed with the
+# names of the configuration.
+#
+# Usage:
+#    perl modules/rtos/tst/trace/bin/trace.pl [-g <gen inc dir>] [-f <Hz>] trace.bin
+#
+
+use File::Basename;
+
+$errors = 0;
+
+# record types, see TRACE_REC_* in Os_Internal.h
+$REC_SWITCH = 1;
+$REC_ACTIVATE = 2;
+$REC_SETEVENT = 3;
+$REC_ALARM = 4;
+$REC_ISR_ENTER = 5;
+$REC_ISR_EXIT = 6;
+$REC_ERROR = 7;
+$REC_DEADLINE = 8;
+$REC_TRIGGER = 9;
+$REC_USER = 10;
+
+# count of ids of each record type
+@RecordIds = ( 0, 1, 1, 2, 1, 1, 1, 2, 1, 0, 1 );
+
+@SwitchReasons = ( "preempted", "terminated", "waiting", "idle" );
+@Modes = ( "", "SNAPSHOT", "RING" );
+@States = ( "RECORDING", "TRIGGERED", "STOPPED" );
+
+%TaskNames = ();
+%AlarmNames = ();
+%IsrNames = ();
+%ServiceNames = ();
+%ErrorNames = ();
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Read the names of the configuration
+#
+# \param[in] dir directory of the generated include files
+#*
+sub ReadNames
+{
+   my $dir = shift;
+   my $comment = "";
+
+   if (open CFG, "<$dir/Os_Cfg.h")
+   {
+      while (my $line = <CFG>)
+      {
+         if ($line =~ /^#define (\w+) (\d+)$/)
+         {
+            if ($comment =~ /Task Definition/)
+            {
+               $TaskNames{$2} = $1;
+            }
+            elsif ($comment =~ /Definition of the Alarm/)
+            {
+               $AlarmNames{$2} = $1;
+            }
+         }
+         $comment = $line;
+      }
+      close CFG;
+   }
+   else
+   {
+      error("$dir/Os_Cfg.h can not be opened: $!");
+   }
+
+   if (open CFG, "<$dir/Os_Internal_Cfg.h")
+   {
+      while (my $line = <CFG>)
+      {
+         if ($line =~ /^#define OSEK_TRACE_ISR_(\w+) (\d+)$/)
+         {
+            $IsrNames{$2} = $1;
+         }
+      }
+      close CFG;
+   }
+   else
+   {
+      error("$dir/Os_Internal_Cfg.h can not be opened: $!");
+   }
+}
+
+#** \brief Read the service ids and the errors of os.h
+#*
+sub ReadServices
+{
+   my $os = dirname(__FILE__) . "/../../../inc/os.h";
+
+   if (open OS, "<$os")
+   {
+      while (my $line = <OS>)
+      {
+         if ($line =~ /^#define OSServiceId_(\w+)\s+(0x[0-9a-fA-F]+|\d+)/)
+         {
+            $ServiceNames{($2 =~ /^0x/) ? hex($2) : $2} = $1;
+         }
+         elsif ($line =~ /^#define (E_\w+)\s+\(\(StatusType\)(\d+)U\)/)
+         {
+            $ErrorNames{$2} = $1;
+         }
+      }
+      close OS;
+   }
+}
+
+sub Name
+{
+   my ($names, $id) = @_;
+
+   return exists($names->{$id}) ? $names->{$id} : $id;
+}
+
+sub TaskName
+{
+   my $task = shift;
+
+   return ($task == 255) ? "idle" : Name(\%TaskNames, $task);
+}
+
+#** \brief Decode a variable length integer
+#
+# \param[in] pos position in the buffer
+# \return value and position after the value
+#*
+sub Decode
+{
+   my $pos = shift;
+   my $value = 0;
+   my $shift = 0;
+   my $byte;
+
+   do
+   {
+      $byte = $buffer[$pos];
+      $value |= ($byte & 0x7F) << $shift;
+      $shift += 7;
+      $pos = ($pos + 1) % $size;
+   } while ($byte & 0x80);
+
+   return ($value, $pos);
+}
+
+$gendir = "";
+$frequency = 0;
+while ( ($#ARGV >= 0) && ($ARGV[0] =~ /^-/) )
+{
+   $opt = shift(@ARGV);
+   if ($opt eq "-g")
+   {
+      $gendir = shift(@ARGV);
+   }
+   elsif ($opt eq "-f")
+   {
+      $frequency = shift(@ARGV);
+   }
+}
+
+if ($#ARGV != 0)
+{
+   print "trace.pl [-g <gen inc dir>] [-f <Hz>] trace.bin\n";
+   exit(1);
+}
+
+ReadServices();
+if ($gendir ne "")
+{
+   ReadNames($gendir);
+}
+
+open TRACE, "<$ARGV[0]" or die "Trace $ARGV[0] can not be opened: $!";
+binmode TRACE;
+local $/;
+$image = <TRACE>;
+close TRACE;
+
+# the magic is "OSKT" stored in the byte order of the target
+if (unpack("V", $image) == 0x4F534B54)
+{
+   $u32 = "V";
+}
+elsif (unpack("N", $image) == 0x4F534B54)
+{
+   $u32 = "N";
+}
+else
+{
+   die "$ARGV[0] is not a trace";
+}
+
+($version, $mode, $state, $task, $tailtask) = unpack("x4 C C C C C", $image);
+($freq, $size, $head, $tail, $used, $tailtime, $lasttime, $post) =
+   unpack("x12 $u32 $u32 $u32 $u32 $u32 $u32 $u32 $u32", $image);
+@buffer = unpack("x44 C$size", $image);
+
+if ($version != 1)
+{
+   die "trace version $version is not supported";
+}
+if ($frequency == 0)
+{
+   $frequency = ($freq != 0) ? $freq : 1000000;
+}
+
+# decode all records, the time is accumulated from the time before the first
+# record
+@records = ();
+$time = $tailtime;
+$pos = $tail;
+$count = 0;
+$trigger = -1;
+while ($count < $used)
+{
+   my $start = $pos;
+   my $header = $buffer[$pos];
+   my %rec = ( type => $header >> 4, aux => $header & 0x0F );
+   my $delta;
+   my @ids = ();
+
+   $pos = ($pos + 1) % $size;
+   ($delta, $pos) = Decode($pos);
+   for (my $i = 0; $i < $RecordIds[$rec{type}]; $i++)
+   {
+      my $id;
+      ($id, $pos) = Decode($pos);
+      push(@ids, $id);
+   }
+   $time += $delta;
+   $rec{time} = $time;
+   $rec{ids} = \@ids;
+   push(@records, \%rec);
+
+   if ( ($rec{type} == $REC_TRIGGER) && ($trigger < 0) )
+   {
+      $trigger = $time;
+   }
+
+   $count += ($pos - $start + $size) % $size;
+}
+
+# the times are printed relative to the trigger, negative times are events
+# before the trigger
+$origin = ($trigger >= 0) ? $trigger : $tailtime;
+
+printf("Trace: %s - %s - %d records - %d of %d bytes - %d Hz\n",
+   $Modes[$mode], $States[$state], scalar(@records), $used, $size, $frequency);
+printf("%14s  %s\n", "time [us]", "event");
+
+%runtime = ();
+%jobs = ();
+%preemptions = ();
+%misses = ();
+$running = $tailtask;
+$runstart = $tailtime;
+foreach $rec (@records)
+{
+   my @ids = @{$rec->{ids}};
+   my $type = $rec->{type};
+   my $text;
+
+   if ($type == $REC_SWITCH)
+   {
+      my $next = ($ids[0] == 0) ? 255 : $ids[0] - 1;
+      $text = sprintf("%s -> %s (%s)", TaskName($running), TaskName($next),
+         $SwitchReasons[$rec->{aux}]);
+      if ($running != 255)
+      {
+         $runtime{$running} += $rec->{time} - $runstart;
+      }
+      if ($rec->{aux} == 0)
+      {
+         $preemptions{$running}++;
+      }
+      $running = $next;
+      $runstart = $rec->{time};
+   }
+   elsif ($type == $REC_ACTIVATE)
+   {
+      $text = "activate " . TaskName($ids[0]);
+      $jobs{$ids[0]}++;
+   }
+   elsif ($type == $REC_SETEVENT)
+   {
+      $text = sprintf("set event 0x%x of %s", $ids[1], TaskName($ids[0]));
+   }
+   elsif ($type == $REC_ALARM)
+   {
+      $text = "alarm " . Name(\%AlarmNames, $ids[0]) . " expired";
+   }
+   elsif ($type == $REC_ISR_ENTER)
+   {
+      $text = "isr " . Name(\%IsrNames, $ids[0]) . " start";
+   }
+   elsif ($type == $REC_ISR_EXIT)
+   {
+      $text = "isr " . Name(\%IsrNames, $ids[0]) . " end";
+   }
+   elsif ($type == $REC_ERROR)
+   {
+      $text = "error " . Name(\%ErrorNames, $ids[1]) . " in " . Name(\%ServiceNames, $ids[0]);
+   }
+   elsif ($type == $REC_DEADLINE)
+   {
+      $text = "deadline miss of " . TaskName($ids[0]);
+      $misses{$ids[0]}++;
+   }
+   elsif ($type == $REC_TRIGGER)
+   {
+      $text = "---------- trigger ----------";
+   }
+   elsif ($type == $REC_USER)
+   {
+      $text = "user event " . $rec->{aux} . ": " . $ids[0];
+   }
+   else
+   {
+      error("unknown record type $type");
+      $text = "?";
+   }
+
+   printf("%14.3f  %s\n", ($rec->{time} - $origin) * 1000000 / $frequency, $text);
+}
+if ($running != 255)
+{
+   $runtime{$running} += $lasttime - $runstart;
+}
+
+# execution time of each task in the recorded window
+print "\n";
+printf("%-20s %10s %10s %10s %14s\n", "task", "activated", "preempted", "misses", "runtime [us]");
+foreach $task (sort { $a <=> $b } keys %{{ %runtime, %jobs, %misses }})
+{
+   printf("%-20s %10d %10d %10d %14.3f\n", TaskName($task), $jobs{$task},
+      $preemptions{$task}, $misses{$task}, $runtime{$task} * 1000000 / $frequency);
+}
+
+exit($errors > 0 ? 1 : 0);
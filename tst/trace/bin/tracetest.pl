@@ -0,0 +1,216 @@
+#!/usr/bin/perl
+# Copyright 2014, ACSE & CADIEEL
+#      ACSE: http://www.sase.com.ar/asociacion-civil-sistemas-embebidos/ciaa/
+#      CADIEEL: http://www.cadieel.org.ar
+#
+# This file is part of CIAA Firmware.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from this
+#    software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+# Trace decoder test
+#
+# Encodes a known list of records as a memory dump of Osek_Trace, with the
+# records wrapped around the end of the buffer, decodes it with trace.pl and
+# compares the timeline and the execution times with the expected ones. The
+# test is done for both byte orders.
+#
+# Usage:
+#    perl modules/rtos/tst/trace/bin/tracetest.pl
+#
+
+use File::Basename;
+use File::Temp qw(tempfile);
+
+$errors = 0;
+
+# size of the buffer and position of the first record, the records wrap
+# around the end of the buffer
+$SIZE = 64;
+$TAIL = 50;
+$TAILTIME = 1000;
+
+# records: type, aux, time since the previous record, ids and the line
+# printed by trace.pl
+@Records = (
+   [ 1, 3, 10, [ 1 ], "idle -> 0 (idle)" ],
+   [ 2, 0, 200, [ 1 ], "activate 1" ],
+   [ 10, 5, 100000, [ 0x4000 ], "user event 5: 16384" ],
+   [ 1, 0, 5, [ 2 ], "0 -> 1 (preempted)" ],
+   [ 9, 0, 1, [ ], "---------- trigger ----------" ],
+   [ 7, 0, 0x80, [ 1, 4 ], "error E_OS_LIMIT in ActivateTask" ],
+   [ 1, 1, 50, [ 0 ], "1 -> idle (terminated)" ],
+   [ 10, 1, 3, [ 0xFFFFFFFF ], "user event 1: 4294967295" ]
+);
+
+sub error
+{
+   print "ERROR " . @_[0] . "\n";
+   $errors++;
+}
+
+#** \brief Encode a variable length integer
+#
+# \param[in] value value to be encoded
+# \return list of bytes, 7 bits per byte and the least significant first
+#*
+sub Encode
+{
+   my $value = shift;
+   my @bytes = ();
+
+   while ($value > 0x7F)
+   {
+      push(@bytes, ($value & 0x7F) | 0x80);
+      $value >>= 7;
+   }
+   push(@bytes, $value);
+
+   return @bytes;
+}
+
+#** \brief Write a trace image
+#
+# \param[in] file file name of the image
+# \param[in] u32 pack format of an uint32, "V" or "N"
+# \return count of used bytes
+#*
+sub WriteImage
+{
+   my ($file, $u32) = @_;
+   my @buffer = (0) x $SIZE;
+   my $pos = $TAIL;
+   my $used = 0;
+   my $time = $TAILTIME;
+
+   foreach my $rec (@Records)
+   {
+      my ($type, $aux, $delta, $ids) = @$rec;
+      my @bytes = ((($type << 4) | $aux), Encode($delta));
+
+      foreach my $id (@$ids)
+      {
+         push(@bytes, Encode($id));
+      }
+      foreach my $byte (@bytes)
+      {
+         $buffer[$pos] = $byte;
+         $pos = ($pos + 1) % $SIZE;
+      }
+      $used += scalar(@bytes);
+      $time += $delta;
+   }
+
+   # version 1, mode RING, state STOPPED, idle task before and after the
+   # records
+   my $image = pack("$u32 C C C C C x3", 0x4F534B54, 1, 2, 2, 255, 255);
+   $image .= pack("$u32" x 8, 1000000, $SIZE, $pos, $TAIL, $used, $TAILTIME,
+      $time, 0);
+   $image .= pack("C$SIZE", @buffer);
+
+   open IMG, ">$file" or die "$file can not be opened: $!";
+   binmode IMG;
+   print IMG $image;
+   close IMG;
+
+   return $used;
+}
+
+#** \brief Check the output of trace.pl
+#
+# \param[in] u32 pack format of an uint32, "V" or "N"
+#*
+sub CheckOrder
+{
+   my $u32 = shift;
+   my ($fh, $file) = tempfile(UNLINK => 1);
+   my $used;
+   my @expected = ();
+   my @output;
+   my $time = $TAILTIME;
+   my $trigger = 0;
+   my %runtime = ();
+   my $running = 255;
+   my $runstart = $TAILTIME;
+
+   close $fh;
+   $used = WriteImage($file, $u32);
+
+   # expected timeline, relative to the trigger
+   foreach my $rec (@Records)
+   {
+      $time += $rec->[2];
+      $rec->[5] = $time;
+      if ($rec->[0] == 9)
+      {
+         $trigger = $time;
+      }
+      if ($rec->[0] == 1)
+      {
+         if ($running != 255)
+         {
+            $runtime{$running} += $time - $runstart;
+         }
+         $running = ($rec->[3][0] == 0) ? 255 : $rec->[3][0] - 1;
+         $runstart = $time;
+      }
+   }
+   push(@expected, sprintf("Trace: RING - STOPPED - %d records - %d of %d bytes - 1000000 Hz",
+      scalar(@Records), $used, $SIZE));
+   push(@expected, sprintf("%14s  %s", "time [us]", "event"));
+   foreach my $rec (@Records)
+   {
+      push(@expected, sprintf("%14.3f  %s", $rec->[5] - $trigger, $rec->[4]));
+   }
+   push(@expected, "");
+   push(@expected, sprintf("%-20s %10s %10s %10s %14s", "task", "activated", "preempted", "misses", "runtime [us]"));
+   push(@expected, sprintf("%-20s %10d %10d %10d %14.3f", "0", 0, 1, 0, $runtime{0}));
+   push(@expected, sprintf("%-20s %10d %10d %10d %14.3f", "1", 1, 0, 0, $runtime{1}));
+
+   @output = `perl "@{[dirname(__FILE__)]}/trace.pl" "$file"`;
+   if ($? != 0)
+   {
+      error("$u32: trace.pl failed");
+   }
+   chomp(@output);
+
+   for (my $loopi = 0; $loopi < @expected; $loopi++)
+   {
+      if ($output[$loopi] ne $expected[$loopi])
+      {
+         error("$u32: line $loopi is \"$output[$loopi]\" instead of \"$expected[$loopi]\"");
+      }
+   }
+   if (@output != @expected)
+   {
+      error("$u32: " . scalar(@output) . " lines instead of " . scalar(@expected));
+   }
+}
+
+CheckOrder("V");
+CheckOrder("N");
+
+print (($errors > 0) ? "tracetest: $errors errors\n" : "tracetest: OK\n");
+exit($errors > 0 ? 1 : 0);